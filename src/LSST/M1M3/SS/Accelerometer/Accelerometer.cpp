@@ -32,6 +32,7 @@
 #include <Conversion.h>
 #include <IFPGA.h>
 #include <M1M3SSPublisher.h>
+#include <RawAccelerometerRecorder.h>
 #include <SupportFPGAData.h>
 #include <TMA.h>
 #include <Timestamp.h>
@@ -44,6 +45,26 @@ Accelerometer::Accelerometer() {
 
     _accelerometerData = M1M3SSPublisher::instance().getAccelerometerData();
     _accelerometerWarning = M1M3SSPublisher::instance().getEventAccelerometerWarning();
+
+    auto& accelerometerSettings = AccelerometerSettings::instance();
+
+    _filterEnabled = accelerometerSettings.filter_enabled;
+    _filterReady = false;
+    if (_filterEnabled) {
+        _filter.configure(accelerometerSettings.raw_sample_rate, accelerometerSettings.filter_cutoff,
+                          accelerometerSettings.filter_order, accelerometerSettings.notch_frequency,
+                          accelerometerSettings.notch_q);
+        SPDLOG_INFO("Accelerometer: filtering raw data sampled at {} Hz, {} sections, latency {:.2f} ms",
+                    accelerometerSettings.raw_sample_rate, _filter.getSections(),
+                    _filter.getLatency() * 1000.0);
+        RawAccelerometerRecorder::instance().set_filter(&_filter);
+    }
+}
+
+Accelerometer::~Accelerometer() {
+    if (_filterEnabled) {
+        RawAccelerometerRecorder::instance().set_filter(NULL);
+    }
 }
 
 void Accelerometer::processData() {
@@ -55,8 +76,21 @@ void Accelerometer::processData() {
 
     auto& accelerometerSettings = AccelerometerSettings::instance();
 
+    // filtered stream is used once the reader thread delivered the first
+    // samples. Until then, single sample from the FPGA is used
+    const float* raw = fpgaData->AccelerometerRaw;
+    float filtered[AccelerometerFilter::CHANNELS];
+    if (_filterEnabled) {
+        if (_filter.getOutput(filtered) > 0) {
+            _filterReady = true;
+        }
+        if (_filterReady) {
+            raw = filtered;
+        }
+    }
+
     for (int i = 0; i < 8; i++) {
-        _accelerometerData->rawAccelerometer[i] = fpgaData->AccelerometerRaw[i];
+        _accelerometerData->rawAccelerometer[i] = raw[i];
         _accelerometerData->accelerometer[i] =
                 G2M_S_2(((_accelerometerData->rawAccelerometer[i] - accelerometerSettings.bias[i]) /
                          accelerometerSettings.sensitivity[i]) *
@@ -28,12 +28,17 @@
 
 #include <SAL_MTM1M3.h>
 
+#include <AccelerometerFilter.h>
+
 namespace LSST {
 namespace M1M3 {
 namespace SS {
 
 /*!
- * The class used to process accelerometer data.
+ * The class used to process accelerometer data. If enabled in settings,
+ * accelerometer data are calculated from the raw DC accelerometer stream
+ * filtered with AccelerometerFilter, instead of a single sample taken every
+ * outer loop cycle.
  */
 class Accelerometer {
 public:
@@ -41,6 +46,7 @@ public:
      * Instantiates the accelerometer.
      */
     Accelerometer();
+    ~Accelerometer();
 
     /*!
      * Processes currently available accelerometer data and publish it.
@@ -50,6 +56,10 @@ public:
 private:
     MTM1M3_accelerometerDataC* _accelerometerData;
     MTM1M3_logevent_accelerometerWarningC* _accelerometerWarning;
+
+    AccelerometerFilter _filter;
+    bool _filterEnabled;
+    bool _filterReady;
 };
 
 } /* namespace SS */
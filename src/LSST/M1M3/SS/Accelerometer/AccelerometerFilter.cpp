@@ -0,0 +1,159 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <AccelerometerFilter.h>
+
+using namespace LSST::M1M3::SS;
+
+AccelerometerFilter::AccelerometerFilter() : _sampleRate(0), _latency(0), _sections(0) { reset(); }
+
+void AccelerometerFilter::configure(double sampleRate, double cutoff, int order, double notchFrequency,
+                                    double notchQ) {
+    if (!(sampleRate > 0)) {
+        throw std::runtime_error(fmt::format("Invalid accelerometer sample rate: {}", sampleRate));
+    }
+    if (order < 0 || order > MAX_ORDER || order % 2 != 0) {
+        throw std::runtime_error(fmt::format("Invalid accelerometer filter order {}, must be even and <= {}",
+                                             order, MAX_ORDER));
+    }
+    double nyquist = sampleRate / 2.0;
+    if (order > 0 && !(cutoff > 0 && cutoff < nyquist)) {
+        throw std::runtime_error(fmt::format(
+                "Invalid accelerometer filter cutoff {} Hz, must be within (0, {}) Hz", cutoff, nyquist));
+    }
+    if (notchFrequency < 0 || notchFrequency >= nyquist) {
+        throw std::runtime_error(fmt::format(
+                "Invalid accelerometer notch frequency {} Hz, must be within [0, {}) Hz", notchFrequency,
+                nyquist));
+    }
+    if (notchFrequency > 0 && !(notchQ > 0)) {
+        throw std::runtime_error(fmt::format("Invalid accelerometer notch quality factor: {}", notchQ));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _sampleRate = sampleRate;
+    _sections = 0;
+    _latency = 0;
+
+    // Butterworth low pass as cascade of biquads, bilinear transform with
+    // prewarping at cutoff frequency
+    if (order > 0) {
+        double w0 = 2.0 * M_PI * cutoff / sampleRate;
+        double cosW0 = cos(w0);
+        double sinW0 = sin(w0);
+        for (int k = 0; k < order / 2; k++) {
+            double q = 1.0 / (2.0 * cos((2 * k + 1) * M_PI / (2.0 * order)));
+            double alpha = sinW0 / (2.0 * q);
+            _addSection((1.0 - cosW0) / 2.0, 1.0 - cosW0, (1.0 - cosW0) / 2.0, 1.0 + alpha, -2.0 * cosW0,
+                        1.0 - alpha);
+        }
+    }
+
+    if (notchFrequency > 0) {
+        double w0 = 2.0 * M_PI * notchFrequency / sampleRate;
+        double alpha = sin(w0) / (2.0 * notchQ);
+        _addSection(1.0, -2.0 * cos(w0), 1.0, 1.0 + alpha, -2.0 * cos(w0), 1.0 - alpha);
+    }
+
+    _latency /= sampleRate;
+
+    _initialized = false;
+    _newSamples = 0;
+}
+
+void AccelerometerFilter::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _initialized = false;
+    memset(_z1, 0, sizeof(_z1));
+    memset(_z2, 0, sizeof(_z2));
+    memset(_output, 0, sizeof(_output));
+    _newSamples = 0;
+}
+
+void AccelerometerFilter::process(const float* samples, size_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_initialized == false) {
+        // steady state for the first sample - no start-up transient
+        for (size_t c = 0; c < CHANNELS; c++) {
+            double x = samples[c];
+            for (int s = 0; s < _sections; s++) {
+                double y = x * (_b0[s] + _b1[s] + _b2[s]) / (1.0 + _a1[s] + _a2[s]);
+                _z2[s][c] = _b2[s] * x - _a2[s] * y;
+                _z1[s][c] = _b1[s] * x - _a1[s] * y + _z2[s][c];
+                x = y;
+            }
+        }
+        _initialized = true;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const float* sample = samples + i * CHANNELS;
+        for (size_t c = 0; c < CHANNELS; c++) {
+            double x = sample[c];
+            for (int s = 0; s < _sections; s++) {
+                double y = _b0[s] * x + _z1[s][c];
+                _z1[s][c] = _b1[s] * x - _a1[s] * y + _z2[s][c];
+                _z2[s][c] = _b2[s] * x - _a2[s] * y;
+                x = y;
+            }
+            _output[c] = x;
+        }
+    }
+
+    _newSamples += count;
+}
+
+uint64_t AccelerometerFilter::getOutput(float* output) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    memcpy(output, _output, sizeof(_output));
+    uint64_t ret = _newSamples;
+    _newSamples = 0;
+    return ret;
+}
+
+void AccelerometerFilter::_addSection(double b0, double b1, double b2, double a0, double a1, double a2) {
+    _b0[_sections] = b0 / a0;
+    _b1[_sections] = b1 / a0;
+    _b2[_sections] = b2 / a0;
+    _a1[_sections] = a1 / a0;
+    _a2[_sections] = a2 / a0;
+
+    // group delay at DC, in samples
+    _latency += (_b1[_sections] + 2.0 * _b2[_sections]) /
+                        (_b0[_sections] + _b1[_sections] + _b2[_sections]) -
+                (_a1[_sections] + 2.0 * _a2[_sections]) / (1.0 + _a1[_sections] + _a2[_sections]);
+
+    _sections++;
+}
@@ -0,0 +1,133 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACCELEROMETERFILTER_H_
+#define ACCELEROMETERFILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Decimating filter for the raw DC accelerometer stream. Filters all samples
+ * read from the raw accelerometer FIFO with a cascade of second order
+ * sections - Butterworth low pass (anti-alias for the outer loop rate) and an
+ * optional notch. The outer loop takes only the latest filtered sample, so the
+ * output is decimated to the loop rate without aliasing higher frequency
+ * vibrations into it.
+ *
+ * Sections are evaluated in transposed direct form II. Filter state is
+ * initialized from the first sample, so there is no start-up transient.
+ *
+ * Process (called from the raw accelerometer reader thread) and getOutput
+ * (called from the outer loop) are thread safe.
+ */
+class AccelerometerFilter {
+public:
+    /// number of accelerometer channels
+    static constexpr size_t CHANNELS = 8;
+    /// maximal low pass filter order
+    static constexpr int MAX_ORDER = 8;
+    /// maximal number of sections - low pass and notch
+    static constexpr int MAX_SECTIONS = MAX_ORDER / 2 + 1;
+
+    AccelerometerFilter();
+
+    /**
+     * Configures filter. Resets filter state.
+     *
+     * @param sampleRate raw samples rate [Hz]
+     * @param cutoff low pass -3 dB frequency [Hz]
+     * @param order low pass order. Must be even, 0 disables low pass
+     * @param notchFrequency notch frequency [Hz]. 0 disables notch
+     * @param notchQ notch quality factor (frequency / bandwidth)
+     *
+     * @throw std::runtime_error on invalid parameters
+     */
+    void configure(double sampleRate, double cutoff, int order, double notchFrequency = 0,
+                   double notchQ = 0);
+
+    /**
+     * Resets filter state. Next processed sample initializes it.
+     */
+    void reset();
+
+    /**
+     * Filters samples.
+     *
+     * @param samples interleaved samples - CHANNELS values for each sample
+     * @param count number of samples
+     */
+    void process(const float* samples, size_t count);
+
+    /**
+     * Retrieves the latest filtered sample.
+     *
+     * @param output CHANNELS filtered values
+     *
+     * @return number of samples processed since the last call. 0 if no new
+     * samples were processed, output is then the last filtered sample
+     */
+    uint64_t getOutput(float* output);
+
+    /**
+     * Returns filter latency - group delay at low frequencies.
+     *
+     * @return latency in seconds
+     */
+    double getLatency() const { return _latency; }
+
+    int getSections() const { return _sections; }
+
+private:
+    void _addSection(double b0, double b1, double b2, double a0, double a1, double a2);
+
+    std::mutex _mutex;
+
+    double _sampleRate;
+    double _latency;
+
+    int _sections;
+    double _b0[MAX_SECTIONS];
+    double _b1[MAX_SECTIONS];
+    double _b2[MAX_SECTIONS];
+    double _a1[MAX_SECTIONS];
+    double _a2[MAX_SECTIONS];
+
+    bool _initialized;
+    double _z1[MAX_SECTIONS][CHANNELS];
+    double _z2[MAX_SECTIONS][CHANNELS];
+
+    float _output[CHANNELS];
+    uint64_t _newSamples;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !ACCELEROMETERFILTER_H_
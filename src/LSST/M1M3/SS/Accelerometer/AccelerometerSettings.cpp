@@ -30,7 +30,18 @@
 
 using namespace LSST::M1M3::SS;
 
-AccelerometerSettings::AccelerometerSettings(token) { dump_path = "/tmp/rawdc_%FT%T.bin"; }
+AccelerometerSettings::AccelerometerSettings(token) {
+    dump_path = "/tmp/rawdc_%FT%T.bin";
+    dump_buffer_blocks = 256;
+    dump_file_size = 0;
+    dump_max_rate = 0;
+    filter_enabled = false;
+    raw_sample_rate = 0;
+    filter_cutoff = 10;
+    filter_order = 4;
+    notch_frequency = 0;
+    notch_q = 5;
+}
 
 void AccelerometerSettings::load(YAML::Node doc) {
     try {
@@ -65,6 +76,15 @@ void AccelerometerSettings::load(YAML::Node doc) {
         loadElevationPoly("Y", yElevationPoly);
         loadElevationPoly("Z", zElevationPoly);
         dump_path = doc["RawDumpPath"].as<std::string>(dump_path);
+        dump_buffer_blocks = doc["RawDumpBufferBlocks"].as<size_t>(dump_buffer_blocks);
+        dump_file_size = doc["RawDumpFileSize"].as<double>(dump_file_size / 1048576.0) * 1048576;
+        dump_max_rate = doc["RawDumpMaxRate"].as<double>(dump_max_rate / 1048576.0) * 1048576;
+        filter_enabled = doc["FilterEnabled"].as<bool>(filter_enabled);
+        raw_sample_rate = doc["RawSampleRate"].as<double>(raw_sample_rate);
+        filter_cutoff = doc["FilterCutoff"].as<double>(filter_cutoff);
+        filter_order = doc["FilterOrder"].as<int>(filter_order);
+        notch_frequency = doc["NotchFrequency"].as<double>(notch_frequency);
+        notch_q = doc["NotchQ"].as<double>(notch_q);
     } catch (YAML::Exception& ex) {
         throw std::runtime_error(fmt::format("YAML Loading AccelerometerSettings: {}", ex.what()));
     }
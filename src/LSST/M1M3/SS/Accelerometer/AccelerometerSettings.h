@@ -52,6 +52,25 @@ public:
     double zElevationPoly[3];
 
     std::string dump_path;
+    /// raw dump ring buffer size, in RawAccelerometerRecorder::BLOCK_SIZE blocks
+    size_t dump_buffer_blocks;
+    /// raw dump file size (bytes) triggering file rotation, 0 to disable rotation
+    uint64_t dump_file_size;
+    /// maximal raw dump disk throughput (bytes/s), 0 for unlimited
+    double dump_max_rate;
+
+    /// if true, accelerometer data are calculated from filtered raw accelerometer stream
+    bool filter_enabled;
+    /// raw DC accelerometer sample rate (Hz)
+    double raw_sample_rate;
+    /// anti-alias low pass cutoff frequency (Hz)
+    double filter_cutoff;
+    /// anti-alias low pass order, 0 to disable
+    int filter_order;
+    /// notch frequency (Hz), 0 to disable notch
+    double notch_frequency;
+    /// notch quality factor
+    double notch_q;
 };
 
 } /* namespace SS */
@@ -0,0 +1,414 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <spdlog/spdlog.h>
+
+#include <cRIO/Thread.h>
+
+#include <NiFpga_M1M3SupportFPGA.h>
+
+#include <AccelerometerFilter.h>
+#include <IFPGA.h>
+#include <RawAccelerometerRecorder.h>
+
+using namespace std::chrono;
+using namespace std::chrono_literals;
+using namespace LSST::M1M3::SS;
+
+// minimal interval between dropped samples warnings
+constexpr auto DROP_REPORT_INTERVAL = 10s;
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Thread reading raw accelerometer FIFO.
+ */
+class RawAccelerometerReader : public cRIO::Thread {
+public:
+    void run(std::unique_lock<std::mutex>& lock) override {
+        while (keepRunning) {
+            runCondition.wait_for(lock, 1ms);
+            RawAccelerometerRecorder::instance().read_fifo();
+        }
+    }
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+RawAccelerometerRecorder::RawAccelerometerRecorder(token)
+        : _reader(new RawAccelerometerReader()),
+          _reader_running(false),
+          _filter(NULL),
+          _buffer(NULL),
+          _block_count(0),
+          _head(0),
+          _tail(0),
+          _block(NULL),
+          _fill(0),
+          _reading(false),
+          _finish(false),
+          _file_size(0),
+          _max_rate(0),
+          _fd(-1),
+          _file_bytes(0),
+          _read_samples(0),
+          _written_samples(0),
+          _dropped_samples(0),
+          _written_bytes(0),
+          _files(0) {}
+
+RawAccelerometerRecorder::~RawAccelerometerRecorder() {
+    stop();
+    set_filter(NULL);
+    if (_writer.joinable()) {
+        _writer.join();
+    }
+    free(_buffer);
+}
+
+void RawAccelerometerRecorder::start(const std::filesystem::path& path, size_t buffer_blocks,
+                                     uint64_t file_size, double max_rate) {
+    stop();
+    if (_writer.joinable()) {
+        _writer.join();
+    }
+
+    if (buffer_blocks < 2) {
+        buffer_blocks = 2;
+    }
+
+    if (buffer_blocks != _block_count) {
+        free(_buffer);
+        _buffer = static_cast<char*>(aligned_alloc(4096, buffer_blocks * BLOCK_SIZE));
+        if (_buffer == NULL) {
+            _block_count = 0;
+            SPDLOG_ERROR("Cannot allocate {} bytes for raw DC accelerometer buffer",
+                         buffer_blocks * BLOCK_SIZE);
+            return;
+        }
+        _block_count = buffer_blocks;
+        _block_bytes.resize(_block_count);
+    }
+
+    _path = path;
+    _file_size = file_size;
+    _max_rate = max_rate;
+
+    _head = 0;
+    _tail = 0;
+    _block = NULL;
+    _fill = 0;
+    _finish = false;
+
+    _read_samples = 0;
+    _written_samples = 0;
+    _dropped_samples = 0;
+    _written_bytes = 0;
+    _files = 0;
+
+    if (_open(0) == false) {
+        return;
+    }
+
+    SPDLOG_INFO("Recording raw DC accelerometer data to {}, {} kB buffer", _path.string(),
+                _block_count * BLOCK_SIZE / 1024);
+
+    _writer = std::thread(&RawAccelerometerRecorder::_writer_loop, this);
+
+    {
+        std::lock_guard<std::mutex> lock(_record_mutex);
+        _reading = true;
+    }
+    _update_reader();
+}
+
+void RawAccelerometerRecorder::stop() {
+    if (_reading == false) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_record_mutex);
+        _reading = false;
+
+        // commit partially filled block
+        if (_block != NULL && _fill > 0) {
+            _block_bytes[_head % _block_count] = _fill;
+            _head.fetch_add(1, std::memory_order_release);
+            _block = NULL;
+            _fill = 0;
+        }
+    }
+
+    _update_reader();
+
+    {
+        std::lock_guard<std::mutex> lock(_writer_mutex);
+        _finish = true;
+    }
+    _writer_condition.notify_one();
+}
+
+void RawAccelerometerRecorder::set_filter(AccelerometerFilter* filter) {
+    {
+        std::lock_guard<std::mutex> lock(_filter_mutex);
+        _filter = filter;
+    }
+    _update_reader();
+}
+
+RawAccelerometerRecorder::Statistics RawAccelerometerRecorder::get_statistics() {
+    return Statistics{_read_samples, _written_samples, _dropped_samples, _written_bytes, _files};
+}
+
+void RawAccelerometerRecorder::read_fifo() {
+    uint64_t raw[READ_SAMPLES * CHANNELS];
+    IFPGA::get().readRawAccelerometerFIFO(raw, READ_SAMPLES);
+
+    {
+        std::lock_guard<std::mutex> lock(_filter_mutex);
+        if (_filter != NULL) {
+            float samples[READ_SAMPLES * CHANNELS];
+            for (size_t i = 0; i < READ_SAMPLES * CHANNELS; i++) {
+                samples[i] = NiFpga_ConvertFromFxpToFloat(
+                        NiFpga_M1M3SupportFPGA_TargetToHostFifoFxp_RawAccelerometer_TypeInfo, raw[i]);
+            }
+            _filter->process(samples, READ_SAMPLES);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_record_mutex);
+    if (_reading == false) {
+        return;
+    }
+
+    _read_samples += READ_SAMPLES;
+
+    for (size_t s = 0; s < READ_SAMPLES; s++) {
+        if (_block == NULL) {
+            size_t head = _head.load(std::memory_order_relaxed);
+            if (head - _tail.load(std::memory_order_acquire) >= _block_count) {
+                _dropped_samples++;
+                continue;
+            }
+            _block = _buffer + (head % _block_count) * BLOCK_SIZE;
+        }
+
+        // 3 lowest bytes, big endian
+        char* record = _block + _fill;
+        for (size_t c = 0; c < CHANNELS; c++) {
+            uint64_t v = raw[s * CHANNELS + c];
+            record[c * 3] = (v >> 16) & 0xFF;
+            record[c * 3 + 1] = (v >> 8) & 0xFF;
+            record[c * 3 + 2] = v & 0xFF;
+        }
+        _fill += RECORD_SIZE;
+
+        if (_fill == BLOCK_SIZE) {
+            size_t head = _head.load(std::memory_order_relaxed);
+            _block_bytes[head % _block_count] = BLOCK_SIZE;
+            _head.store(head + 1, std::memory_order_release);
+            _block = NULL;
+            _fill = 0;
+            _writer_condition.notify_one();
+        }
+    }
+}
+
+void RawAccelerometerRecorder::_update_reader() {
+    bool run = _reading || _filter != NULL;
+    if (run == _reader_running) {
+        return;
+    }
+    if (run) {
+        _reader->start();
+    } else {
+        _reader->stop(10ms);
+    }
+    _reader_running = run;
+}
+
+void RawAccelerometerRecorder::_writer_loop() {
+    size_t tail = _tail.load(std::memory_order_relaxed);
+    uint64_t reported_dropped = 0;
+    auto next_drop_report = steady_clock::now();
+
+    _next_write = steady_clock::now();
+
+    while (true) {
+        // warn when samples start to be dropped, then summarize drops at most every DROP_REPORT_INTERVAL
+        uint64_t dropped = _dropped_samples;
+        if (dropped != reported_dropped && steady_clock::now() >= next_drop_report) {
+            if (reported_dropped == 0) {
+                SPDLOG_WARN(
+                        "Raw DC accelerometer recording started dropping samples - {} dropped, {} written",
+                        dropped, _written_samples.load());
+            } else {
+                SPDLOG_WARN(
+                        "Raw DC accelerometer recording dropped {} more samples - {} dropped, {} written",
+                        dropped - reported_dropped, dropped, _written_samples.load());
+            }
+            reported_dropped = dropped;
+            next_drop_report = steady_clock::now() + DROP_REPORT_INTERVAL;
+        }
+
+        size_t head = _head.load(std::memory_order_acquire);
+        if (head == tail) {
+            if (_finish) {
+                break;
+            }
+            std::unique_lock<std::mutex> lock(_writer_mutex);
+            _writer_condition.wait_for(lock, 100ms, [this, tail] {
+                return _finish || _head.load(std::memory_order_acquire) != tail;
+            });
+            continue;
+        }
+
+        // consecutive blocks up to the end of the ring, but not spanning file rotation
+        size_t first = tail % _block_count;
+        size_t count = std::min(head - tail, _block_count - first);
+
+        if (_file_size > 0) {
+            if (_file_bytes >= _file_size) {
+                _close();
+                if (_open(_files) == false) {
+                    // don't retry failed rotation on every write
+                    _file_size = 0;
+                }
+            }
+            if (_file_size > _file_bytes) {
+                uint64_t fits = (_file_size - _file_bytes) / BLOCK_SIZE;
+                count = std::max<size_t>(1, std::min<uint64_t>(count, fits));
+            }
+        }
+
+        size_t bytes = 0;
+        for (size_t b = 0; b < count; b++) {
+            bytes += _block_bytes[first + b];
+        }
+
+        if (_max_rate > 0) {
+            std::this_thread::sleep_until(_next_write);
+        }
+
+        if (_fd >= 0 && _write(_buffer + first * BLOCK_SIZE, bytes)) {
+            _written_samples += bytes / RECORD_SIZE;
+            _written_bytes += bytes;
+            _file_bytes += bytes;
+        } else {
+            _dropped_samples += bytes / RECORD_SIZE;
+        }
+
+        tail += count;
+        _tail.store(tail, std::memory_order_release);
+
+        if (_max_rate > 0) {
+            _next_write = steady_clock::now() +
+                          duration_cast<steady_clock::duration>(duration<double>(bytes / _max_rate));
+        }
+    }
+
+    _close();
+
+    auto stats = get_statistics();
+    if (stats.dropped_samples > 0) {
+        SPDLOG_WARN(
+                "Stopped raw DC accelerometer recording - {} samples read, {} written into {} files ({} "
+                "bytes), {} dropped",
+                stats.read_samples, stats.written_samples, stats.files, stats.written_bytes,
+                stats.dropped_samples);
+    } else {
+        SPDLOG_INFO(
+                "Stopped raw DC accelerometer recording - {} samples read, {} written into {} files ({} "
+                "bytes)",
+                stats.read_samples, stats.written_samples, stats.files, stats.written_bytes);
+    }
+}
+
+bool RawAccelerometerRecorder::_open(size_t index) {
+    auto path = _path;
+    if (index > 0) {
+        path.replace_filename(fmt::format("{}_{:03d}{}", _path.stem().string(), index,
+                                          _path.extension().string()));
+    }
+
+    try {
+        std::filesystem::create_directories(path.parent_path());
+    } catch (const std::filesystem::filesystem_error& e) {
+        SPDLOG_ERROR("Cannot create directory for raw DC accelerometer file {}: {}", path.string(),
+                     e.what());
+        return false;
+    }
+
+    _fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (_fd < 0) {
+        SPDLOG_ERROR("Cannot open raw DC accelerometer file {}: {}", path.string(), strerror(errno));
+        return false;
+    }
+
+    _file_bytes = 0;
+    _files++;
+
+    if (index > 0) {
+        SPDLOG_INFO("Rotated raw DC accelerometer recording to {}", path.string());
+    }
+
+    return true;
+}
+
+void RawAccelerometerRecorder::_close() {
+    if (_fd < 0) {
+        return;
+    }
+    if (::close(_fd) != 0) {
+        SPDLOG_ERROR("Cannot close raw DC accelerometer file: {}", strerror(errno));
+    }
+    _fd = -1;
+}
+
+bool RawAccelerometerRecorder::_write(const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t ret = ::write(_fd, data, length);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SPDLOG_ERROR("Cannot record raw DC accelerometer file: {}", strerror(errno));
+            _close();
+            return false;
+        }
+        data += ret;
+        length -= ret;
+    }
+    return true;
+}
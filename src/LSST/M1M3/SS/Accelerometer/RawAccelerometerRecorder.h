@@ -0,0 +1,186 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RAWACCELEROMETERRECORDER_H_
+#define RAWACCELEROMETERRECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cRIO/Singleton.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+class AccelerometerFilter;
+class RawAccelerometerReader;
+
+/**
+ * Records raw DC accelerometer data. Samples are read from the FPGA FIFO by a
+ * reader thread, converted into 3 bytes big-endian records (8 channels per
+ * sample) and stored into preallocated ring of aligned blocks. A dedicated
+ * writer thread writes filled blocks to disk, coalescing consecutive blocks
+ * into a single write. The reader never waits for the disk - if the ring is
+ * full, samples are dropped and counted. The writer warns when drops start
+ * and then summarizes further drops every 10 seconds.
+ *
+ * Disk throughput can be limited, and files are rotated when they reach the
+ * configured size. Rotated files get _001, _002,.. suffix. File format is the
+ * same as before, so utils/dcrawdump can process any of the files.
+ *
+ * Stop doesn't wait for the data to be written - the writer thread drains the
+ * ring and closes the file on its own, so the controller thread isn't stalled.
+ *
+ * The reader thread also feeds all samples into the accelerometer filter, if
+ * one is set. The reader then runs even if nothing is recorded.
+ */
+class RawAccelerometerRecorder : public cRIO::Singleton<RawAccelerometerRecorder> {
+public:
+    RawAccelerometerRecorder(token);
+    ~RawAccelerometerRecorder();
+
+    /// number of accelerometer channels in a sample
+    static constexpr size_t CHANNELS = 8;
+    /// size of a single sample record (3 bytes per channel)
+    static constexpr size_t RECORD_SIZE = CHANNELS * 3;
+    /// samples read from FIFO at once
+    static constexpr size_t READ_SAMPLES = 100;
+    /// samples in ring block. Block size is multiple of 4096 bytes
+    static constexpr size_t BLOCK_SAMPLES = 512;
+    /// ring block size in bytes
+    static constexpr size_t BLOCK_SIZE = BLOCK_SAMPLES * RECORD_SIZE;
+
+    /**
+     * Recording statistics.
+     */
+    struct Statistics {
+        uint64_t read_samples;
+        uint64_t written_samples;
+        uint64_t dropped_samples;
+        uint64_t written_bytes;
+        size_t files;
+    };
+
+    /**
+     * Starts recording. Any previous recording is stopped.
+     *
+     * @param path path of the first recorded file
+     * @param buffer_blocks number of BLOCK_SIZE blocks in the ring buffer
+     * @param file_size maximal file size in bytes. 0 disables file rotation
+     * @param max_rate maximal disk throughput in bytes per second. 0 for unlimited
+     */
+    void start(const std::filesystem::path& path, size_t buffer_blocks, uint64_t file_size, double max_rate);
+
+    /**
+     * Stops reading. Data remaining in the ring buffer are written by the
+     * writer thread, which then closes the file.
+     */
+    void stop();
+
+    /**
+     * Sets filter processing all read samples. Starts the reader thread if
+     * needed. The reader is stopped when the filter is removed and no
+     * recording is in progress.
+     *
+     * @param filter filter receiving samples, NULL to remove the filter
+     */
+    void set_filter(AccelerometerFilter* filter);
+
+    /**
+     * Returns true if the recording is in progress.
+     */
+    bool recording() { return _reading; }
+
+    /**
+     * Returns current statistics.
+     */
+    Statistics get_statistics();
+
+    /**
+     * Reads samples from FPGA FIFO and stores them into the ring buffer.
+     * Called from the reader thread.
+     */
+    void read_fifo();
+
+private:
+    void _update_reader();
+    void _writer_loop();
+    bool _open(size_t index);
+    void _close();
+    bool _write(const char* data, size_t length);
+
+    std::unique_ptr<RawAccelerometerReader> _reader;
+    bool _reader_running;
+    std::thread _writer;
+
+    // protects filter pointer
+    std::mutex _filter_mutex;
+    AccelerometerFilter* _filter;
+    // protects reader state against concurrent stop
+    std::mutex _record_mutex;
+
+    char* _buffer;
+    size_t _block_count;
+    std::vector<size_t> _block_bytes;
+
+    // blocks committed by the reader
+    std::atomic<size_t> _head;
+    // blocks written (or dropped) by the writer
+    std::atomic<size_t> _tail;
+
+    // block currently filled by the reader
+    char* _block;
+    size_t _fill;
+
+    std::atomic<bool> _reading;
+    std::atomic<bool> _finish;
+    std::mutex _writer_mutex;
+    std::condition_variable _writer_condition;
+
+    std::filesystem::path _path;
+    uint64_t _file_size;
+    double _max_rate;
+
+    int _fd;
+    uint64_t _file_bytes;
+    std::chrono::steady_clock::time_point _next_write;
+
+    std::atomic<uint64_t> _read_samples;
+    std::atomic<uint64_t> _written_samples;
+    std::atomic<uint64_t> _dropped_samples;
+    std::atomic<uint64_t> _written_bytes;
+    std::atomic<size_t> _files;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !RAWACCELEROMETERRECORDER_H_
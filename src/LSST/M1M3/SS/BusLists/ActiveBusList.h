@@ -27,6 +27,7 @@
 #include <SAL_MTM1M3C.h>
 
 #include <BusList.h>
+#include <ModbusFramePatcher.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -45,11 +46,8 @@ private:
     MTM1M3_hardpointActuatorDataC* _hardpointActuatorData;
 
     int32_t _setForceCommandIndex[5];
+    ModbusFramePatcher _forceDemandPatcher[5];
     int32_t _hpFreezeCommandIndex[5];
-    int32_t _faStatusCommandIndex[5];
-    int32_t _roundRobinFAReportServerStatusIndex[5];
-    int32_t _hmLVDTCommandIndex[5];
-    int32_t _lvdtSampleClock;
 };
 
 } /* namespace SS */
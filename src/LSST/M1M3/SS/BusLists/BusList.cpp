@@ -23,6 +23,9 @@
 
 #include <BusList.h>
 #include <FPGAAddresses.h>
+#include <ILCApplicationSettings.h>
+#include <ILCMessageFactory.h>
+#include <ILCSubnetData.h>
 #include <cstring>
 #include <spdlog/spdlog.h>
 
@@ -40,6 +43,13 @@ void BusList::buildBuffer() {
     memset(expectedHMResponses, 0, sizeof(expectedHMResponses));
     subnetStartIndex = 0;
     buffer.reset();
+
+    int32_t budget = ILCApplicationSettings::instance().SubnetByteBudget;
+    for (auto& scheduler : _schedulers) {
+        scheduler.clear(budget);
+    }
+    _scheduledRequests.clear();
+    _requestWords.clear();
 }
 
 void BusList::startSubnet(uint8_t subnet) {
@@ -73,3 +83,141 @@ void BusList::endSubnet() {
     this->buffer.writeTriggerIRQ();
     this->buffer.set(this->subnetStartIndex, this->buffer.getIndex() - this->subnetStartIndex - 1);
 }
+
+void BusList::writeFAStatusRequests(uint8_t subnet) {
+    auto& settings = ILCApplicationSettings::instance();
+
+    for (int faIndex = 0; faIndex < subnetData->getFACount(subnet); faIndex++) {
+        const ILCMap& fa = subnetData->getFAIndex(subnet, faIndex);
+        if (fa.Disabled) {
+            continue;
+        }
+        int32_t startIndex = buffer.getIndex();
+        ilcMessageFactory->pneumaticForceStatus(&buffer, fa.Address);
+        expectedFAResponses[fa.DataIndex]++;
+        scheduleRequest(subnet, startIndex, settings.ForceActuatorStatusRate,
+                        fa.Address <= 16 ? SAA_STATUS_BYTES : DAA_STATUS_BYTES, faIndex,
+                        &expectedFAResponses[fa.DataIndex]);
+    }
+
+    for (int faIndex = 0; faIndex < subnetData->getFACount(subnet); faIndex++) {
+        const ILCMap& fa = subnetData->getFAIndex(subnet, faIndex);
+        if (fa.Disabled) {
+            continue;
+        }
+        int32_t startIndex = buffer.getIndex();
+        ilcMessageFactory->reportServerStatus(&buffer, fa.Address);
+        expectedFAResponses[fa.DataIndex]++;
+        scheduleRequest(subnet, startIndex, settings.ForceActuatorServerStatusRate, SERVER_STATUS_BYTES,
+                        faIndex, &expectedFAResponses[fa.DataIndex]);
+    }
+}
+
+void BusList::writeHPStatusRequests(uint8_t subnet) {
+    auto& settings = ILCApplicationSettings::instance();
+
+    for (int hpIndex = 0; hpIndex < subnetData->getHPCount(subnet); hpIndex++) {
+        const ILCMap& hp = subnetData->getHPIndex(subnet, hpIndex);
+        if (hp.Disabled) {
+            continue;
+        }
+        int32_t startIndex = buffer.getIndex();
+        ilcMessageFactory->electromechanicalForceAndStatus(&buffer, hp.Address);
+        expectedHPResponses[hp.DataIndex]++;
+        scheduleRequest(subnet, startIndex, settings.HardpointStatusRate, HP_FORCE_AND_STATUS_BYTES, hpIndex,
+                        &expectedHPResponses[hp.DataIndex]);
+
+        startIndex = buffer.getIndex();
+        ilcMessageFactory->reportServerStatus(&buffer, hp.Address);
+        expectedHPResponses[hp.DataIndex]++;
+        scheduleRequest(subnet, startIndex, settings.HardpointServerStatusRate, SERVER_STATUS_BYTES, hpIndex,
+                        &expectedHPResponses[hp.DataIndex]);
+    }
+}
+
+void BusList::writeHMRequests(uint8_t subnet) {
+    auto& settings = ILCApplicationSettings::instance();
+
+    for (int hmIndex = 0; hmIndex < subnetData->getHMCount(subnet); hmIndex++) {
+        const ILCMap& hm = subnetData->getHMIndex(subnet, hmIndex);
+        if (hm.Disabled) {
+            continue;
+        }
+        int32_t* expected = &expectedHMResponses[hm.DataIndex];
+
+        int32_t startIndex = buffer.getIndex();
+        ilcMessageFactory->reportDCAPressure(&buffer, hm.Address);
+        (*expected)++;
+        scheduleRequest(subnet, startIndex, settings.HardpointMonitorPressureRate, HM_PRESSURE_BYTES, hmIndex,
+                        expected);
+
+        startIndex = buffer.getIndex();
+        ilcMessageFactory->reportDCAStatus(&buffer, hm.Address);
+        (*expected)++;
+        scheduleRequest(subnet, startIndex, settings.HardpointMonitorStatusRate, HM_STATUS_BYTES, hmIndex,
+                        expected);
+
+        startIndex = buffer.getIndex();
+        ilcMessageFactory->reportServerStatus(&buffer, hm.Address);
+        (*expected)++;
+        scheduleRequest(subnet, startIndex, settings.HardpointMonitorServerStatusRate, SERVER_STATUS_BYTES,
+                        hmIndex, expected);
+    }
+
+    for (int hmIndex = 0; hmIndex < subnetData->getHMCount(subnet); hmIndex++) {
+        const ILCMap& hm = subnetData->getHMIndex(subnet, hmIndex);
+        if (hm.Disabled) {
+            continue;
+        }
+        int32_t startIndex = buffer.getIndex();
+        ilcMessageFactory->reportLVDT(&buffer, hm.Address);
+        expectedHMResponses[hm.DataIndex]++;
+        // all LVDTs are read in the same cycle
+        scheduleRequest(subnet, startIndex, settings.HardpointMonitorLVDTRate, HM_LVDT_BYTES, 0,
+                        &expectedHMResponses[hm.DataIndex]);
+    }
+}
+
+void BusList::scheduleRequest(uint8_t subnet, int32_t startIndex, int32_t divisor, int32_t bytes,
+                              int32_t phase, int32_t* expectedResponses) {
+    int32_t length = buffer.getIndex() - startIndex;
+    size_t words = _requestWords.size();
+    const uint16_t* data = buffer.getBuffer() + startIndex;
+    _requestWords.insert(_requestWords.end(), data, data + length);
+
+    int request = _schedulers[subnet].add(divisor, bytes, phase);
+
+    _scheduledRequests.push_back(
+            ScheduledRequest{subnet, request, startIndex, length, words, expectedResponses, true});
+
+    int32_t budget = ILCApplicationSettings::instance().SubnetByteBudget;
+    int32_t mandatory = _schedulers[subnet].getMandatoryBytes();
+    if (divisor <= 1 && budget > 0 && mandatory > budget && mandatory - bytes <= budget) {
+        SPDLOG_WARN("Requests sent in every cycle on subnet {} transfer {} bytes, over {} bytes budget",
+                    subnet + 1, mandatory, budget);
+    }
+}
+
+void BusList::updateScheduledRequests() {
+    for (auto& scheduler : _schedulers) {
+        scheduler.next();
+    }
+
+    uint16_t* data = buffer.getBuffer();
+    for (auto& request : _scheduledRequests) {
+        bool scheduled = _schedulers[request.subnet].scheduled(request.request);
+        if (scheduled == request.sent) {
+            continue;
+        }
+        if (scheduled) {
+            memcpy(data + request.index, _requestWords.data() + request.words,
+                   request.length * sizeof(uint16_t));
+            (*request.expectedResponses)++;
+        } else {
+            // same length NOP, see ILCMessageFactory::nopReportLVDT
+            memset(data + request.index, 0, request.length * sizeof(uint16_t));
+            (*request.expectedResponses)--;
+        }
+        request.sent = scheduled;
+    }
+}
@@ -24,8 +24,11 @@
 #ifndef BUSLIST_H_
 #define BUSLIST_H_
 
+#include <vector>
+
 #include <ILCDataTypes.h>
 #include <ModbusBuffer.h>
+#include <RequestScheduler.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -51,8 +54,11 @@ class ILCSubnetData;
  * methed. It is then updated at specified parts in update method.
  *
  * Only required data are quieried in every loop. Other queries (e.g.
- * ServerState,..) are distributed, and only ILC subset is updated on every
- * loop. The subset moves in round-robin fashion.
+ * ServerState,..) are scheduled - their rate divisors are configured in
+ * ILCApplicationSettings RequestRates. Scheduled requests are written into
+ * the buffer in buildBuffer, and replaced with NOPs of the same length in
+ * cycles they aren't sent. RequestScheduler keeps bytes transferred on a
+ * subnet within the configured budget.
  */
 class BusList {
 public:
@@ -107,6 +113,85 @@ protected:
      * Ends subnet. Writes IRQ trigger and sets buffer length.
      */
     void endSubnet();
+
+    /**
+     * Writes force actuators status and server status requests. Requests
+     * are scheduled with configured rates.
+     *
+     * @param subnet subnet index
+     */
+    void writeFAStatusRequests(uint8_t subnet);
+
+    /**
+     * Writes hardpoint actuators force and status and server status
+     * requests. Requests are scheduled with configured rates.
+     *
+     * @param subnet subnet index
+     */
+    void writeHPStatusRequests(uint8_t subnet);
+
+    /**
+     * Writes hardpoint monitors pressure, status, server status and LVDT
+     * requests. Requests are scheduled with configured rates.
+     *
+     * @param subnet subnet index
+     */
+    void writeHMRequests(uint8_t subnet);
+
+    /**
+     * Reserves subnet bytes for request sent in every cycle.
+     *
+     * @param subnet subnet index
+     * @param bytes request and expected response bytes
+     */
+    void reserveBytes(uint8_t subnet, int32_t bytes) { _schedulers[subnet].reserve(bytes); }
+
+    /**
+     * Registers request written into the buffer from startIndex to the
+     * current buffer index as scheduled. The request must be already counted
+     * in expected responses.
+     *
+     * @param subnet subnet index
+     * @param startIndex buffer index of the request start
+     * @param divisor request is sent every divisor cycle
+     * @param bytes request and expected response bytes
+     * @param phase request phase, used to spread requests of the same kind
+     * over cycles
+     * @param expectedResponses pointer to ILC expected responses counter
+     */
+    void scheduleRequest(uint8_t subnet, int32_t startIndex, int32_t divisor, int32_t bytes, int32_t phase,
+                         int32_t* expectedResponses);
+
+    /**
+     * Schedules requests for the next cycle. Writes requests scheduled in
+     * the cycle, replaces others with NOPs, and updates expected responses.
+     */
+    void updateScheduledRequests();
+
+    // bytes transferred on the bus by request and its response
+    static constexpr int32_t SERVER_STATUS_BYTES = 4 + 9;
+    static constexpr int32_t SAA_STATUS_BYTES = 4 + 9;
+    static constexpr int32_t DAA_STATUS_BYTES = 4 + 13;
+    static constexpr int32_t HP_FORCE_AND_STATUS_BYTES = 4 + 13;
+    static constexpr int32_t HM_PRESSURE_BYTES = 4 + 20;
+    static constexpr int32_t HM_STATUS_BYTES = 4 + 6;
+    static constexpr int32_t HM_LVDT_BYTES = 4 + 12;
+
+private:
+    struct ScheduledRequest {
+        uint8_t subnet;
+        int request;
+        int32_t index;
+        int32_t length;
+        // offset of saved request words in _requestWords
+        size_t words;
+        int32_t* expectedResponses;
+        bool sent;
+    };
+
+    RequestScheduler _schedulers[5];
+    std::vector<ScheduledRequest> _scheduledRequests;
+    std::vector<uint16_t> _requestWords;
 };
 
 } /* namespace SS */
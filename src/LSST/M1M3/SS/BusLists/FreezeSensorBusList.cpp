@@ -40,11 +40,8 @@ void FreezeSensorBusList::buildBuffer() {
     BusList::buildBuffer();
     SPDLOG_DEBUG("FreezeSensorBusList: buildBuffer()");
 
-    _lvdtSampleClock = 0;
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         _freezeSensorCommandIndex[subnetIndex] = -1;
-        _faStatusCommandIndex[subnetIndex] = -1;
-        _roundRobinFAReportServerStatusIndex[subnetIndex] = 0;
     }
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         this->startSubnet(subnetIndex);
@@ -52,67 +49,19 @@ void FreezeSensorBusList::buildBuffer() {
             _freezeSensorCommandIndex[subnetIndex] = this->buffer.getIndex();
             this->ilcMessageFactory->broadcastPneumaticFreezeSensorValues(&this->buffer,
                                                                           _outerLoopData->broadcastCounter);
+            this->reserveBytes(subnetIndex, 3 + 2);
             this->buffer.writeTimestamp();
-            for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->pneumaticForceStatus(&this->buffer, address);
-                    this->expectedFAResponses[dataIndex] = 1;
-                }
-            }
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            _faStatusCommandIndex[subnetIndex] = this->buffer.getIndex();
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
+            this->writeFAStatusRequests(subnetIndex);
         }
         if (this->subnetData->getHPCount(subnetIndex) > 0) {
             _freezeSensorCommandIndex[subnetIndex] = this->buffer.getIndex();
             this->ilcMessageFactory->broadcastElectromechanicalFreezeSensorValues(
                     &this->buffer, _outerLoopData->broadcastCounter);
+            this->reserveBytes(subnetIndex, 3 + 2);
             this->buffer.writeTimestamp();
-            for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
-                uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-                int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
-                bool disabled = this->subnetData->getHPIndex(subnetIndex, hpIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->electromechanicalForceAndStatus(&this->buffer, address);
-                    this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-                    this->expectedHPResponses[dataIndex] = 2;
-                }
-            }
-        }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->reportDCAPressure(&this->buffer, address);
-                    this->ilcMessageFactory->reportDCAStatus(&this->buffer, address);
-                    this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-                    this->expectedHMResponses[dataIndex] = 3;
-                }
-            }
-        }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            _hmLVDTCommandIndex[subnetIndex] = this->buffer.getIndex();
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                }
-            }
+            this->writeHPStatusRequests(subnetIndex);
         }
+        this->writeHMRequests(subnetIndex);
         this->endSubnet();
     }
     this->buffer.setLength(this->buffer.getIndex());
@@ -121,53 +70,15 @@ void FreezeSensorBusList::buildBuffer() {
 void FreezeSensorBusList::update() {
     _outerLoopData->broadcastCounter = RoundRobin::BroadcastCounter(_outerLoopData->broadcastCounter);
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
-        this->buffer.setIndex(_freezeSensorCommandIndex[subnetIndex]);
         if (this->subnetData->getFACount(subnetIndex) > 0) {
+            this->buffer.setIndex(_freezeSensorCommandIndex[subnetIndex]);
             this->ilcMessageFactory->broadcastPneumaticFreezeSensorValues(&this->buffer,
                                                                           _outerLoopData->broadcastCounter);
         } else if (this->subnetData->getHPCount(subnetIndex) > 0) {
+            this->buffer.setIndex(_freezeSensorCommandIndex[subnetIndex]);
             this->ilcMessageFactory->broadcastElectromechanicalFreezeSensorValues(
                     &this->buffer, _outerLoopData->broadcastCounter);
         }
-        if (this->subnetData->getFACount(subnetIndex) > 0) {
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            this->expectedFAResponses[dataIndex] = 1;
-            _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                    RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-            statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-
-            this->buffer.setIndex(_faStatusCommandIndex[subnetIndex]);
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
-        }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            this->buffer.setIndex(_hmLVDTCommandIndex[subnetIndex]);
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    if (_lvdtSampleClock == 0) {
-                        this->ilcMessageFactory->reportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 4;
-                    } else {
-                        this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 3;
-                    }
-                }
-            }
-            _lvdtSampleClock--;
-            if (_lvdtSampleClock < 0) {
-                _lvdtSampleClock = 4;
-            }
-        }
     }
+    this->updateScheduledRequests();
 }
@@ -42,10 +42,6 @@ private:
     MTM1M3_outerLoopDataC* _outerLoopData;
 
     int32_t _freezeSensorCommandIndex[5];
-    int32_t _faStatusCommandIndex[5];
-    int32_t _roundRobinFAReportServerStatusIndex[5];
-    int32_t _hmLVDTCommandIndex[5];
-    int32_t _lvdtSampleClock;
 };
 
 } /* namespace SS */
@@ -48,12 +48,9 @@ void RaisedBusList::buildBuffer() {
     BusList::buildBuffer();
     SPDLOG_DEBUG("RaisedBusList: buildBuffer()");
 
-    _lvdtSampleClock = 0;
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         _setForceCommandIndex[subnetIndex] = -1;
         _moveStepCommandIndex[subnetIndex] = -1;
-        _faStatusCommandIndex[subnetIndex] = -1;
-        _roundRobinFAReportServerStatusIndex[subnetIndex] = 0;
     }
 
     uint8_t boosterValves = BoosterValveStatus::instance().opened ? 255 : 0;
@@ -69,10 +66,10 @@ void RaisedBusList::buildBuffer() {
             memset(daaPrimary, 0, sizeof(daaPrimary));
             memset(daaSecondary, 0, sizeof(daaSecondary));
             for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t primaryDataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                int32_t secondaryDataIndex =
-                        this->subnetData->getFAIndex(subnetIndex, faIndex).SecondaryDataIndex;
+                const ILCMap& fa = this->subnetData->getFAIndex(subnetIndex, faIndex);
+                uint8_t address = fa.Address;
+                int32_t primaryDataIndex = fa.DataIndex;
+                int32_t secondaryDataIndex = fa.SecondaryDataIndex;
 
                 if (address <= 16) {
                     saaPrimary[address - 1] = _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
@@ -86,34 +83,19 @@ void RaisedBusList::buildBuffer() {
             this->ilcMessageFactory->broadcastForceDemand(&this->buffer, _outerLoopData->broadcastCounter,
                                                           boosterValves, saaPrimary, daaPrimary,
                                                           daaSecondary);
+            _forceDemandPatcher[subnetIndex].attach(&this->buffer, _setForceCommandIndex[subnetIndex],
+                                                    ILCMessageFactory::BROADCAST_FORCE_DEMAND_LENGTH);
+            this->reserveBytes(subnetIndex, ILCMessageFactory::BROADCAST_FORCE_DEMAND_LENGTH + 2);
             this->buffer.writeTimestamp();
-            for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->pneumaticForceStatus(&this->buffer, address);
-                    this->expectedFAResponses[dataIndex] = 1;
-                }
-            }
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            _faStatusCommandIndex[subnetIndex] = this->buffer.getIndex();
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
+            this->writeFAStatusRequests(subnetIndex);
         }
         if (this->subnetData->getHPCount(subnetIndex) > 0) {
             _moveStepCommandIndex[subnetIndex] = this->buffer.getIndex();
             int8_t steps[78];
             for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
-                uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-                int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
+                const ILCMap& hp = this->subnetData->getHPIndex(subnetIndex, hpIndex);
+                uint8_t address = hp.Address;
+                int32_t dataIndex = hp.DataIndex;
                 // Steps are swapped because negative steps extend and positive steps
                 // retract This doesn't match what most people would expect so we are
                 // swapping it
@@ -121,39 +103,11 @@ void RaisedBusList::buildBuffer() {
             }
             this->ilcMessageFactory->broadcastStepMotor(&this->buffer, _outerLoopData->broadcastCounter,
                                                         steps);
+            this->reserveBytes(subnetIndex, 81 + 2);
             this->buffer.writeTimestamp();
-            for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
-                uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-                int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
-                bool disabled = this->subnetData->getHPIndex(subnetIndex, hpIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->electromechanicalForceAndStatus(&this->buffer, address);
-                    this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-                    this->expectedHPResponses[dataIndex] = 2;
-                }
-            }
-        }
-        for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-            uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-            int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-            bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-            if (!disabled) {
-                this->ilcMessageFactory->reportDCAPressure(&this->buffer, address);
-                this->ilcMessageFactory->reportDCAStatus(&this->buffer, address);
-                this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-                this->expectedHMResponses[dataIndex] = 3;
-            }
-        }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            _hmLVDTCommandIndex[subnetIndex] = this->buffer.getIndex();
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                }
-            }
+            this->writeHPStatusRequests(subnetIndex);
         }
+        this->writeHMRequests(subnetIndex);
         this->endSubnet();
     }
     this->buffer.setLength(this->buffer.getIndex());
@@ -173,10 +127,10 @@ void RaisedBusList::update() {
             memset(daaPrimary, 0, sizeof(daaPrimary));
             memset(daaSecondary, 0, sizeof(daaSecondary));
             for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-                uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-                int32_t primaryDataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-                int32_t secondaryDataIndex =
-                        this->subnetData->getFAIndex(subnetIndex, faIndex).SecondaryDataIndex;
+                const ILCMap& fa = this->subnetData->getFAIndex(subnetIndex, faIndex);
+                uint8_t address = fa.Address;
+                int32_t primaryDataIndex = fa.DataIndex;
+                int32_t secondaryDataIndex = fa.SecondaryDataIndex;
 
                 if (address <= 16) {
                     saaPrimary[address - 1] = _appliedCylinderForces->primaryCylinderForces[primaryDataIndex];
@@ -187,34 +141,16 @@ void RaisedBusList::update() {
                             _appliedCylinderForces->secondaryCylinderForces[secondaryDataIndex];
                 }
             }
-            this->buffer.setIndex(_setForceCommandIndex[subnetIndex]);
-            this->ilcMessageFactory->broadcastForceDemand(&this->buffer, _outerLoopData->broadcastCounter,
-                                                          boosterValves, saaPrimary, daaPrimary,
-                                                          daaSecondary);
-
-            int32_t statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-            this->expectedFAResponses[dataIndex] = 1;
-            _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                    RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-            statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            while (this->subnetData->getFAIndex(subnetIndex, statusIndex).Disabled) {
-                _roundRobinFAReportServerStatusIndex[subnetIndex] =
-                        RoundRobin::Inc(statusIndex, this->subnetData->getFACount(subnetIndex));
-                statusIndex = _roundRobinFAReportServerStatusIndex[subnetIndex];
-            }
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, statusIndex).Address;
-            dataIndex = this->subnetData->getFAIndex(subnetIndex, statusIndex).DataIndex;
-
-            this->buffer.setIndex(_faStatusCommandIndex[subnetIndex]);
-            this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
-            this->expectedFAResponses[dataIndex] = 2;
+            ILCMessageFactory::patchBroadcastForceDemand(&_forceDemandPatcher[subnetIndex],
+                                                         _outerLoopData->broadcastCounter, boosterValves,
+                                                         saaPrimary, daaPrimary, daaSecondary);
         }
         if (this->subnetData->getHPCount(subnetIndex) > 0) {
             int8_t steps[78];
             for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
-                uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-                int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
+                const ILCMap& hp = this->subnetData->getHPIndex(subnetIndex, hpIndex);
+                uint8_t address = hp.Address;
+                int32_t dataIndex = hp.DataIndex;
                 // Steps are swapped because negative steps extend and positive steps
                 // retract This doesn't match what most people would expect so we are
                 // swapping it
@@ -224,26 +160,7 @@ void RaisedBusList::update() {
             this->ilcMessageFactory->broadcastStepMotor(&this->buffer, _outerLoopData->broadcastCounter,
                                                         steps);
         }
-        if (this->subnetData->getHMCount(subnetIndex) > 0) {
-            this->buffer.setIndex(_hmLVDTCommandIndex[subnetIndex]);
-            for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-                uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-                int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-                bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
-                if (!disabled) {
-                    if (_lvdtSampleClock == 0) {
-                        this->ilcMessageFactory->reportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 4;
-                    } else {
-                        this->ilcMessageFactory->nopReportLVDT(&this->buffer, address);
-                        this->expectedHMResponses[dataIndex] = 3;
-                    }
-                }
-            }
-            _lvdtSampleClock--;
-            if (_lvdtSampleClock < 0) {
-                _lvdtSampleClock = 4;
-            }
-        }
     }
+
+    this->updateScheduledRequests();
 }
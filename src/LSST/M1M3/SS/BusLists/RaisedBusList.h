@@ -25,6 +25,7 @@
 #define RAISEDBUSLIST_H_
 
 #include <BusList.h>
+#include <ModbusFramePatcher.h>
 #include <SAL_MTM1M3C.h>
 
 namespace LSST {
@@ -44,11 +45,8 @@ private:
     MTM1M3_hardpointActuatorDataC* _hardpointActuatorData;
 
     int32_t _setForceCommandIndex[5];
+    ModbusFramePatcher _forceDemandPatcher[5];
     int32_t _moveStepCommandIndex[5];
-    int32_t _faStatusCommandIndex[5];
-    int32_t _roundRobinFAReportServerStatusIndex[5];
-    int32_t _hmLVDTCommandIndex[5];
-    int32_t _lvdtSampleClock;
 };
 
 } /* namespace SS */
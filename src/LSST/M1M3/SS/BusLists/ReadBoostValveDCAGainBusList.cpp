@@ -41,9 +41,10 @@ void ReadBoostValveDCAGainBusList::buildBuffer() {
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         this->startSubnet(subnetIndex);
         for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-            bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
+            const ILCMap& fa = this->subnetData->getFAIndex(subnetIndex, faIndex);
+            uint8_t address = fa.Address;
+            int32_t dataIndex = fa.DataIndex;
+            bool disabled = fa.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->readBoostValveDCAGains(&this->buffer, address);
                 this->expectedFAResponses[dataIndex] = 1;
@@ -40,18 +40,20 @@ void ReportDCAIDBusList::buildBuffer() {
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         this->startSubnet(subnetIndex);
         for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-            bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
+            const ILCMap& fa = this->subnetData->getFAIndex(subnetIndex, faIndex);
+            uint8_t address = fa.Address;
+            int32_t dataIndex = fa.DataIndex;
+            bool disabled = fa.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportDCAID(&this->buffer, address);
                 this->expectedFAResponses[dataIndex] = 1;
             }
         }
         for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-            uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-            int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-            bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
+            const ILCMap& hm = this->subnetData->getHMIndex(subnetIndex, hmIndex);
+            uint8_t address = hm.Address;
+            int32_t dataIndex = hm.DataIndex;
+            bool disabled = hm.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportDCAID(&this->buffer, address);
                 this->expectedHMResponses[dataIndex] = 1;
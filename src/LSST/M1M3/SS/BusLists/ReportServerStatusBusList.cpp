@@ -41,27 +41,30 @@ void ReportServerStatusBusList::buildBuffer() {
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
         this->startSubnet(subnetIndex);
         for (int faIndex = 0; faIndex < this->subnetData->getFACount(subnetIndex); faIndex++) {
-            uint8_t address = this->subnetData->getFAIndex(subnetIndex, faIndex).Address;
-            int32_t dataIndex = this->subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-            bool disabled = this->subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
+            const ILCMap& fa = this->subnetData->getFAIndex(subnetIndex, faIndex);
+            uint8_t address = fa.Address;
+            int32_t dataIndex = fa.DataIndex;
+            bool disabled = fa.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
                 this->expectedFAResponses[dataIndex] = 1;
             }
         }
         for (int hpIndex = 0; hpIndex < this->subnetData->getHPCount(subnetIndex); hpIndex++) {
-            uint8_t address = this->subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-            int32_t dataIndex = this->subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
-            bool disabled = this->subnetData->getHPIndex(subnetIndex, hpIndex).Disabled;
+            const ILCMap& hp = this->subnetData->getHPIndex(subnetIndex, hpIndex);
+            uint8_t address = hp.Address;
+            int32_t dataIndex = hp.DataIndex;
+            bool disabled = hp.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
                 this->expectedHPResponses[dataIndex] = 1;
             }
         }
         for (int hmIndex = 0; hmIndex < this->subnetData->getHMCount(subnetIndex); hmIndex++) {
-            uint8_t address = this->subnetData->getHMIndex(subnetIndex, hmIndex).Address;
-            int32_t dataIndex = this->subnetData->getHMIndex(subnetIndex, hmIndex).DataIndex;
-            bool disabled = this->subnetData->getHMIndex(subnetIndex, hmIndex).Disabled;
+            const ILCMap& hm = this->subnetData->getHMIndex(subnetIndex, hmIndex);
+            uint8_t address = hm.Address;
+            int32_t dataIndex = hm.DataIndex;
+            bool disabled = hm.Disabled;
             if (!disabled) {
                 this->ilcMessageFactory->reportServerStatus(&this->buffer, address);
                 this->expectedHMResponses[dataIndex] = 1;
@@ -0,0 +1,100 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <RequestScheduler.h>
+
+using namespace LSST::M1M3::SS;
+
+RequestScheduler::RequestScheduler() { clear(0); }
+
+void RequestScheduler::clear(int32_t budget) {
+    _requests.clear();
+    _budget = budget;
+    _reserved = 0;
+    _bytes = 0;
+    _rotation = 0;
+}
+
+int RequestScheduler::add(int32_t divisor, int32_t bytes, int32_t phase) {
+    if (divisor < 1) {
+        divisor = 1;
+    }
+    _requests.push_back(Request{divisor, bytes, phase % divisor, false});
+    return _requests.size() - 1;
+}
+
+void RequestScheduler::next() {
+    _bytes = _reserved;
+
+    for (auto& request : _requests) {
+        request.scheduled = false;
+        if (request.divisor == 1) {
+            request.scheduled = true;
+            _bytes += request.bytes;
+        }
+    }
+
+    size_t count = _requests.size();
+    if (count == 0) {
+        return;
+    }
+
+    // overdue requests first, starting at rotating index
+    for (size_t i = 0; i < count; i++) {
+        auto& request = _requests[(_rotation + i) % count];
+        if (request.scheduled == false && request.wait < 0 && _fits(request)) {
+            request.scheduled = true;
+            request.wait = request.divisor;
+            _bytes += request.bytes;
+        }
+    }
+    _rotation = (_rotation + 1) % count;
+
+    for (auto& request : _requests) {
+        if (request.scheduled == false && request.wait == 0 && _fits(request)) {
+            request.scheduled = true;
+            request.wait = request.divisor;
+            _bytes += request.bytes;
+        }
+    }
+
+    for (auto& request : _requests) {
+        if (request.divisor > 1) {
+            request.wait--;
+        }
+    }
+}
+
+int32_t RequestScheduler::getMandatoryBytes() const {
+    int32_t bytes = _reserved;
+    for (auto& request : _requests) {
+        if (request.divisor == 1) {
+            bytes += request.bytes;
+        }
+    }
+    return bytes;
+}
+
+bool RequestScheduler::_fits(const Request& request) const {
+    return _budget <= 0 || _bytes + request.bytes <= _budget;
+}
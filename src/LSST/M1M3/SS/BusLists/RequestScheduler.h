@@ -0,0 +1,123 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef REQUESTSCHEDULER_H_
+#define REQUESTSCHEDULER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Schedules ILC requests on a subnet. Each request has rate divisor - it
+ * shall be sent every divisor cycle. Requests with divisor 1 are sent in
+ * every cycle. Other requests are sent only if the bytes transferred on the
+ * subnet in the cycle (requests and expected responses) stay within the
+ * budget. Requests which don't fit are postponed, and have priority in the
+ * following cycles. The first overdue request considered rotates with
+ * cycles, so no request is starved.
+ *
+ * Requests are added when bus list is build, next is called in every cycle.
+ * Scheduling doesn't allocate memory.
+ */
+class RequestScheduler {
+public:
+    RequestScheduler();
+
+    /**
+     * Removes all requests.
+     *
+     * @param budget maximal number of bytes transferred in a cycle. 0 for
+     * unlimited
+     */
+    void clear(int32_t budget);
+
+    /**
+     * Accounts bytes of requests which are always sent and aren't scheduled.
+     *
+     * @param bytes request and expected response bytes
+     */
+    void reserve(int32_t bytes) { _reserved += bytes; }
+
+    /**
+     * Adds request.
+     *
+     * @param divisor request is sent every divisor cycle
+     * @param bytes request and expected response bytes
+     * @param phase request is first sent in the phase % divisor cycle.
+     * Allows to spread requests of the same kind over cycles
+     *
+     * @return request index
+     */
+    int add(int32_t divisor, int32_t bytes, int32_t phase);
+
+    /**
+     * Schedules requests for the next cycle.
+     */
+    void next();
+
+    /**
+     * Returns true if request is scheduled in the current cycle.
+     *
+     * @param index request index, as returned from add
+     */
+    bool scheduled(int index) const { return _requests[index].scheduled; }
+
+    /**
+     * Returns bytes transferred in the current cycle, including reserved
+     * bytes.
+     */
+    int32_t getBytes() const { return _bytes; }
+
+    /**
+     * Returns bytes transferred in cycle by requests which are always sent.
+     */
+    int32_t getMandatoryBytes() const;
+
+private:
+    struct Request {
+        int32_t divisor;
+        int32_t bytes;
+        // cycles till the request is due. Negative when overdue
+        int32_t wait;
+        bool scheduled;
+    };
+
+    bool _fits(const Request& request) const;
+
+    std::vector<Request> _requests;
+    int32_t _budget;
+    int32_t _reserved;
+    int32_t _bytes;
+    size_t _rotation;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* REQUESTSCHEDULER_H_ */
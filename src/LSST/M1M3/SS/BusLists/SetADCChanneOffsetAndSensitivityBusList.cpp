@@ -44,9 +44,10 @@ void SetADCChanneOffsetAndSensitivityBusList::buildBuffer() {
     for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; ++subnetIndex) {
         startSubnet(subnetIndex);
         for (int faIndex = 0; faIndex < subnetData->getFACount(subnetIndex); ++faIndex) {
-            uint8_t address = subnetData->getFAIndex(subnetIndex, faIndex).Address;
-            int32_t dataIndex = subnetData->getFAIndex(subnetIndex, faIndex).DataIndex;
-            bool disabled = subnetData->getFAIndex(subnetIndex, faIndex).Disabled;
+            const ILCMap& fa = subnetData->getFAIndex(subnetIndex, faIndex);
+            uint8_t address = fa.Address;
+            int32_t dataIndex = fa.DataIndex;
+            bool disabled = fa.Disabled;
             if (!disabled) {
                 ilcMessageFactory->setADCChannelOffsetAndSensitivity(&buffer, address, 1, 0, 0);
                 ilcMessageFactory->setADCChannelOffsetAndSensitivity(&buffer, address, 2, 0, 0);
@@ -54,9 +55,10 @@ void SetADCChanneOffsetAndSensitivityBusList::buildBuffer() {
             }
         }
         for (int hpIndex = 0; hpIndex < subnetData->getHPCount(subnetIndex); ++hpIndex) {
-            uint8_t address = subnetData->getHPIndex(subnetIndex, hpIndex).Address;
-            int32_t dataIndex = subnetData->getHPIndex(subnetIndex, hpIndex).DataIndex;
-            bool disabled = subnetData->getHPIndex(subnetIndex, hpIndex).Disabled;
+            const ILCMap& hp = subnetData->getHPIndex(subnetIndex, hpIndex);
+            uint8_t address = hp.Address;
+            int32_t dataIndex = hp.DataIndex;
+            bool disabled = hp.Disabled;
             if (!disabled) {
                 ilcMessageFactory->setADCChannelOffsetAndSensitivity(&buffer, address, 1, 0, 0);
                 expectedHPResponses[dataIndex] = 1;
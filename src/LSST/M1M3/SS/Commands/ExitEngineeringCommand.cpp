@@ -29,6 +29,7 @@
 #include <ExitEngineeringCommand.h>
 #include <ForceActuatorBumpTestStatus.h>
 #include <M1M3SSPublisher.h>
+#include <Model.h>
 
 using namespace LSST::cRIO::SAL;
 using namespace LSST::M1M3::SS;
@@ -42,6 +43,11 @@ bool ExitEngineeringCommand::validate() {
                 "Cannot exit engineering mode as bump test for actuator(s) is in progress.");
         return false;
     }
+    if (Model::instance().getBumpTestController()->mirrorBumpTestInProgress()) {
+        M1M3SSPublisher::instance().logCommandRejectionWarning(
+                "ExitEngineering", "Cannot exit engineering mode as mirror bump test is in progress.");
+        return false;
+    }
     return Command::validate();
 }
 
@@ -34,11 +34,35 @@ using namespace LSST::M1M3::SS;
 
 ForceActuatorBumpTestCommand::ForceActuatorBumpTestCommand(int32_t commandID,
                                                            MTM1M3_command_forceActuatorBumpTestC* data)
-        : Command(commandID), index(0), cylinders(0) {
+        : Command(commandID), index(0), cylinders(0), mirror(false) {
     memcpy(&_data, data, sizeof(MTM1M3_command_forceActuatorBumpTestC));
 }
 
 bool ForceActuatorBumpTestCommand::validate() {
+    if (_data.actuatorId == 0) {
+        if (_data.testPrimary == false && _data.testSecondary == false) {
+            M1M3SSPublisher::instance().logCommandRejectionWarning(
+                    "ForceActuatorBumpTest",
+                    "Cannot start mirror bump test - neither primary nor secondary test selected.");
+            return false;
+        }
+        if (Model::instance().getBumpTestController()->mirrorBumpTestInProgress()) {
+            M1M3SSPublisher::instance().logCommandRejectionWarning(
+                    "ForceActuatorBumpTest",
+                    "Cannot start mirror bump test - another mirror bump test is in progress.");
+            return false;
+        }
+        if (ForceActuatorBumpTestStatus::instance().test_in_progress()) {
+            M1M3SSPublisher::instance().logCommandRejectionWarning(
+                    "ForceActuatorBumpTest", "Cannot start mirror bump test - another bump test is running.");
+            return false;
+        }
+        mirror = true;
+        cylinders = false;
+        index = -1;
+        return true;
+    }
+
     if (_data.actuatorId < 0) {
         _data.actuatorId *= -1;
         cylinders = true;
@@ -33,7 +33,10 @@ namespace M1M3 {
 namespace SS {
 
 /**
- * Command to start bump testing of force actuator.
+ * Command to start bump testing of force actuator. Negative actuator ID
+ * requests cylinder test. Actuator ID 0 requests test of all enabled force
+ * actuators, scheduled by BumpTestController to run as many tests in parallel
+ * as possible.
  *
  * @see BumpTestController
  */
@@ -43,12 +46,14 @@ public:
 
     int index;
     bool cylinders;
+    bool mirror;
 
     MTM1M3_command_forceActuatorBumpTestC* getData() { return &_data; }
 
     /**
      * Validates command parameters. Return false if actuator ID is invalid, or
-     * another bump test is running.
+     * another bump test is running. Mirror bump test is rejected if no axis is
+     * selected, or if another mirror bump test is in progress.
      */
     bool validate() override;
     void execute() override;
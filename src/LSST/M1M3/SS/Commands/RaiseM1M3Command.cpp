@@ -28,6 +28,7 @@
 #include <Context.h>
 #include <ForceActuatorBumpTestStatus.h>
 #include <M1M3SSPublisher.h>
+#include <Model.h>
 #include <RaiseM1M3Command.h>
 
 using namespace LSST::cRIO::SAL;
@@ -43,6 +44,11 @@ bool RaiseM1M3Command::validate() {
                 "RaiseM1M3", "Cannot raise M1M3 as bump test for actuator(s) is in progress.");
         return false;
     }
+    if (Model::instance().getBumpTestController()->mirrorBumpTestInProgress()) {
+        M1M3SSPublisher::instance().logCommandRejectionWarning(
+                "RaiseM1M3", "Cannot raise M1M3 as mirror bump test is in progress.");
+        return false;
+    }
     return Command::validate();
 }
 
@@ -35,327 +35,299 @@ namespace SS {
 Context::Context(token) {
     SPDLOG_DEBUG("Context: Context()");
     _currentState = States::OfflineState;
+    _currentStateObject = StaticStateFactory::get().create(_currentState);
+    _stateEntered = std::chrono::steady_clock::now();
+    _lastStateDuration = std::chrono::nanoseconds::zero();
 }
 
 void Context::enterControl(EnterControlCommand* command) {
     SPDLOG_DEBUG("Context: enterControl()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enterControl(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enterControl(command));
 }
 
 void Context::start(StartCommand* command) {
     SPDLOG_DEBUG("Context: start()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->start(command));
+    _updateCurrentStateIfRequired(_currentStateObject->start(command));
 }
 
 void Context::enable(EnableCommand* command) {
     SPDLOG_DEBUG("Context: enable()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enable(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enable(command));
 }
 
 void Context::disable(DisableCommand* command) {
     SPDLOG_DEBUG("Context: disable()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->disable(command));
+    _updateCurrentStateIfRequired(_currentStateObject->disable(command));
 }
 
 void Context::standby(StandbyCommand* command) {
     SPDLOG_DEBUG("Context: standby()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->standby(command));
+    _updateCurrentStateIfRequired(_currentStateObject->standby(command));
 }
 
 void Context::exitControl(ExitControlCommand* command) {
     SPDLOG_DEBUG("Context: exitControl()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->exitControl(command));
+    _updateCurrentStateIfRequired(_currentStateObject->exitControl(command));
 }
 
 void Context::update(UpdateCommand* command) {
     SPDLOG_TRACE("Context: update()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->update(command));
+    _updateCurrentStateIfRequired(_currentStateObject->update(command));
 }
 
 void Context::setSlewFlag(SetSlewFlagCommand* command) {
     SPDLOG_DEBUG("Context: setSlewFlag()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->setSlewFlag(command));
+    _updateCurrentStateIfRequired(_currentStateObject->setSlewFlag(command));
 }
 
 void Context::clearSlewFlag(ClearSlewFlagCommand* command) {
     SPDLOG_DEBUG("Context: clearSlewFlag()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->clearSlewFlag(command));
+    _updateCurrentStateIfRequired(_currentStateObject->clearSlewFlag(command));
 }
 
 void Context::turnAirOn(TurnAirOnCommand* command) {
     SPDLOG_DEBUG("Context: turnAirOn()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnAirOn(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnAirOn(command));
 }
 
 void Context::turnAirOff(TurnAirOffCommand* command) {
     SPDLOG_DEBUG("Context: turnAirOff()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnAirOff(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnAirOff(command));
 }
 
 void Context::applyOffsetForces(ApplyOffsetForcesCommand* command) {
     SPDLOG_DEBUG("Context: applyOffsetForces()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->applyOffsetForces(command));
+    _updateCurrentStateIfRequired(_currentStateObject->applyOffsetForces(command));
 }
 
 void Context::clearOffsetForces(ClearOffsetForcesCommand* command) {
     SPDLOG_DEBUG("Context: clearOffsetForces()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->clearOffsetForces(command));
+    _updateCurrentStateIfRequired(_currentStateObject->clearOffsetForces(command));
 }
 
 void Context::raiseM1M3(RaiseM1M3Command* command) {
     SPDLOG_DEBUG("Context: raiseM1M3()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->raiseM1M3(command));
+    _updateCurrentStateIfRequired(_currentStateObject->raiseM1M3(command));
 }
 
 void Context::lowerM1M3(LowerM1M3Command* command) {
     SPDLOG_DEBUG("Context: lowerM1M3()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->lowerM1M3(command));
+    _updateCurrentStateIfRequired(_currentStateObject->lowerM1M3(command));
 }
 
 void Context::pauseM1M3RaisingLowering(PauseM1M3RaisingLoweringCommand* command) {
     SPDLOG_DEBUG("Context: pauseM1M3RaisingLowering()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->pauseM1M3RaisingLowering(command));
+    _updateCurrentStateIfRequired(_currentStateObject->pauseM1M3RaisingLowering(command));
 }
 
 void Context::resumeM1M3RaisingLowering(ResumeM1M3RaisingLoweringCommand* command) {
     SPDLOG_DEBUG("Context: resumeRaisingLowering()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->resumeM1M3RaisingLowering(command));
+    _updateCurrentStateIfRequired(_currentStateObject->resumeM1M3RaisingLowering(command));
 }
 
 void Context::applyActiveOpticForces(ApplyActiveOpticForcesCommand* command) {
     SPDLOG_DEBUG("Context: applyActiveOpticForces()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->applyActiveOpticForces(command));
+    _updateCurrentStateIfRequired(_currentStateObject->applyActiveOpticForces(command));
 }
 
 void Context::clearActiveOpticForces(ClearActiveOpticForcesCommand* command) {
     SPDLOG_DEBUG("Context: clearActiveOpticForces()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->clearActiveOpticForces(command));
+    _updateCurrentStateIfRequired(_currentStateObject->clearActiveOpticForces(command));
 }
 
 void Context::enterEngineering(EnterEngineeringCommand* command) {
     SPDLOG_DEBUG("Context: enterEngineering()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enterEngineering(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enterEngineering(command));
 }
 
 void Context::exitEngineering(ExitEngineeringCommand* command) {
     SPDLOG_DEBUG("Context: exitEngineering()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->exitEngineering(command));
+    _updateCurrentStateIfRequired(_currentStateObject->exitEngineering(command));
 }
 
 void Context::boosterValveOpen(BoosterValveOpenCommand* command) {
     SPDLOG_DEBUG("Context: boosterValveOpen()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->boosterValveOpen(command));
+    _updateCurrentStateIfRequired(_currentStateObject->boosterValveOpen(command));
 }
 
 void Context::boosterValveClose(BoosterValveCloseCommand* command) {
     SPDLOG_DEBUG("Context: boosterValveClose()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->boosterValveClose(command));
+    _updateCurrentStateIfRequired(_currentStateObject->boosterValveClose(command));
 }
 
 void Context::testHardpoint(TestHardpointCommand* command) {
     SPDLOG_DEBUG("Context: testHardpoint()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->testHardpoint(command));
+    _updateCurrentStateIfRequired(_currentStateObject->testHardpoint(command));
 }
 
 void Context::killHardpointTest(KillHardpointTestCommand* command) {
     SPDLOG_DEBUG("Context: killHardpointTest()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->killHardpointTest(command));
+    _updateCurrentStateIfRequired(_currentStateObject->killHardpointTest(command));
 }
 
 void Context::moveHardpointActuators(MoveHardpointActuatorsCommand* command) {
     SPDLOG_DEBUG("Context: moveHardpointActuators()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->moveHardpointActuators(command));
+    _updateCurrentStateIfRequired(_currentStateObject->moveHardpointActuators(command));
 }
 
 void Context::enableHardpointChase(EnableHardpointChaseCommand* command) {
     SPDLOG_DEBUG("Context: enableHardpointChase()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enableHardpointChase(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enableHardpointChase(command));
 }
 
 void Context::disableHardpointChase(DisableHardpointChaseCommand* command) {
     SPDLOG_DEBUG("Context: disableHardpointChase()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->disableHardpointChase(command));
+    _updateCurrentStateIfRequired(_currentStateObject->disableHardpointChase(command));
 }
 
 void Context::abortRaiseM1M3(AbortRaiseM1M3Command* command) {
     SPDLOG_DEBUG("Context: abortRaiseM1M3()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->abortRaiseM1M3(command));
+    _updateCurrentStateIfRequired(_currentStateObject->abortRaiseM1M3(command));
 }
 
 void Context::translateM1M3(TranslateM1M3Command* command) {
     SPDLOG_DEBUG("Context: translateM1M3()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->translateM1M3(command));
+    _updateCurrentStateIfRequired(_currentStateObject->translateM1M3(command));
 }
 
 void Context::stopHardpointMotion(StopHardpointMotionCommand* command) {
     SPDLOG_DEBUG("Context: stopHardpointMotion()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->stopHardpointMotion(command));
+    _updateCurrentStateIfRequired(_currentStateObject->stopHardpointMotion(command));
 }
 
 void Context::storeTMAAzimuthSample(TMAAzimuthSampleCommand* command) {
     SPDLOG_DEBUG("Context: storeTMAAzimuthSample()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->storeTMAAzimuthSample(command));
+    _updateCurrentStateIfRequired(_currentStateObject->storeTMAAzimuthSample(command));
 }
 
 void Context::storeTMAElevationSample(TMAElevationSampleCommand* command) {
     SPDLOG_DEBUG("Context: storeTMAElevationSample()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->storeTMAElevationSample(command));
+    _updateCurrentStateIfRequired(_currentStateObject->storeTMAElevationSample(command));
 }
 
 void Context::positionM1M3(PositionM1M3Command* command) {
     SPDLOG_DEBUG("Context: positionM1M3()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->positionM1M3(command));
+    _updateCurrentStateIfRequired(_currentStateObject->positionM1M3(command));
 }
 
 void Context::turnLightsOn(TurnLightsOnCommand* command) {
     SPDLOG_DEBUG("Context: turnLightsOn()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnLightsOn(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnLightsOn(command));
 }
 
 void Context::turnLightsOff(TurnLightsOffCommand* command) {
     SPDLOG_DEBUG("Context: turnLightsOff()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnLightsOff(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnLightsOff(command));
 }
 
 void Context::turnPowerOn(TurnPowerOnCommand* command) {
     SPDLOG_DEBUG("Context: turnPowerOn()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnPowerOn(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnPowerOn(command));
 }
 
 void Context::turnPowerOff(TurnPowerOffCommand* command) {
     SPDLOG_DEBUG("Context: turnPowerOff()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->turnPowerOff(command));
+    _updateCurrentStateIfRequired(_currentStateObject->turnPowerOff(command));
 }
 
 void Context::enableHardpointCorrections(EnableHardpointCorrectionsCommand* command) {
     SPDLOG_DEBUG("Context: enableHardpointCorrections()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enableHardpointCorrections(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enableHardpointCorrections(command));
 }
 
 void Context::disableHardpointCorrections(DisableHardpointCorrectionsCommand* command) {
     SPDLOG_DEBUG("Context: disableHardpointCorrections()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->disableHardpointCorrections(command));
+    _updateCurrentStateIfRequired(_currentStateObject->disableHardpointCorrections(command));
 }
 
 void Context::runMirrorForceProfile(RunMirrorForceProfileCommand* command) {
     SPDLOG_DEBUG("Context: runMirrorForceProfile()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->runMirrorForceProfile(command));
+    _updateCurrentStateIfRequired(_currentStateObject->runMirrorForceProfile(command));
 }
 
 void Context::abortProfile(AbortProfileCommand* command) {
     SPDLOG_DEBUG("Context: abortProfile()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->abortProfile(command));
+    _updateCurrentStateIfRequired(_currentStateObject->abortProfile(command));
 }
 
 void Context::applyOffsetForcesByMirrorForce(ApplyOffsetForcesByMirrorForceCommand* command) {
     SPDLOG_DEBUG("Context: applyOffsetForcesByMirrorForce()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->applyOffsetForcesByMirrorForce(command));
+    _updateCurrentStateIfRequired(_currentStateObject->applyOffsetForcesByMirrorForce(command));
 }
 
 void Context::updatePID(UpdatePIDCommand* command) {
     SPDLOG_DEBUG("Context: updatePID()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->updatePID(command));
+    _updateCurrentStateIfRequired(_currentStateObject->updatePID(command));
 }
 
 void Context::resetPID(ResetPIDCommand* command) {
     SPDLOG_DEBUG("Context: resetPID()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->resetPID(command));
+    _updateCurrentStateIfRequired(_currentStateObject->resetPID(command));
 }
 
 void Context::forceActuatorBumpTest(ForceActuatorBumpTestCommand* command) {
     SPDLOG_DEBUG("Context: forceActuatorBumpTest()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->forceActuatorBumpTest(command));
+    _updateCurrentStateIfRequired(_currentStateObject->forceActuatorBumpTest(command));
 }
 
 void Context::killForceActuatorBumpTest(KillForceActuatorBumpTestCommand* command) {
     SPDLOG_DEBUG("Context: killForceActuatorBumpTest()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->killForceActuatorBumpTest(command));
+    _updateCurrentStateIfRequired(_currentStateObject->killForceActuatorBumpTest(command));
 }
 
 void Context::disableForceActuator(DisableForceActuatorCommand* command) {
     SPDLOG_DEBUG("Context: disableForceActuator({})", command->actuatorIndex);
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->disableForceActuator(command));
+    _updateCurrentStateIfRequired(_currentStateObject->disableForceActuator(command));
 }
 
 void Context::enableForceActuator(EnableForceActuatorCommand* command) {
     SPDLOG_DEBUG("Context: enableForceActuator({})", command->actuatorIndex);
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enableForceActuator(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enableForceActuator(command));
 }
 
 void Context::enableAllForceActuators(EnableAllForceActuatorsCommand* command) {
     SPDLOG_DEBUG("Context: enableAllForceActuators()");
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enableAllForceActuators(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enableAllForceActuators(command));
 }
 
 void Context::enableDisableForceComponent(EnableDisableForceComponentCommand* command) {
     SPDLOG_DEBUG("Context: enableDisableForceComponent({} {})", command->getData()->forceComponent,
                  command->getData()->enable);
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->enableDisableForceComponent(command));
+    _updateCurrentStateIfRequired(_currentStateObject->enableDisableForceComponent(command));
 }
 
 void Context::setSlewControllerSettings(SetSlewControllerSettingsCommand* command) {
     SPDLOG_DEBUG("Context: slewControllerSettings({} {})", command->getData()->slewSettings,
                  command->getData()->enableSlewManagement);
-    State* state = StaticStateFactory::get().create(_currentState);
-    _updateCurrentStateIfRequired(state->setSlewControllerSettings(command));
+    _updateCurrentStateIfRequired(_currentStateObject->setSlewControllerSettings(command));
 }
 
 void Context::_updateCurrentStateIfRequired(States::Type potentialNewState) {
-    if (potentialNewState != States::NoStateTransition) {
-        _currentState = potentialNewState;
-        Model::instance().publishStateChange(potentialNewState);
+    if (potentialNewState == States::NoStateTransition) {
+        return;
     }
+
+    State* newStateObject = StaticStateFactory::get().create(potentialNewState);
+    if (newStateObject == nullptr) {
+        SPDLOG_ERROR("Context: ignoring transition from {} to unknown state {:#x}",
+                     _currentStateObject->getName(), static_cast<uint64_t>(potentialNewState));
+        return;
+    }
+    if (StaticStateFactory::isLegalTransition(_currentState, potentialNewState) == false) {
+        SPDLOG_WARN("Context: unexpected transition from {} to {}", _currentStateObject->getName(),
+                    newStateObject->getName());
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    _lastStateDuration = now - _stateEntered;
+    _stateEntered = now;
+
+    SPDLOG_INFO("Context: {} -> {} after {:.3f} s", _currentStateObject->getName(), newStateObject->getName(),
+                std::chrono::duration<double>(_lastStateDuration).count());
+
+    _currentState = potentialNewState;
+    _currentStateObject = newStateObject;
+    Model::instance().publishStateChange(potentialNewState);
 }
 
 } /* namespace SS */
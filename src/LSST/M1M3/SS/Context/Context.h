@@ -24,6 +24,8 @@
 #ifndef CONTEXT_H_
 #define CONTEXT_H_
 
+#include <chrono>
+
 #include <cRIO/Singleton.h>
 
 #include <AbortProfileCommand.h>
@@ -169,12 +171,39 @@ public:
         return _currentState == States::Type::StandbyState || _currentState == States::Type::DisabledState;
     }
 
+    States::Type getCurrentState() { return _currentState; }
+
+    /**
+     * Returns object handling commands in the current state.
+     */
+    State* getCurrentStateObject() { return _currentStateObject; }
+
+    /**
+     * Returns time spent in the state left by the last transition.
+     */
+    std::chrono::nanoseconds getLastStateDuration() { return _lastStateDuration; }
+
 private:
+    friend class ContextTest;
+
     Context& operator=(const Context&) = delete;
     Context(const Context&) = delete;
 
     States::Type _currentState;
+    State* _currentStateObject;
+
+    std::chrono::steady_clock::time_point _stateEntered;
+    std::chrono::nanoseconds _lastStateDuration;
 
+    /**
+     * Switch to a new state, if potentialNewState isn't
+     * States::NoStateTransition. Called with value returned from the current
+     * state command handlers. State object is looked up only here, command
+     * dispatch uses cached pointer. Logs time spent in the previous state and
+     * publishes summary and detailed state change.
+     *
+     * @param potentialNewState new state or States::NoStateTransition
+     */
     void _updateCurrentStateIfRequired(States::Type potentialNewState);
 };
 
@@ -82,10 +82,43 @@ int BumpTestController::setBumpTestActuator(int actuator_id, bool cylinders, boo
     return 0;
 }
 
+float BumpTestController::planMirrorBumpTest(bool test_primary, bool test_secondary) {
+    auto& fa_settings = ForceActuatorSettings::instance();
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+    auto ilc = Model::instance().getILC();
+
+    std::vector<int> z_indices;
+    for (int z_index = 0; z_index < FA_COUNT; z_index++) {
+        if (ilc->isDisabled(faa_settings.ZIndexToActuatorId(z_index)) == false) {
+            z_indices.push_back(z_index);
+        }
+    }
+
+    _scheduler.plan(z_indices, test_primary, test_secondary, fa_settings.bumpTestMinimalDistance,
+                    fa_settings.bumpTestExpectedStageTime, fa_settings.bumpTestSettleTime,
+                    fa_settings.bumpTestRetries);
+    _campaign_start = steady_clock::now();
+
+    SPDLOG_INFO("Planned bump test of {} FAs - {} tests, up to {} in parallel, expected duration {:.0f}s",
+                z_indices.size(), _scheduler.get_plan().size(), _scheduler.max_concurrency(),
+                _scheduler.expected_duration());
+
+    for (auto& task : _scheduler.get_plan()) {
+        SPDLOG_DEBUG("Bump test plan: FA ID {} {} {:.1f}s - {:.1f}s",
+                     faa_settings.ZIndexToActuatorId(task.z_index), task.primary ? "primary" : "secondary",
+                     task.start, task.end);
+    }
+
+    return _scheduler.expected_duration();
+}
+
 void BumpTestController::runLoop() {
     if (_bump_test_data == NULL) {
         _bump_test_data = new FABumpTestData(ForceActuatorSettings::instance().bumpTestMeasurements);
     }
+
+    _run_scheduled();
+
     // force actuator data are updated only in UpdateCommand; as only a single
     // command can be executed, there isn't a race condition
     size_t tested_count = 0;
@@ -183,6 +216,8 @@ void BumpTestController::runLoop() {
 void BumpTestController::stopAll(bool forced) {
     ForceActuatorBumpTestStatus::instance().stop_all();
 
+    _scheduler.clear();
+
     _reset_progress();
 
     delete _bump_test_data;
@@ -541,3 +576,47 @@ void BumpTestController::_collect_results() {
     _bump_test_data->add_data(fa_data.xForce, fa_data.yForce, fa_data.zForce, fa_data.primaryCylinderForce,
                               fa_data.secondaryCylinderForce, fa_status.primaryTest, fa_status.secondaryTest);
 }
+
+void BumpTestController::_run_scheduled() {
+    if (_scheduler.empty()) {
+        return;
+    }
+
+    auto& actuator_status = ForceActuatorBumpTestStatus::instance();
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    float now = duration<float>(steady_clock::now() - _campaign_start).count();
+
+    // finished modifies scheduler running list
+    auto running = _scheduler.running();
+    for (auto& task : running) {
+        int s_index = faa_settings.ZIndexToSecondaryCylinderIndex[task.z_index];
+        int state = task.primary ? actuator_status.primaryTest[task.z_index]
+                                 : actuator_status.secondaryTest[s_index];
+        if (ForceActuatorBumpTestStatus::is_tested(state) == false) {
+            _scheduler.finished(task.z_index, task.primary, state != MTM1M3_shared_BumpTest_Passed, now);
+        }
+    }
+
+    auto min_distance = ForceActuatorSettings::instance().bumpTestMinimalDistance;
+
+    auto can_start = [&](int z_index) {
+        int s_index = faa_settings.ZIndexToSecondaryCylinderIndex[z_index];
+        if (actuator_status.primary_tested(z_index) ||
+            (s_index >= 0 && actuator_status.secondary_tested(s_index))) {
+            return false;
+        }
+        int min_actuator_id;
+        return actuator_status.minimal_tested_distance(z_index, min_actuator_id) > min_distance;
+    };
+
+    BumpTestTask task;
+    while (_scheduler.next(now, can_start, task)) {
+        setBumpTestActuator(faa_settings.ZIndexToActuatorId(task.z_index), false, task.primary,
+                            task.primary == false);
+    }
+
+    if (_scheduler.empty()) {
+        SPDLOG_INFO("Mirror bump test finished in {:.0f}s, {} tests failed", now, _scheduler.failed_count());
+    }
+}
@@ -28,6 +28,7 @@
 
 #include <cRIO/DataTypes.h>
 
+#include "BumpTestScheduler.h"
 #include "FABumpTestData.h"
 
 namespace LSST {
@@ -57,6 +58,34 @@ public:
      */
     int setBumpTestActuator(int actuator_id, bool cylinders, bool test_primary, bool test_secondary);
 
+    /**
+     * Plans bump test of all enabled force actuators. Tests are started from
+     * runLoop, as many in parallel as allowed by the minimal distance. The plan
+     * is logged, and can be retrieved with getScheduler before the first test
+     * starts.
+     *
+     * @param test_primary test primary (Z) axis
+     * @param test_secondary test secondary (X or Y) axis
+     *
+     * @return expected campaign duration in seconds
+     */
+    float planMirrorBumpTest(bool test_primary, bool test_secondary);
+
+    /**
+     * Returns scheduler used for full mirror bump tests.
+     */
+    const BumpTestScheduler& getScheduler() { return _scheduler; }
+
+    /**
+     * Returns true if full mirror bump test is in progress - some of its
+     * tests are running or waiting to be started. Tests aren't running
+     * between scheduled tests, so ForceActuatorBumpTestStatus::test_in_progress
+     * alone doesn't cover the campaign.
+     *
+     * @return true if full mirror bump test is in progress
+     */
+    bool mirrorBumpTestInProgress() { return _scheduler.empty() == false; }
+
     /**
      * Run single loop. Shall be called from update command after telemetry
      * data are queried and send.
@@ -94,6 +123,9 @@ private:
 
     FABumpTestData* _bump_test_data;
 
+    BumpTestScheduler _scheduler;
+    std::chrono::time_point<std::chrono::steady_clock> _campaign_start;
+
     /**
      * Called after statistics was collected. Report back interesting (above warning/error level) values.
      *
@@ -131,6 +163,11 @@ private:
      */
     void _collect_results();
 
+    /**
+     * Reports finished scheduled tests to the scheduler and starts new tests.
+     */
+    void _run_scheduled();
+
     int _final_primary_states[FA_COUNT];
     int _final_secondary_states[FA_S_COUNT];
 };
@@ -0,0 +1,198 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <spdlog/spdlog.h>
+
+#include "BumpTestScheduler.h"
+#include "ForceActuatorApplicationSettings.h"
+
+using namespace LSST::M1M3::SS;
+
+// number of stages performed during a single axis test - see BumpTestController::_run_axis
+constexpr int BUMP_TEST_STAGES = 5;
+
+BumpTestScheduler::BumpTestScheduler() { clear(); }
+
+void BumpTestScheduler::plan(const std::vector<int>& z_indices, bool test_primary, bool test_secondary,
+                             float minimal_distance, float expected_stage_time, float stage_timeout,
+                             int retries) {
+    clear();
+
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    for (int i = 0; i < FA_COUNT; i++) {
+        for (int j = 0; j < FA_COUNT; j++) {
+            // the same rule as in ForceActuatorBumpTestCommand::validate
+            _conflicts[i][j] = (i == j) || faa_settings.actuator_distance(i, j) <= minimal_distance;
+        }
+    }
+
+    _expected_test_time = BUMP_TEST_STAGES * std::min(expected_stage_time, stage_timeout);
+
+    for (auto z_index : z_indices) {
+        if (test_primary) {
+            _pending.push_back(BumpTestTask{z_index, true, retries, 0, 0});
+        }
+        if (test_secondary && faa_settings.ZIndexToSecondaryCylinderIndex[z_index] >= 0) {
+            _pending.push_back(BumpTestTask{z_index, false, retries, 0, 0});
+        }
+    }
+
+    _replan(0);
+}
+
+void BumpTestScheduler::clear() {
+    _pending.clear();
+    _running.clear();
+    _plan.clear();
+
+    _expected_duration = 0;
+    _max_concurrency = 0;
+    _failed_count = 0;
+}
+
+bool BumpTestScheduler::next(float now, const std::function<bool(int)>& can_start, BumpTestTask& task) {
+    for (auto it = _pending.begin(); it != _pending.end(); it++) {
+        if (_compatible(it->z_index, _running) && can_start(it->z_index)) {
+            task = *it;
+            task.start = now;
+            task.end = now + _expected_test_time;
+            _pending.erase(it);
+            _running.push_back(task);
+            return true;
+        }
+    }
+    return false;
+}
+
+void BumpTestScheduler::finished(int z_index, bool primary, bool failed, float now) {
+    auto it = std::find_if(_running.begin(), _running.end(), [z_index, primary](const BumpTestTask& t) {
+        return t.z_index == z_index && t.primary == primary;
+    });
+    if (it == _running.end()) {
+        return;
+    }
+
+    BumpTestTask task = *it;
+    _running.erase(it);
+
+    if (failed == false) {
+        return;
+    }
+
+    _failed_count++;
+
+    if (task.retries > 0) {
+        task.retries--;
+        _pending.push_back(task);
+        SPDLOG_INFO("Bump test of FA ID {} {} axis failed, retrying ({} retries left)",
+                    ForceActuatorApplicationSettings::ZIndexToActuatorId(z_index),
+                    primary ? "primary" : "secondary", task.retries);
+    }
+
+    _replan(now);
+
+    SPDLOG_INFO("Bump test replanned - {} tests pending, expected campaign duration {:.0f}s",
+                _pending.size(), _expected_duration);
+}
+
+void BumpTestScheduler::_replan(float now) {
+    for (int i = 0; i < FA_COUNT; i++) {
+        _conflict_count[i] = 0;
+    }
+    for (auto& p1 : _pending) {
+        for (auto& p2 : _pending) {
+            if (_conflicts[p1.z_index][p2.z_index]) {
+                _conflict_count[p1.z_index]++;
+            }
+        }
+    }
+
+    // most constrained FAs first, secondary after primary
+    std::vector<BumpTestTask> queue(_pending);
+    std::stable_sort(queue.begin(), queue.end(), [this](const BumpTestTask& a, const BumpTestTask& b) {
+        if (_conflict_count[a.z_index] != _conflict_count[b.z_index]) {
+            return _conflict_count[a.z_index] > _conflict_count[b.z_index];
+        }
+        if (a.z_index != b.z_index) {
+            return a.z_index < b.z_index;
+        }
+        return a.primary && !b.primary;
+    });
+
+    // simulate the campaign, starting tests as soon as they don't conflict with running tests
+    std::vector<BumpTestTask> simulated(_running);
+    for (auto& r : simulated) {
+        r.end = std::max(r.end, now);
+    }
+
+    _plan = _running;
+    _pending.clear();
+    _max_concurrency = _running.size();
+    _expected_duration = now;
+
+    float t = now;
+
+    while (queue.empty() == false) {
+        for (auto it = queue.begin(); it != queue.end();) {
+            if (_compatible(it->z_index, simulated)) {
+                it->start = t;
+                it->end = t + _expected_test_time;
+                simulated.push_back(*it);
+                _plan.push_back(*it);
+                _pending.push_back(*it);
+                it = queue.erase(it);
+            } else {
+                it++;
+            }
+        }
+
+        _max_concurrency = std::max(_max_concurrency, simulated.size());
+
+        // advance to the next test end
+        float next_end = std::numeric_limits<float>::infinity();
+        for (auto& s : simulated) {
+            next_end = std::min(next_end, s.end);
+        }
+        t = next_end;
+        simulated.erase(std::remove_if(simulated.begin(), simulated.end(),
+                                       [t](const BumpTestTask& s) { return s.end <= t; }),
+                        simulated.end());
+    }
+
+    for (auto& p : _plan) {
+        _expected_duration = std::max(_expected_duration, p.end);
+    }
+}
+
+bool BumpTestScheduler::_compatible(int z_index, const std::vector<BumpTestTask>& running) const {
+    for (auto& r : running) {
+        if (_conflicts[z_index][r.z_index]) {
+            return false;
+        }
+    }
+    return true;
+}
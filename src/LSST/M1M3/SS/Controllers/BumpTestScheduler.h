@@ -0,0 +1,175 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef BUMPTESTSCHEDULER_H_
+#define BUMPTESTSCHEDULER_H_
+
+#include <functional>
+#include <vector>
+
+#include <cRIO/DataTypes.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Single force actuator axis bump test.
+ */
+struct BumpTestTask {
+    // FA Z index (0-155)
+    int z_index;
+    // true for primary (Z) axis, false for secondary axis
+    bool primary;
+    // how many times can the test be repeated after a failure
+    int retries;
+    // test start, in seconds from the campaign start. Valid only for
+    // planned or running tests
+    float start;
+    // expected test end, in seconds from the campaign start
+    float end;
+};
+
+/**
+ * Plans full mirror bump test campaign. Force actuators closer than the
+ * minimal distance cannot be tested at the same time. Finding the best
+ * schedule is NP-complete problem, so a greedy list scheduling is used - the
+ * campaign is simulated, and when a test is expected to finish, pending tests
+ * which aren't in conflict with any running test are started. Pending tests
+ * are ordered by the number of conflicting tests, so the most constrained
+ * actuators are tested first. That keeps as many tests running in parallel as
+ * possible.
+ *
+ * The plan is recomputed every time a test fails. Failed tests are retried at
+ * most configured number of times, and the rest of the campaign is replanned
+ * from the current time.
+ *
+ * The scheduler doesn't trigger the tests itself - BumpTestController calls
+ * next to retrieve tests which shall be started and finished to report
+ * finished tests.
+ */
+class BumpTestScheduler {
+public:
+    BumpTestScheduler();
+
+    /**
+     * Plans new campaign.
+     *
+     * @param z_indices FAs to test. Usually all enabled FAs.
+     * @param test_primary test primary (Z) axis
+     * @param test_secondary test secondary (X or Y) axis. Ignored for single axis FAs.
+     * @param minimal_distance minimal distance (in m) between concurrently tested FAs
+     * @param expected_stage_time expected duration (in s) of a single bump test stage
+     * @param stage_timeout stage timeout (in s) - FA settle time
+     * @param retries how many times retry failed test
+     */
+    void plan(const std::vector<int>& z_indices, bool test_primary, bool test_secondary,
+              float minimal_distance, float expected_stage_time, float stage_timeout, int retries);
+
+    /**
+     * Clears planned and running tests.
+     */
+    void clear();
+
+    /**
+     * Returns true if no tests are planned or running.
+     */
+    bool empty() const { return _pending.empty() && _running.empty(); }
+
+    /**
+     * Returns current plan. Contains running and pending tests.
+     */
+    const std::vector<BumpTestTask>& get_plan() const { return _plan; }
+
+    /**
+     * Returns expected campaign duration, in seconds from campaign start.
+     */
+    float expected_duration() const { return _expected_duration; }
+
+    /**
+     * Returns maximal number of tests planned to run in parallel.
+     */
+    size_t max_concurrency() const { return _max_concurrency; }
+
+    /**
+     * Returns number of failed tests.
+     */
+    size_t failed_count() const { return _failed_count; }
+
+    /**
+     * Selects the next test to start. Pending tests are searched in the
+     * planned order, the first one not conflicting with any running test and
+     * passing the can_start check is returned and marked as running.
+     *
+     * @param now current time, in seconds from campaign start
+     * @param can_start additional check, called with FA Z index. Shall return
+     * false if the FA cannot be tested now (for example because a FA in its
+     * vicinity is tested outside of the campaign).
+     * @param task filled with selected test
+     *
+     * @return false if no test can be started
+     */
+    bool next(float now, const std::function<bool(int)>& can_start, BumpTestTask& task);
+
+    /**
+     * Returns tests currently running.
+     */
+    const std::vector<BumpTestTask>& running() const { return _running; }
+
+    /**
+     * Marks running test as finished. Failed tests are requeued (if retries
+     * weren't exhausted) and rest of the campaign is replanned.
+     *
+     * @param z_index FA Z index
+     * @param primary true for primary axis test
+     * @param failed true if test failed
+     * @param now current time, in seconds from campaign start
+     */
+    void finished(int z_index, bool primary, bool failed, float now);
+
+private:
+    void _replan(float now);
+
+    bool _compatible(int z_index, const std::vector<BumpTestTask>& running) const;
+
+    // FA pairs which cannot be tested at the same time
+    bool _conflicts[FA_COUNT][FA_COUNT];
+    // number of pending tests in conflict with the FA
+    int _conflict_count[FA_COUNT];
+
+    float _expected_test_time;
+
+    std::vector<BumpTestTask> _pending;
+    std::vector<BumpTestTask> _running;
+    std::vector<BumpTestTask> _plan;
+
+    float _expected_duration;
+    size_t _max_concurrency;
+    size_t _failed_count;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !BUMPTESTSCHEDULER_H_
@@ -0,0 +1,67 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <CylinderForcesConverter.h>
+#include <ForceActuatorApplicationSettings.h>
+#include <ForceActuatorOrientations.h>
+
+using namespace LSST::M1M3::SS;
+
+CylinderForcesConverter::CylinderForcesConverter() {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    memset(_lateralForces, 0, sizeof(_lateralForces));
+    memset(_signedLateral, 0, sizeof(_signedLateral));
+
+    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
+        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
+        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
+
+        switch (faa_settings.Table[zIndex].Orientation) {
+            case ForceActuatorOrientations::PositiveX:
+                _lateralIndex[zIndex] = xIndex;
+                _lateralSign[zIndex] = 1;
+                break;
+            case ForceActuatorOrientations::NegativeX:
+                _lateralIndex[zIndex] = xIndex;
+                _lateralSign[zIndex] = -1;
+                break;
+            case ForceActuatorOrientations::PositiveY:
+                _lateralIndex[zIndex] = FA_X_COUNT + yIndex;
+                _lateralSign[zIndex] = 1;
+                break;
+            case ForceActuatorOrientations::NegativeY:
+                _lateralIndex[zIndex] = FA_X_COUNT + yIndex;
+                _lateralSign[zIndex] = -1;
+                break;
+            default:
+                _lateralIndex[zIndex] = FA_X_COUNT + FA_Y_COUNT;
+                _lateralSign[zIndex] = 1;
+                break;
+        }
+    }
+
+    for (int sIndex = 0; sIndex < FA_S_COUNT; sIndex++) {
+        _secondaryZIndex[sIndex] = faa_settings.SecondaryCylinderIndexToZIndex[sIndex];
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CYLINDERFORCESCONVERTER_H_
+#define CYLINDERFORCESCONVERTER_H_
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <cRIO/DataTypes.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Converts actuator X, Y and Z forces into primary and secondary cylinder
+ * setpoints (in mN). Actuator orientation is folded into precomputed
+ * per-actuator lateral force index and sign, so the conversion is a
+ * branch-free pass over all actuators.
+ *
+ * For lateral force L (X or Y force multiplied by orientation sign, 0 for
+ * single axis actuators), primary cylinder force is Z - L and secondary
+ * cylinder force is L * sqrt(2).
+ */
+class CylinderForcesConverter {
+public:
+    /**
+     * Constructs converter, calculating coefficients from force actuators
+     * table.
+     */
+    CylinderForcesConverter();
+
+    /**
+     * Converts forces to cylinder setpoints.
+     *
+     * @tparam C cylinder forces container type
+     *
+     * @param xForces actuator X forces (N)
+     * @param yForces actuator Y forces (N)
+     * @param zForces actuator Z forces (N)
+     * @param primaryCylinderForces primary cylinder setpoints (mN), FA_COUNT elements
+     * @param secondaryCylinderForces secondary cylinder setpoints (mN), FA_S_COUNT elements
+     */
+    template <typename C>
+    void convert(const std::vector<float>& xForces, const std::vector<float>& yForces,
+                 const std::vector<float>& zForces, C& primaryCylinderForces, C& secondaryCylinderForces) {
+        memcpy(_lateralForces, xForces.data(), FA_X_COUNT * sizeof(float));
+        memcpy(_lateralForces + FA_X_COUNT, yForces.data(), FA_Y_COUNT * sizeof(float));
+
+        for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
+            _signedLateral[zIndex] = _lateralSign[zIndex] * _lateralForces[_lateralIndex[zIndex]];
+            primaryCylinderForces[zIndex] = toInt24(zForces[zIndex] - _signedLateral[zIndex]);
+        }
+
+        for (int sIndex = 0; sIndex < FA_S_COUNT; sIndex++) {
+            secondaryCylinderForces[sIndex] = toInt24(_signedLateral[_secondaryZIndex[sIndex]] * SQRT2);
+        }
+    }
+
+    /**
+     * Converts force in N to integer mN.
+     *
+     * @param force force in N
+     *
+     * @return force in mN
+     */
+    static int32_t toInt24(float force) { return (int32_t)(force * 1000.0); }
+
+    static double constexpr SQRT2 = 1.4142135623730950488016887242097;
+
+private:
+    // X forces, Y forces and zero for single axis actuators
+    float _lateralForces[FA_X_COUNT + FA_Y_COUNT + 1];
+    float _signedLateral[FA_COUNT];
+
+    int _lateralIndex[FA_COUNT];
+    float _lateralSign[FA_COUNT];
+    int _secondaryZIndex[FA_S_COUNT];
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* CYLINDERFORCESCONVERTER_H_ */
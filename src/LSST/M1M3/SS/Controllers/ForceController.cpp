@@ -20,6 +20,7 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iostream>
@@ -31,8 +32,6 @@
 #include "ForceActuatorApplicationSettings.h"
 #include "ForceActuatorBumpTestStatus.h"
 #include "ForceActuatorData.h"
-#include "ForceActuatorInfo.h"
-#include "ForceActuatorOrientations.h"
 #include "ForceActuatorSettings.h"
 #include "ForceController.h"
 #include "M1M3SSPublisher.h"
@@ -79,6 +78,7 @@ ForceController::ForceController()
     _appliedForces = M1M3SSPublisher::instance().getAppliedForces();
     _forceActuatorState = M1M3SSPublisher::instance().getEventForceActuatorState();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
 
     _inclinometerData = M1M3SSPublisher::instance().getInclinometerData();
 
@@ -88,6 +88,8 @@ ForceController::ForceController()
     _accelerometerData = M1M3SSPublisher::instance().getAccelerometerData();
     _gyroData = M1M3SSPublisher::instance().getGyroData();
 
+    _raiseFollowingErrorUtilization = 0;
+
     reset();
 
     double timestamp = M1M3SSPublisher::instance().getTimestamp();
@@ -174,6 +176,7 @@ bool ForceController::faRaiseFollowingErrorInTolerance() {
     float limit = ForceActuatorSettings::instance().raiseLowerFollowingErrorLimit;
     auto raiseInfo = &RaisingLoweringInfo::instance();
     bool ret = true;
+    float maxError = 0;
 
     for (int i = 0; i < FA_COUNT; ++i) {
         if (i < FA_X_COUNT) {
@@ -181,6 +184,7 @@ bool ForceController::faRaiseFollowingErrorInTolerance() {
             bool xInRange = Range::InRangeTrigger(-limit, limit, fe, limitTriggerX[i], limit, fe);
             raiseInfo->setFAXWait(i, !xInRange);
             ret = ret & xInRange;
+            maxError = std::max(maxError, std::fabs(fe));
         }
 
         if (i < FA_Y_COUNT) {
@@ -188,13 +192,18 @@ bool ForceController::faRaiseFollowingErrorInTolerance() {
             bool yInRange = Range::InRangeTrigger(-limit, limit, fe, limitTriggerY[i], limit, fe);
             raiseInfo->setFAYWait(i, !yInRange);
             ret = ret & yInRange;
+            maxError = std::max(maxError, std::fabs(fe));
         }
 
         float fe = ForceActuatorData::instance().zForce[i] - _appliedForces->zForces[i];
         bool zInRange = Range::InRangeTrigger(-limit, limit, fe, limitTriggerZ[i], limit, fe);
         raiseInfo->setFAZWait(i, !zInRange);
         ret = ret & zInRange;
+        maxError = std::max(maxError, std::fabs(fe));
     }
+
+    _raiseFollowingErrorUtilization = limit > 0 ? maxError / limit : 1;
+
     return ret;
 }
 
@@ -528,79 +537,28 @@ void ForceController::_sumAllForces() {
 void ForceController::_convertForcesToSetpoints() {
     SPDLOG_TRACE("ForceController: convertForcesToSetpoints()");
     bool clippingRequired = false;
-    auto& forceActuatorInfo = ForceActuatorInfo::instance();
 
     auto& faa_settings = ForceActuatorApplicationSettings::instance();
 
-    for (int pIndex = 0; pIndex < FA_COUNT; pIndex++) {
-        int xIndex = faa_settings.ZIndexToXIndex[pIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[pIndex];
-        int sIndex = faa_settings.ZIndexToSecondaryCylinderIndex[pIndex];
+    _cylinderForcesConverter.convert(
+            _appliedForces->xForces, _appliedForces->yForces, _appliedForces->zForces,
+            _preclipped_cylinder_forces.primaryCylinderForces,
+            _preclipped_cylinder_forces.secondaryCylinderForces);
 
-        _forceSetpointWarning->safetyLimitWarning[pIndex] = false;
-
-        if (sIndex != -1) {
-            float secondaryLowFault =
-                    ForceActuatorSettings::instance().CylinderLimitSecondaryTable[sIndex].LowFault;
-            float secondaryHighFault =
-                    ForceActuatorSettings::instance().CylinderLimitSecondaryTable[sIndex].HighFault;
-            switch (forceActuatorInfo.actuatorOrientation[pIndex]) {
-                case ForceActuatorOrientations::PositiveY:
-                    _preclipped_cylinder_forces.secondaryCylinderForces[sIndex] =
-                            _toInt24(_appliedForces->yForces[yIndex] * _sqrt2);
-                    break;
-                case ForceActuatorOrientations::PositiveX:
-                    _preclipped_cylinder_forces.secondaryCylinderForces[sIndex] =
-                            _toInt24(_appliedForces->xForces[xIndex] * _sqrt2);
-                    break;
-                case ForceActuatorOrientations::NegativeX:
-                    _preclipped_cylinder_forces.secondaryCylinderForces[sIndex] =
-                            _toInt24(-_appliedForces->xForces[xIndex] * _sqrt2);
-                    break;
-                case ForceActuatorOrientations::NegativeY:
-                    _preclipped_cylinder_forces.secondaryCylinderForces[sIndex] =
-                            _toInt24(-_appliedForces->yForces[yIndex] * _sqrt2);
-                    break;
-            }
-            bool notInRangeS =
-                    !Range::InRangeAndCoerce<int>(secondaryLowFault, secondaryHighFault,
-                                                  _preclipped_cylinder_forces.secondaryCylinderForces[sIndex],
-                                                  _appliedCylinderForces->secondaryCylinderForces[sIndex]);
-            _forceSetpointWarning->safetyLimitWarning[pIndex] =
-                    notInRangeS || _forceSetpointWarning->safetyLimitWarning[pIndex];
-        }
+    auto& fa_settings = ForceActuatorSettings::instance();
+    std::bitset<FA_COUNT> primaryClipped =
+            fa_settings.CylinderPrimaryLimits.clip(_preclipped_cylinder_forces.primaryCylinderForces.data(),
+                                                   _appliedCylinderForces->primaryCylinderForces.data());
+    std::bitset<FA_S_COUNT> secondaryClipped = fa_settings.CylinderSecondaryLimits.clip(
+            _preclipped_cylinder_forces.secondaryCylinderForces.data(),
+            _appliedCylinderForces->secondaryCylinderForces.data());
 
-        float primaryLowFault = ForceActuatorSettings::instance().CylinderLimitPrimaryTable[pIndex].LowFault;
-        float primaryHighFault =
-                ForceActuatorSettings::instance().CylinderLimitPrimaryTable[pIndex].HighFault;
-        switch (forceActuatorInfo.actuatorOrientation[pIndex]) {
-            case ForceActuatorOrientations::PositiveY:
-                _preclipped_cylinder_forces.primaryCylinderForces[pIndex] =
-                        _toInt24(_appliedForces->zForces[pIndex] - _appliedForces->yForces[yIndex]);
-                break;
-            case ForceActuatorOrientations::NA:
-                _preclipped_cylinder_forces.primaryCylinderForces[pIndex] =
-                        _toInt24(_appliedForces->zForces[pIndex]);
-                break;
-            case ForceActuatorOrientations::PositiveX:
-                _preclipped_cylinder_forces.primaryCylinderForces[pIndex] =
-                        _toInt24(_appliedForces->zForces[pIndex] - _appliedForces->xForces[xIndex]);
-                break;
-            case ForceActuatorOrientations::NegativeX:
-                _preclipped_cylinder_forces.primaryCylinderForces[pIndex] =
+    for (int pIndex = 0; pIndex < FA_COUNT; pIndex++) {
+        int sIndex = faa_settings.ZIndexToSecondaryCylinderIndex[pIndex];
 
-                        _toInt24(_appliedForces->zForces[pIndex] - -_appliedForces->xForces[xIndex]);
-                break;
-            case ForceActuatorOrientations::NegativeY:
-                _preclipped_cylinder_forces.primaryCylinderForces[pIndex] =
-                        _toInt24(_appliedForces->zForces[pIndex] - -_appliedForces->yForces[yIndex]);
-                break;
-        }
-        bool notInRange = !Range::InRangeAndCoerce<int>(
-                primaryLowFault, primaryHighFault, _preclipped_cylinder_forces.primaryCylinderForces[pIndex],
-                _appliedCylinderForces->primaryCylinderForces[pIndex]);
-        _forceSetpointWarning->safetyLimitWarning[pIndex] =
-                notInRange || _forceSetpointWarning->safetyLimitWarning[pIndex];
+        bool safetyLimitWarning = primaryClipped[pIndex] || (sIndex != -1 && secondaryClipped[sIndex]);
+        _forceSetpointWarningTracker->set(_forceSetpointWarning->safetyLimitWarning[pIndex],
+                                          safetyLimitWarning);
 
         clippingRequired = _forceSetpointWarning->safetyLimitWarning[pIndex] || clippingRequired;
     }
@@ -634,9 +592,12 @@ bool ForceController::_checkMirrorMoments() {
     float zMomentMax = ForceActuatorSettings::instance().mirrorZMoment *
                        ForceActuatorSettings::instance().setpointZMomentLowLimitFactor;
 
-    _forceSetpointWarning->xMomentWarning = !Range::InRange(xMomentMin, xMomentMax, xMoment);
-    _forceSetpointWarning->yMomentWarning = !Range::InRange(yMomentMin, yMomentMax, yMoment);
-    _forceSetpointWarning->zMomentWarning = !Range::InRange(zMomentMin, zMomentMax, zMoment);
+    _forceSetpointWarningTracker->set(_forceSetpointWarning->xMomentWarning,
+                                      !Range::InRange(xMomentMin, xMomentMax, xMoment));
+    _forceSetpointWarningTracker->set(_forceSetpointWarning->yMomentWarning,
+                                      !Range::InRange(yMomentMin, yMomentMax, yMoment));
+    _forceSetpointWarningTracker->set(_forceSetpointWarning->zMomentWarning,
+                                      !Range::InRange(zMomentMin, zMomentMax, zMoment));
     _safetyController->forceControllerNotifyXMomentLimit(
             _forceSetpointWarning->xMomentWarning,
             fmt::format("Force controller X Moment Limit - applied {:.02f} N, "
@@ -683,10 +644,10 @@ bool ForceController::_checkNearNeighbors() {
         float deltaZ = abs(_appliedForces->zForces[zIndex] - nearZ);
 
         if (deltaZ > nominalZWarning) {
-            _forceSetpointWarning->nearNeighborWarning[zIndex] = true;
+            _forceSetpointWarningTracker->set(_forceSetpointWarning->nearNeighborWarning[zIndex], true);
             failed += to_string(faa_settings.ZIndexToActuatorId(zIndex)) + ":" + to_string(deltaZ) + " ";
         } else {
-            _forceSetpointWarning->nearNeighborWarning[zIndex] = false;
+            _forceSetpointWarningTracker->set(_forceSetpointWarning->nearNeighborWarning[zIndex], false);
         }
 
         bool previousWarning = _forceSetpointWarning->nearNeighborWarning[zIndex];
@@ -716,8 +677,10 @@ bool ForceController::_checkMirrorWeight() {
     }
     float globalForce = x + y + z;
     bool previousWarning = _forceSetpointWarning->magnitudeWarning;
-    _forceSetpointWarning->magnitudeWarning =
-            globalForce > (_mirrorWeight * ForceActuatorSettings::instance().setpointMirrorWeightLimitFactor);
+    _forceSetpointWarningTracker->set(
+            _forceSetpointWarning->magnitudeWarning,
+            globalForce >
+                    (_mirrorWeight * ForceActuatorSettings::instance().setpointMirrorWeightLimitFactor));
     _safetyController->forceControllerNotifyMagnitudeLimit(_forceSetpointWarning->magnitudeWarning,
                                                            globalForce);
     return _forceSetpointWarning->magnitudeWarning != previousWarning;
@@ -783,9 +746,9 @@ bool ForceController::_checkFarNeighbors() {
             failed += fmt::format(" {}: magA {:.2f} globalA {:.2f} |{:.2f}| < {:.2f}",
                                   faa_settings.ZIndexToActuatorId(zIndex), magnitudeAverage,
                                   globalAverageForce, magnitudeAverage - globalAverageForce, tolerance);
-            _forceSetpointWarning->farNeighborWarning[zIndex] = true;
+            _forceSetpointWarningTracker->set(_forceSetpointWarning->farNeighborWarning[zIndex], true);
         } else {
-            _forceSetpointWarning->farNeighborWarning[zIndex] = false;
+            _forceSetpointWarningTracker->set(_forceSetpointWarning->farNeighborWarning[zIndex], false);
         }
         _forceSetpointWarning->anyFarNeighborWarning = _forceSetpointWarning->farNeighborWarning[zIndex] ||
                                                        _forceSetpointWarning->anyFarNeighborWarning;
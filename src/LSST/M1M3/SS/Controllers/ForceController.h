@@ -36,14 +36,16 @@
 #include "ActiveOpticForceComponent.h"
 #include "AzimuthForceComponent.h"
 #include "BalanceForceComponent.h"
+#include "CylinderForcesConverter.h"
 #include "DistributedForces.h"
 #include "ElevationForceComponent.h"
+#include "EventChangeTracker.h"
 #include "FinalForceComponent.h"
 #include "ForceActuatorSettings.h"
 #include "ForcesAndMoments.h"
 #include "LimitTrigger.h"
 #include "OffsetForceComponent.h"
-#include "PID.h"
+#include "PIDParameters.h"
 #include "PreclippedForces.h"
 #include "SafetyController.h"
 #include "StaticForceComponent.h"
@@ -145,6 +147,13 @@ public:
      */
     bool faRaiseFollowingErrorInTolerance();
 
+    /**
+     * Returns the largest ratio of force actuator following error to
+     * RaiseLowerFollowingErrorLimit found in the last
+     * faRaiseFollowingErrorInTolerance call.
+     */
+    float getRaiseFollowingErrorUtilization() { return _raiseFollowingErrorUtilization; }
+
     void updateAppliedForces();
 
     /**
@@ -232,8 +241,6 @@ private:
     bool _checkMirrorWeight();
     bool _checkFarNeighbors();
 
-    static double constexpr _sqrt2 = 1.4142135623730950488016887242097;
-
     SafetyController* _safetyController;
 
     AccelerationForceComponent _accelerationForceComponent;
@@ -251,7 +258,9 @@ private:
     MTM1M3_appliedForcesC* _appliedForces;
     MTM1M3_logevent_forceActuatorStateC* _forceActuatorState;
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
     PreclippedCylinderForces<MTM1M3_logevent_preclippedCylinderForcesC> _preclipped_cylinder_forces;
+    CylinderForcesConverter _cylinderForcesConverter;
 
     MTM1M3_inclinometerDataC* _inclinometerData;
     MTM1M3_pidDataC* _pidData;
@@ -264,59 +273,50 @@ private:
 
     float _zero[FA_COUNT];
     float _mirrorWeight;
+    float _raiseFollowingErrorUtilization;
 
-    class ForceLimitTrigger : public LimitTrigger<float, float> {
+    class ForceLimitTrigger : public LimitTrigger<ForceLimitTrigger, float, float> {
     public:
         ForceLimitTrigger() {
             _axis = 'U';
             _faId = -1;
-            _counter = 0;
         }
 
         ForceLimitTrigger(char axis, int faId) {
             _axis = axis;
             _faId = faId;
-            _counter = 0;
         }
 
-    protected:
-        bool trigger() override {
-            _counter++;
-            // problems are reported  when accumulated counter reaches those levels
-            static int levels[4] = {1, 200, 500, 100000};
-            for (int i = 0; i < 4; i++)
-                if (levels[i] == _counter) return true;
-            return ((_counter % levels[3]) == 0);
+        void reset() {
+            if (_occurrences.count() > 0) {
+                SPDLOG_INFO(
+                        "FA ID {} axis {} following error is back into limits "
+                        "after {} failures",
+                        _faId, _axis, _occurrences.restart());
+            }
         }
 
-        void execute(float limit, float fe) override {
+    protected:
+        friend LimitTrigger;
+
+        bool trigger() { return _occurrences.next(); }
+
+        void execute(float limit, float fe) {
             SPDLOG_WARN(
                     "Violated {} follow-up error FA ID {} measured error {} "
                     "({}th occurence), limit +-{}",
-                    _axis, _faId, fe, _counter, limit);
-        }
-
-        void reset() override {
-            if (_counter > 0) {
-                SPDLOG_INFO(
-                        "FA ID {} axis {} following error is back into limits "
-                        "after {} failures",
-                        _faId, _axis, _counter);
-                _counter = 0;
-            }
+                    _axis, _faId, fe, _occurrences.count(), limit);
         }
 
     private:
         char _axis;
         int _faId;
-        int _counter;
+        OccurrenceCounter<100000> _occurrences;
     };
 
     ForceLimitTrigger limitTriggerX[FA_X_COUNT];
     ForceLimitTrigger limitTriggerY[FA_Y_COUNT];
     ForceLimitTrigger limitTriggerZ[FA_Z_COUNT];
-
-    static int32_t _toInt24(float force) { return (int32_t)(force * 1000.0); }
 };
 
 } /* namespace SS */
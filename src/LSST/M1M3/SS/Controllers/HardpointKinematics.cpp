@@ -0,0 +1,113 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <HardpointKinematics.h>
+#include <Units.h>
+
+using namespace LSST::M1M3::SS;
+
+/**
+ * Returns row (or column) of the hardpoint in settings matrices. Matrices
+ * list hardpoints starting with HP 3 (index 2).
+ *
+ * @param hp hardpoint index
+ *
+ * @return matrix row or column
+ */
+static inline int matrixIndex(int hp) { return (hp + 4) % HP_COUNT; }
+
+HardpointKinematics::HardpointKinematics() {
+    memset(_positionToDisplacement, 0, sizeof(_positionToDisplacement));
+    memset(_encoderToPosition, 0, sizeof(_encoderToPosition));
+    _metersToSteps = 0;
+    _stepsToEncoder = 0;
+}
+
+void HardpointKinematics::load(const std::vector<double>& mirrorPositionToHardpointDisplacement,
+                               const std::vector<double>& hardpointDisplacementToMirrorPosition,
+                               double micrometersPerStep, double micrometersPerEncoder) {
+    if (mirrorPositionToHardpointDisplacement.size() != 36 ||
+        hardpointDisplacementToMirrorPosition.size() != 36) {
+        throw std::runtime_error(
+                fmt::format("Hardpoint kinematics matrices must have 36 elements, have {} and {}",
+                            mirrorPositionToHardpointDisplacement.size(),
+                            hardpointDisplacementToMirrorPosition.size()));
+    }
+
+    double encoderToMeters = micrometersPerEncoder * UM2M;
+
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        int m = matrixIndex(hp);
+        for (int axis = 0; axis < 6; axis++) {
+            _positionToDisplacement[hp][axis] = mirrorPositionToHardpointDisplacement[m * 6 + axis];
+            _encoderToPosition[axis][hp] =
+                    hardpointDisplacementToMirrorPosition[axis * 6 + m] * encoderToMeters;
+        }
+    }
+
+    _metersToSteps = M2UM / micrometersPerStep;
+    _stepsToEncoder = micrometersPerStep / micrometersPerEncoder;
+}
+
+void HardpointKinematics::positionToSteps(const double* position, int32_t* steps) const {
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        double displacement = 0;
+        for (int axis = 0; axis < 6; axis++) {
+            displacement += _positionToDisplacement[hp][axis] * position[axis];
+        }
+        steps[hp] = displacement * _metersToSteps;
+    }
+}
+
+void HardpointKinematics::positionsToSteps(const double* positions, int32_t* steps, size_t count) const {
+    for (size_t i = 0; i < count; i++) {
+        positionToSteps(positions + i * 6, steps + i * HP_COUNT);
+    }
+}
+
+void HardpointKinematics::encoderToPosition(const int32_t* encoder, const int32_t* reference,
+                                            double* position) const {
+    double counts[HP_COUNT];
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        counts[hp] = encoder[hp] - reference[hp];
+    }
+    for (int axis = 0; axis < 6; axis++) {
+        double p = 0;
+        for (int hp = 0; hp < HP_COUNT; hp++) {
+            p += _encoderToPosition[axis][hp] * counts[hp];
+        }
+        position[axis] = p;
+    }
+}
+
+void HardpointKinematics::encodersToPositions(const int32_t* encoders, const int32_t* reference,
+                                              double* positions, size_t count) const {
+    for (size_t i = 0; i < count; i++) {
+        encoderToPosition(encoders + i * HP_COUNT, reference, positions + i * 6);
+    }
+}
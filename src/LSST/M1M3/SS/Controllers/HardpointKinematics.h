@@ -0,0 +1,126 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef HARDPOINTKINEMATICS_H_
+#define HARDPOINTKINEMATICS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cRIO/DataTypes.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Hardpoint (hexapod) kinematics. Converts mirror position into hardpoint
+ * steps (inverse kinematics) and hardpoint encoder values into mirror
+ * position (forward kinematics).
+ *
+ * MirrorPositionToHardpointDisplacement and
+ * HardpointDisplacementToMirrorPosition tables list hardpoints in 3, 4, 5, 6,
+ * 1, 2 order. The tables are reordered into hardpoint index order when
+ * loaded, so the conversions are plain matrix-vector products.
+ *
+ * Mirror position is x, y, z translation (m) followed by x, y, z rotations,
+ * in units of the tables.
+ */
+class HardpointKinematics {
+public:
+    HardpointKinematics();
+
+    /**
+     * Loads conversion matrices.
+     *
+     * @param mirrorPositionToHardpointDisplacement 6x6 row-major matrix,
+     * mirror position to hardpoint displacement (m)
+     * @param hardpointDisplacementToMirrorPosition 6x6 row-major matrix,
+     * hardpoint displacement (m) to mirror position
+     * @param micrometersPerStep stepper motor step size
+     * @param micrometersPerEncoder encoder count size
+     *
+     * @throw std::runtime_error when matrices don't have 36 elements
+     */
+    void load(const std::vector<double>& mirrorPositionToHardpointDisplacement,
+              const std::vector<double>& hardpointDisplacementToMirrorPosition, double micrometersPerStep,
+              double micrometersPerEncoder);
+
+    /**
+     * Converts mirror position into hardpoint steps offsets from the
+     * reference position.
+     *
+     * @param position mirror position (6 values)
+     * @param steps hardpoint steps (HP_COUNT values)
+     */
+    void positionToSteps(const double* position, int32_t* steps) const;
+
+    /**
+     * Batched positionToSteps.
+     *
+     * @param positions count mirror positions, 6 values each
+     * @param steps count hardpoint steps, HP_COUNT values each
+     * @param count number of positions to convert
+     */
+    void positionsToSteps(const double* positions, int32_t* steps, size_t count) const;
+
+    /**
+     * Converts hardpoint encoder values into mirror position.
+     *
+     * @param encoder hardpoint encoder values (HP_COUNT values)
+     * @param reference hardpoint encoder values of the reference position
+     * @param position calculated mirror position (6 values)
+     */
+    void encoderToPosition(const int32_t* encoder, const int32_t* reference, double* position) const;
+
+    /**
+     * Batched encoderToPosition.
+     *
+     * @param encoders count sets of HP_COUNT encoder values
+     * @param reference hardpoint encoder values of the reference position
+     * @param positions count mirror positions, 6 values each
+     * @param count number of encoder sets to convert
+     */
+    void encodersToPositions(const int32_t* encoders, const int32_t* reference, double* positions,
+                             size_t count) const;
+
+    /**
+     * Returns ratio between step and encoder count.
+     *
+     * @return encoder counts per a single step
+     */
+    double getStepsToEncoder() const { return _stepsToEncoder; }
+
+private:
+    double _positionToDisplacement[HP_COUNT][6];
+    double _encoderToPosition[6][HP_COUNT];
+    double _metersToSteps;
+    double _stepsToEncoder;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* HARDPOINTKINEMATICS_H_ */
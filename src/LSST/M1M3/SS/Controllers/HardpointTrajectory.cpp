@@ -0,0 +1,103 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <HardpointTrajectory.h>
+
+using namespace LSST::M1M3::SS;
+
+static void checkMaxStepsPerLoop(int32_t maxStepsPerLoop) {
+    if (maxStepsPerLoop <= 0 || maxStepsPerLoop > INT16_MAX) {
+        throw std::runtime_error(fmt::format("Invalid maximal steps per loop: {}", maxStepsPerLoop));
+    }
+}
+
+HardpointTrajectory::HardpointTrajectory() { clear(); }
+
+void HardpointTrajectory::clear() {
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        _quotas[hp].clear();
+        _cursor[hp] = 0;
+        _end[hp] = 0;
+        _remaining[hp] = 0;
+    }
+}
+
+size_t HardpointTrajectory::addSegment(const int32_t* steps, int32_t maxStepsPerLoop) {
+    checkMaxStepsPerLoop(maxStepsPerLoop);
+
+    int32_t maxSteps = 0;
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        maxSteps = std::max(maxSteps, std::abs(steps[hp]));
+    }
+    size_t cycles = (maxSteps + maxStepsPerLoop - 1) / maxStepsPerLoop;
+
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        _append(hp, steps[hp], cycles);
+    }
+    return cycles;
+}
+
+void HardpointTrajectory::setHardpoint(int hp, int32_t steps, int32_t maxStepsPerLoop) {
+    checkMaxStepsPerLoop(maxStepsPerLoop);
+
+    _quotas[hp].clear();
+    _cursor[hp] = 0;
+    _end[hp] = 0;
+    _remaining[hp] = 0;
+    _append(hp, steps, (std::abs(steps) + maxStepsPerLoop - 1) / maxStepsPerLoop);
+}
+
+size_t HardpointTrajectory::cycles() const {
+    size_t ret = 0;
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        ret = std::max(ret, _quotas[hp].size());
+    }
+    return ret;
+}
+
+void HardpointTrajectory::stop(int hp) {
+    _cursor[hp] = _end[hp];
+    _remaining[hp] = 0;
+}
+
+void HardpointTrajectory::_append(int hp, int32_t steps, size_t cycles) {
+    _quotas[hp].reserve(_quotas[hp].size() + cycles);
+    // spread steps evenly - quotas differ at most by one step and add up
+    // exactly to steps
+    int64_t done = 0;
+    for (size_t c = 1; c <= cycles; c++) {
+        int64_t target = static_cast<int64_t>(steps) * static_cast<int64_t>(c) / static_cast<int64_t>(cycles);
+        _quotas[hp].push_back(target - done);
+        done = target;
+    }
+    if (steps != 0) {
+        _end[hp] = _quotas[hp].size();
+    }
+    _remaining[hp] += steps;
+}
@@ -0,0 +1,128 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the LSST Telescope & Site Software Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef HARDPOINTTRAJECTORY_H_
+#define HARDPOINTTRAJECTORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cRIO/DataTypes.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Precomputed hardpoint step quotas. Trajectory consists of segments. Each
+ * segment is spread evenly over the minimal number of outer loop cycles
+ * needed to move the hardpoint with the largest offset at maximal rate, so
+ * all hardpoints move together and finish the segment in the same cycle.
+ *
+ * Trajectory is planned when a move command is received. The outer loop then
+ * only retrieves the next per-cycle quota of every hardpoint.
+ */
+class HardpointTrajectory {
+public:
+    HardpointTrajectory();
+
+    /**
+     * Removes all segments.
+     */
+    void clear();
+
+    /**
+     * Appends a segment.
+     *
+     * @param steps segment hardpoint steps offsets (HP_COUNT values)
+     * @param maxStepsPerLoop maximal number of steps in a single cycle
+     *
+     * @return number of cycles the segment takes
+     *
+     * @throw std::runtime_error when maxStepsPerLoop isn't a positive 16 bit value
+     */
+    size_t addSegment(const int32_t* steps, int32_t maxStepsPerLoop);
+
+    /**
+     * Replaces plan of a single hardpoint, leaving other hardpoints plans
+     * untouched.
+     *
+     * @param hp hardpoint index
+     * @param steps steps offset
+     * @param maxStepsPerLoop maximal number of steps in a single cycle
+     */
+    void setHardpoint(int hp, int32_t steps, int32_t maxStepsPerLoop);
+
+    /**
+     * Returns next hardpoint quota.
+     *
+     * @param hp hardpoint index
+     *
+     * @return steps to command in this cycle, 0 when the hardpoint finished
+     */
+    int32_t next(int hp) {
+        if (finished(hp)) {
+            return 0;
+        }
+        int32_t quota = _quotas[hp][_cursor[hp]++];
+        _remaining[hp] -= quota;
+        return quota;
+    }
+
+    /**
+     * Returns true if the hardpoint doesn't have any more non-zero quota.
+     */
+    bool finished(int hp) const { return _cursor[hp] >= _end[hp]; }
+
+    /**
+     * Returns sum of hardpoint quotas not yet retrieved.
+     */
+    int32_t remaining(int hp) const { return _remaining[hp]; }
+
+    /**
+     * Drops remaining quotas of the hardpoint.
+     *
+     * @param hp hardpoint index
+     */
+    void stop(int hp);
+
+    /**
+     * Returns number of planned cycles.
+     */
+    size_t cycles() const;
+
+private:
+    void _append(int hp, int32_t steps, size_t cycles);
+
+    std::vector<int16_t> _quotas[HP_COUNT];
+    size_t _cursor[HP_COUNT];
+    size_t _end[HP_COUNT];
+    int32_t _remaining[HP_COUNT];
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* HARDPOINTTRAJECTORY_H_ */
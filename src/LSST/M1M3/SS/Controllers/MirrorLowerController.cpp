@@ -23,20 +23,30 @@
 
 #include <spdlog/spdlog.h>
 
+#include <ForceActuatorSettings.h>
 #include <ForceController.h>
 #include <M1M3SSPublisher.h>
 #include <MirrorLowerController.h>
 #include <PositionController.h>
+#include <PositionControllerSettings.h>
 #include <PowerController.h>
 #include <RaisingLoweringInfo.h>
 #include <SafetyController.h>
 
 using namespace LSST::M1M3::SS;
 
+namespace {
+
+const char* const LOWER_PHASES[] = {"MoveToLowerPosition", "SupportTransfer", "Paused"};
+static_assert(sizeof(LOWER_PHASES) / sizeof(LOWER_PHASES[0]) == MirrorLowerController::PHASES_COUNT);
+
+}  // namespace
+
 MirrorLowerController::MirrorLowerController(PositionController* positionController,
                                              ForceController* forceController,
                                              SafetyController* safetyController,
-                                             PowerController* powerController) {
+                                             PowerController* powerController)
+        : _phases("Lowering", LOWER_PHASES) {
     SPDLOG_DEBUG("MirrorLowerController: MirrorLowerController()");
     _positionController = positionController;
     _forceController = forceController;
@@ -54,6 +64,7 @@ MirrorLowerController::MirrorLowerController(PositionController* positionControl
 
 void MirrorLowerController::start() {
     SPDLOG_INFO("MirrorLowerController: startLowerOperation()");
+    _configureProfile();
     _safetyController->lowerOperationTimeout(false);
     _positionController->startLower();
 
@@ -66,6 +77,9 @@ void MirrorLowerController::start() {
 
     setStartTimestamp();
 
+    _phases.reset();
+    _phases.enter(MOVE_TO_LOWER_POSITION, _cachedStartTime);
+
     _forceController->zeroAccelerationForces();
     _forceController->zeroActiveOpticForces();
     _forceController->zeroAzimuthForces();
@@ -85,11 +99,13 @@ void MirrorLowerController::runLoop() {
     SPDLOG_TRACE("MirrorLowerController: runLoop() {}",
                  RaisingLoweringInfo::instance().weightSupportedPercent);
     if (_movedToLowerPosition == false) {
+        _enterPhase(MOVE_TO_LOWER_POSITION);
         _movedToLowerPosition = _positionController->motionComplete();
         if (_movedToLowerPosition == true) {
             _positionController->enableChaseAll();
         }
     } else if (RaisingLoweringInfo::instance().supportPercentageZeroed() == false) {
+        _enterPhase(SUPPORT_TRANSFER);
         // We are still in the process of transfering the support force from the
         // static supports to the force actuators
         // TODO: Does it matter if the following error is bad when we are trying to
@@ -98,7 +114,9 @@ void MirrorLowerController::runLoop() {
             // The forces on the hardpoints are within tolerance, we can continue to
             // transfer the support force from the static supports to the force
             // actuators
-            RaisingLoweringInfo::instance().decSupportPercentage();
+            RaisingLoweringInfo::instance().decSupportPercentage(
+                    _profile.getIncrement(ForceActuatorSettings::instance().lowerDecrementPercentage,
+                                          _positionController->getRaiseLowerForceUtilization()));
         }
     }
 
@@ -126,6 +144,7 @@ void MirrorLowerController::complete() {
     _forceController->zeroThermalForces();
     _forceController->zeroVelocityForces();
     RaisingLoweringInfo::instance().zeroSupportPercentage();
+    _phases.finish(M1M3SSPublisher::instance().getTimestamp());
 }
 
 bool MirrorLowerController::checkTimeout() {
@@ -140,10 +159,12 @@ void MirrorLowerController::timeout() {
     // TODO: How should the system react if the operation times out?
     //       For now we will assume the worst and fault the systeme
     _safetyController->lowerOperationTimeout(true);
+    _phases.finish(M1M3SSPublisher::instance().getTimestamp());
 }
 
 void MirrorLowerController::abortRaiseM1M3() {
     SPDLOG_INFO("MirrorLowerController:: abortRaiseM1M3()");
+    _configureProfile();
     _safetyController->lowerOperationTimeout(false);
     _positionController->stopMotion();
     _positionController->enableChaseAll();
@@ -160,12 +181,16 @@ void MirrorLowerController::abortRaiseM1M3() {
     _movedToLowerPosition = true;
 
     setStartTimestamp();
+
+    _phases.reset();
+    _phases.enter(SUPPORT_TRANSFER, _cachedStartTime);
 }
 
 void MirrorLowerController::pauseM1M3Lowering() {
     _loweringPaused = true;
     _remaininingTimedout -= (M1M3SSPublisher::instance().getTimestamp() - _cachedStartTime);
     RaisingLoweringInfo::instance().setTimeTimeout(NAN);
+    _enterPhase(PAUSED);
 }
 
 void MirrorLowerController::resumeM1M3Lowering() {
@@ -179,3 +204,16 @@ void MirrorLowerController::setStartTimestamp() {
     _remaininingTimedout = _positionController->getLowerTimeout();
     RaisingLoweringInfo::instance().setTimeTimeout(_cachedStartTime + _remaininingTimedout);
 }
+
+void MirrorLowerController::_configureProfile() {
+    auto& settings = PositionControllerSettings::instance();
+    _profile.configure(settings.raiseLowerProfileEnabled, settings.raiseLowerProfileMaxFactor,
+                       settings.raiseLowerProfileLowUtilization, settings.raiseLowerProfileHighUtilization);
+}
+
+void MirrorLowerController::_enterPhase(Phases phase) {
+    // phases are timed only between start and complete
+    if (_phases.running()) {
+        _phases.enter(phase, M1M3SSPublisher::instance().getTimestamp());
+    }
+}
@@ -25,8 +25,10 @@
 #define MIRRORCONTROLLER_H_
 
 #include <ForceController.h>
+#include <PhaseTimer.h>
 #include <PositionController.h>
 #include <PowerController.h>
+#include <RaiseLowerProfile.h>
 #include <SafetyController.h>
 
 namespace LSST {
@@ -39,10 +41,18 @@ namespace SS {
  * state calls in a loop method the MirrorLowerController to perform operations
  * requested.
  *
+ * Support percentage is decreased by fixed LowerDecrementPercentage, or by
+ * decrement calculated by RaiseLowerProfile from measured hardpoint forces
+ * when the profile is enabled. Time spent in lowering phases is logged.
+ *
  * @see MirrorRaiseController
  */
 class MirrorLowerController {
 public:
+    /**
+     * Lowering phases, timed by PhaseTimer.
+     */
+    enum Phases { MOVE_TO_LOWER_POSITION, SUPPORT_TRANSFER, PAUSED, PHASES_COUNT };
     /**
      * Construct mirror controller.
      *
@@ -65,6 +75,8 @@ public:
     void pauseM1M3Lowering();
     void resumeM1M3Lowering();
 
+    const PhaseTimer& getPhases() const { return _phases; }
+
 protected:
     /**
      * Sets operation start timestamp to current time.
@@ -83,6 +95,12 @@ private:
     bool _movedToLowerPosition;
 
     bool _loweringPaused;
+
+    RaiseLowerProfile _profile;
+    PhaseTimer _phases;
+
+    void _configureProfile();
+    void _enterPhase(Phases phase);
 };
 
 } /* namespace SS */
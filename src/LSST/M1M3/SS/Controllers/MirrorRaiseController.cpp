@@ -21,6 +21,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include <spdlog/spdlog.h>
 #include <fmt/ranges.h>
 
@@ -30,12 +32,21 @@
 #include "M1M3SSPublisher.h"
 #include "MirrorRaiseController.h"
 #include "PositionController.h"
+#include "PositionControllerSettings.h"
 #include "PowerController.h"
 #include "RaisingLoweringInfo.h"
 #include "SafetyController.h"
 
 using namespace LSST::M1M3::SS;
 
+namespace {
+
+const char* const RAISE_PHASES[] = {"WaitAirPressure", "SupportTransfer", "MoveToReference", "HPSettle",
+                                    "Paused"};
+static_assert(sizeof(RAISE_PHASES) / sizeof(RAISE_PHASES[0]) == MirrorRaiseController::PHASES_COUNT);
+
+}  // namespace
+
 HpInRangeCounter::HpInRangeCounter() { reset(); }
 
 void HpInRangeCounter::reset() {
@@ -77,7 +88,8 @@ bool HpInRangeCounter::timeouted() {
 MirrorRaiseController::MirrorRaiseController(PositionController* positionController,
                                              ForceController* forceController,
                                              SafetyController* safetyController,
-                                             PowerController* powerController) {
+                                             PowerController* powerController)
+        : _phases("Raising", RAISE_PHASES) {
     SPDLOG_DEBUG("MirrorRaiseController: MirrorRaiseController()");
     _positionController = positionController;
     _forceController = forceController;
@@ -108,6 +120,10 @@ void MirrorRaiseController::start(bool bypassMoveToReference) {
         _hp_in_range[i].reset();
     }
 
+    auto& settings = PositionControllerSettings::instance();
+    _profile.configure(settings.raiseLowerProfileEnabled, settings.raiseLowerProfileMaxFactor,
+                       settings.raiseLowerProfileLowUtilization, settings.raiseLowerProfileHighUtilization);
+
     _safetyController->raiseOperationTimeout(false);
     _positionController->startRaise();
     _forceController->zeroAccelerationForces();
@@ -126,6 +142,9 @@ void MirrorRaiseController::start(bool bypassMoveToReference) {
 
     RaisingLoweringInfo::instance().setWaitAirPressure(false);
 
+    _phases.reset();
+    _phases.enter(SUPPORT_TRANSFER, _cachedStartTime);
+
     if (AirSupplyStatus::instance().airValveClosed == true) {
         SPDLOG_WARN(
                 "Air valve is closed and the mirror was commanded to raise. "
@@ -146,12 +165,14 @@ void MirrorRaiseController::runLoop() {
         // Wait for pressure to raise after valve opening
         if (raiseInfo->supportPercentageZeroed() && hpWarning->anyLowAirPressureFault) {
             raiseInfo->setWaitAirPressure(true);
+            _enterPhase(WAIT_AIR_PRESSURE);
             // hpRaiseLowerForcesInTolerance needs to be called to stop encoder
             // movement if on tension limit
             _positionController->hpRaiseLowerForcesInTolerance(true);
             return;
         }
         raiseInfo->setWaitAirPressure(false);
+        _enterPhase(SUPPORT_TRANSFER);
         // We are still in the process of transferring the support force from the
         // static supports to the force actuators
         if (_positionController->hpRaiseLowerForcesInTolerance(true) &&
@@ -160,7 +181,11 @@ void MirrorRaiseController::runLoop() {
             // the force actuators are following their setpoints, we can continue to
             // transfer the support force from the static supports to the force
             // actuators
-            RaisingLoweringInfo::instance().incSupportPercentage();
+            // Both checks passed, utilizations are up to date
+            float utilization = std::max(_positionController->getRaiseLowerForceUtilization(),
+                                         _forceController->getRaiseFollowingErrorUtilization());
+            raiseInfo->incSupportPercentage(_profile.getIncrement(
+                    ForceActuatorSettings::instance().raiseIncrementPercentage, utilization));
             if (_raisePauseReported == true) {
                 _raisePauseReported = false;
                 SPDLOG_INFO("Raising resumed");
@@ -215,6 +240,10 @@ bool MirrorRaiseController::checkComplete() {
     _last_force_filled = force_filled;
     _last_position_completed = position_completed;
 
+    if (force_filled && _raisingPaused == false) {
+        _enterPhase(position_completed ? HP_SETTLE : MOVE_TO_REFERENCE);
+    }
+
     return force_filled && position_completed && hp_force_minimal;
 }
 
@@ -247,6 +276,7 @@ void MirrorRaiseController::complete() {
         }
     }
     RaisingLoweringInfo::instance().fillSupportPercentage();
+    _phases.finish(M1M3SSPublisher::instance().getTimestamp());
 }
 
 bool MirrorRaiseController::checkTimeout() {
@@ -259,12 +289,14 @@ bool MirrorRaiseController::checkTimeout() {
 void MirrorRaiseController::timeout() {
     SPDLOG_ERROR("MirrorRaiseController: timeout()");
     _safetyController->raiseOperationTimeout(true);
+    _phases.finish(M1M3SSPublisher::instance().getTimestamp());
 }
 
 void MirrorRaiseController::pauseM1M3Raising() {
     _raisingPaused = true;
     _remaininingTimedout -= (M1M3SSPublisher::instance().getTimestamp() - _cachedStartTime);
     RaisingLoweringInfo::instance().setTimeTimeout(NAN);
+    _enterPhase(PAUSED);
 }
 
 void MirrorRaiseController::resumeM1M3Raising() {
@@ -282,3 +314,10 @@ bool MirrorRaiseController::_check_hp_ready() {
     }
     return true;
 }
+
+void MirrorRaiseController::_enterPhase(Phases phase) {
+    // phases are timed only between start and complete
+    if (_phases.running()) {
+        _phases.enter(phase, M1M3SSPublisher::instance().getTimestamp());
+    }
+}
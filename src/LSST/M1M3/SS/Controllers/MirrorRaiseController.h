@@ -25,8 +25,10 @@
 #define MIRRORRAISECONTROLLER_H_
 
 #include <ForceController.h>
+#include <PhaseTimer.h>
 #include <PositionController.h>
 #include <PowerController.h>
+#include <RaiseLowerProfile.h>
 #include <SafetyController.h>
 
 namespace LSST {
@@ -65,11 +67,27 @@ private:
  * state (controlled through PositionController), HP is following force seen on
  * its top end to remain close to 0 force.
  *
+ * Support percentage is increased by fixed RaiseIncrementPercentage, or by
+ * increment calculated by RaiseLowerProfile from measured hardpoint forces and
+ * force actuators following errors when the profile is enabled. Time spent in
+ * raising phases is logged.
+ *
  * @see PositionController
  * @see MirrorLowerController
  */
 class MirrorRaiseController {
 public:
+    /**
+     * Raising phases, timed by PhaseTimer.
+     */
+    enum Phases {
+        WAIT_AIR_PRESSURE,
+        SUPPORT_TRANSFER,
+        MOVE_TO_REFERENCE,
+        HP_SETTLE,
+        PAUSED,
+        PHASES_COUNT
+    };
     /**
      * Construct mirror controller.
      *
@@ -97,8 +115,11 @@ public:
     void pauseM1M3Raising();
     void resumeM1M3Raising();
 
+    const PhaseTimer& getPhases() const { return _phases; }
+
 private:
     bool _check_hp_ready();
+    void _enterPhase(Phases phase);
 
     PositionController* _positionController;
     ForceController* _forceController;
@@ -120,6 +141,9 @@ private:
     bool _raisingPaused;
 
     HpInRangeCounter _hp_in_range[HP_COUNT];
+
+    RaiseLowerProfile _profile;
+    PhaseTimer _phases;
 };
 
 } /* namespace SS */
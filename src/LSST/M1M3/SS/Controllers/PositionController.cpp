@@ -68,17 +68,23 @@ PositionController::PositionController() {
     _hardpoint_actuator_data = M1M3SSPublisher::instance().getHardpointActuatorData();
     _hardpointActuatorState = M1M3SSPublisher::instance().getEventHardpointActuatorState();
     _hardpointInfo = M1M3SSPublisher::instance().getEventHardpointActuatorInfo();
+    _hardpointActuatorStateTracker = M1M3SSPublisher::instance().getEventHardpointActuatorStateTracker();
+    _kinematics.load(_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement,
+                     _hardpoint_actuator_settings->HardpointDisplacementToMirrorPosition,
+                     _hardpoint_actuator_settings->micrometersPerStep,
+                     _hardpoint_actuator_settings->micrometersPerEncoder);
     _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
     for (int i = 0; i < HP_COUNT; i++) {
-        _hardpointActuatorState->motionState[i] = MTM1M3_shared_HardpointActuatorMotionState_Standby;
+        _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[i],
+                                            MTM1M3_shared_HardpointActuatorMotionState_Standby);
         _hardpoint_actuator_data->stepsQueued[i] = 0;
         _hardpoint_actuator_data->stepsCommanded[i] = 0;
-        _scaledMaxStepsPerLoop[i] = _position_controller_settings->maxStepsPerLoop;
         _targetEncoderValues[i] = 0;
         _stableEncoderCount[i] = 0;
         _unstableEncoderCount[i] = 0;
     }
     _reset_wait_compression_tension();
+    _raise_lower_force_utilization = 0;
 
     M1M3SSPublisher::instance().logHardpointActuatorState();
 }
@@ -95,7 +101,8 @@ bool PositionController::enableChaseAll() {
     }
     _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
     for (int i = 0; i < HP_COUNT; i++) {
-        _hardpointActuatorState->motionState[i] = MTM1M3_shared_HardpointActuatorMotionState_Chasing;
+        _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[i],
+                                            MTM1M3_shared_HardpointActuatorMotionState_Chasing);
         _last_encoder_count[i] = _hardpoint_actuator_data->encoder[i];
     }
     M1M3SSPublisher::instance().tryLogHardpointActuatorState();
@@ -106,7 +113,8 @@ void PositionController::disableChaseAll() {
     SPDLOG_INFO("PositionController: disableChaseAll()");
     _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
     for (int i = 0; i < HP_COUNT; i++) {
-        _hardpointActuatorState->motionState[i] = MTM1M3_shared_HardpointActuatorMotionState_Standby;
+        _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[i],
+                                            MTM1M3_shared_HardpointActuatorMotionState_Standby);
     }
     M1M3SSPublisher::instance().tryLogHardpointActuatorState();
 }
@@ -122,45 +130,37 @@ void PositionController::startLower() {
     _reset_wait_compression_tension();
 }
 
-class PositionLimitTrigger : public LimitTrigger<float, float, float, wait_hardpoint_t, wait_hardpoint_t> {
+class PositionLimitTrigger
+        : public LimitTrigger<PositionLimitTrigger, float, float, float, wait_hardpoint_t, wait_hardpoint_t> {
 public:
-    PositionLimitTrigger(int hp) {
-        _hp = hp;
-        _counter = 0;
+    PositionLimitTrigger(int hp) { _hp = hp; }
+
+    void reset() {
+        if (_occurrences.count() > 0) {
+            SPDLOG_INFO("Hardpoint {} back nominal after {} failures", _hp, _occurrences.restart());
+        }
     }
 
 protected:
-    bool trigger() override {
-        _counter++;
-        // problems are reported  when accumulated counter reaches those levels
-        static int levels[4] = {1, 200, 500, 10000};
-        for (int i = 0; i < 4; i++)
-            if (levels[i] == _counter) return true;
-        return ((_counter % levels[3]) == 0);
-    }
+    friend LimitTrigger;
+
+    bool trigger() { return _occurrences.next(); }
 
     void execute(float low_limit, float high_limit, float measured, wait_hardpoint_t wait_tension,
-                 wait_hardpoint_t wait_compression) override {
+                 wait_hardpoint_t wait_compression) {
         if (wait_tension == WAITING || wait_compression == WAITING) {
-            _counter = 0;
+            _occurrences.restart();
         } else {
             SPDLOG_WARN(
                     "Violated hardpoint {} measured force {} ({}th occurence), "
                     "limit {} to {}",
-                    _hp, measured, _counter, low_limit, high_limit);
-        }
-    }
-
-    void reset() override {
-        if (_counter > 0) {
-            SPDLOG_INFO("Hardpoint {} back nominal after {} failures", _hp, _counter);
-            _counter = 0;
+                    _hp, measured, _occurrences.count(), low_limit, high_limit);
         }
     }
 
 private:
     int _hp;
-    int _counter;
+    OccurrenceCounter<10000> _occurrences;
 };
 
 bool PositionController::hpRaiseLowerForcesInTolerance(bool raise) {
@@ -203,6 +203,17 @@ bool PositionController::hpRaiseLowerForcesInTolerance(bool raise) {
 
         in_range = Range::InRange(low_limit, high_limit, measured_force);
 
+        // force relative to the limit in the force direction, used to adapt
+        // raise/lower support increment
+        float limit = measured_force < 0 ? low_limit : high_limit;
+        float utilization = 0;
+        if (measured_force != 0) {
+            utilization = limit * measured_force > 0 ? measured_force / limit : 1;
+        }
+        if (hp == 0 || utilization > _raise_lower_force_utilization) {
+            _raise_lower_force_utilization = utilization;
+        }
+
         raiseLowerInfo->setHPWait(hp, !in_range);
 
         // tread HP 2 and 5 (index 1 and 4) differently when raising/lowering below some elevation
@@ -252,8 +263,9 @@ bool PositionController::_hp_raise_lower_forces_in_tolerance_tension(int hp, boo
                 }
 
                 if (measured_force <= low_limit) {
-                    _hardpointActuatorState->motionState[hp] =
-                            MTM1M3_shared_HardpointActuatorMotionState_WaitingTension;
+                    _hardpointActuatorStateTracker->set(
+                            _hardpointActuatorState->motionState[hp],
+                            MTM1M3_shared_HardpointActuatorMotionState_WaitingTension);
                     _hardpoint_actuator_data->stepsCommanded[hp] = 0;
                     _wait_tension[hp] = WAITING;
                     M1M3SSPublisher::instance().logHardpointActuatorState();
@@ -276,7 +288,8 @@ bool PositionController::_hp_raise_lower_forces_in_tolerance_tension(int hp, boo
                     _hardpoint_actuator_settings->inRangeReadoutsToChaseFromWaitingCompression) {
                     return false;
                 }
-                _hardpointActuatorState->motionState[hp] = MTM1M3_shared_HardpointActuatorMotionState_Chasing;
+                _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[hp],
+                                                    MTM1M3_shared_HardpointActuatorMotionState_Chasing);
                 _raising_lowering_in_range_samples[hp] = 0;
                 M1M3SSPublisher::instance().logHardpointActuatorState();
                 SPDLOG_INFO("HP {} back in safe tension range, continue chasing", hp + 1);
@@ -310,8 +323,9 @@ bool PositionController::_hp_raise_lower_forces_in_tolerance_compression(int hp,
                 }
 
                 if (measured_force >= high_limit) {
-                    _hardpointActuatorState->motionState[hp] =
-                            MTM1M3_shared_HardpointActuatorMotionState_WaitingCompression;
+                    _hardpointActuatorStateTracker->set(
+                            _hardpointActuatorState->motionState[hp],
+                            MTM1M3_shared_HardpointActuatorMotionState_WaitingCompression);
                     _hardpoint_actuator_data->stepsCommanded[hp] = 0;
                     _wait_compression[hp] = WAITING;
                     M1M3SSPublisher::instance().logHardpointActuatorState();
@@ -334,7 +348,8 @@ bool PositionController::_hp_raise_lower_forces_in_tolerance_compression(int hp,
                     _hardpoint_actuator_settings->inRangeReadoutsToChaseFromWaitingCompression) {
                     return false;
                 }
-                _hardpointActuatorState->motionState[hp] = MTM1M3_shared_HardpointActuatorMotionState_Chasing;
+                _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[hp],
+                                                    MTM1M3_shared_HardpointActuatorMotionState_Chasing);
                 _raising_lowering_in_range_samples[hp] = 0;
                 M1M3SSPublisher::instance().logHardpointActuatorState();
                 SPDLOG_INFO("HP {} back in safe compression range, continue chasing", hp + 1);
@@ -365,25 +380,10 @@ bool PositionController::moveHardpoint(int32_t steps, int hpIndex) {
     if (steps == 0) {
         return false;
     }
-    _hardpoint_actuator_data->stepsQueued[hpIndex] = steps;
-    _hardpointActuatorState->motionState[hpIndex] = MTM1M3_shared_HardpointActuatorMotionState_Stepping;
-
-    double loopCycles[6];
-    double maxLoopCycles = 0;
-    for (int i = 0; i < HP_COUNT; i++) {
-        loopCycles[i] = abs(_hardpoint_actuator_data->stepsQueued[i]) /
-                        (double)_position_controller_settings->maxStepsPerLoop;
-        if (loopCycles[i] > maxLoopCycles) {
-            maxLoopCycles = loopCycles[i];
-        }
-    }
-    for (int i = 0; i < HP_COUNT; ++i) {
-        _scaledMaxStepsPerLoop[i] =
-                (int32_t)(_position_controller_settings->maxStepsPerLoop / (maxLoopCycles / loopCycles[i]));
-        if (_scaledMaxStepsPerLoop[i] == 0) {
-            _scaledMaxStepsPerLoop[i] = 1;
-        }
-    }
+    _trajectory.setHardpoint(hpIndex, steps, _position_controller_settings->maxStepsPerLoop);
+    _hardpoint_actuator_data->stepsQueued[hpIndex] = _trajectory.remaining(hpIndex);
+    _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[hpIndex],
+                                        MTM1M3_shared_HardpointActuatorMotionState_Stepping);
     M1M3SSPublisher::instance().tryLogHardpointActuatorState();
     return true;
 }
@@ -406,24 +406,18 @@ bool PositionController::move(const std::vector<int>& steps) {
         return false;
     }
     _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
-    double loopCycles[6];
-    double maxLoopCycles = 0;
+    int32_t segment[HP_COUNT];
     for (int i = 0; i < HP_COUNT; i++) {
-        _hardpoint_actuator_data->stepsQueued[i] = steps[i];
-        _hardpointActuatorState->motionState[i] =
-                steps[i] != 0 ? MTM1M3_shared_HardpointActuatorMotionState_Stepping
-                              : MTM1M3_shared_HardpointActuatorMotionState_Standby;
-        loopCycles[i] = abs(steps[i]) / (double)_position_controller_settings->maxStepsPerLoop;
-        if (loopCycles[i] > maxLoopCycles) {
-            maxLoopCycles = loopCycles[i];
-        }
+        segment[i] = steps[i];
     }
-    for (int i = 0; i < HP_COUNT; ++i) {
-        _scaledMaxStepsPerLoop[i] =
-                (int32_t)(_position_controller_settings->maxStepsPerLoop / (maxLoopCycles / loopCycles[i]));
-        if (_scaledMaxStepsPerLoop[i] == 0) {
-            _scaledMaxStepsPerLoop[i] = 1;
-        }
+    _trajectory.clear();
+    _trajectory.addSegment(segment, _position_controller_settings->maxStepsPerLoop);
+    for (int i = 0; i < HP_COUNT; i++) {
+        _hardpoint_actuator_data->stepsQueued[i] = _trajectory.remaining(i);
+        _hardpointActuatorStateTracker->set(
+                _hardpointActuatorState->motionState[i],
+                steps[i] != 0 ? MTM1M3_shared_HardpointActuatorMotionState_Stepping
+                              : MTM1M3_shared_HardpointActuatorMotionState_Standby);
     }
     M1M3SSPublisher::instance().tryLogHardpointActuatorState();
     return true;
@@ -446,63 +440,25 @@ bool PositionController::moveToEncoder(const std::vector<int>& encoderValues) {
          encoderValues[5] != _hardpoint_actuator_data->encoder[5])) {
         return false;
     }
-    _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
-    double loopCycles[6];
-    double maxLoopCycles = 0;
+    int32_t deltaEncoder[HP_COUNT];
     for (int i = 0; i < HP_COUNT; i++) {
         _targetEncoderValues[i] = encoderValues[i];
-        _last_encoder_count[i] = _hardpoint_actuator_data->encoder[i];
-        _stableEncoderCount[i] = 0;
-        _unstableEncoderCount[i] = 0;
-        int deltaEncoder = _targetEncoderValues[i] - _hardpoint_actuator_data->encoder[i];
-        // If we overshoot our target encoder value we have to clear what appears to
-        // be quite a bit of backlash So lets not overshoot our target
-        if (deltaEncoder > 0) {
-            deltaEncoder -= 4;
-            // We are already very close to our target so lets not do anything during
-            // the quick positioning phase
-            if (deltaEncoder < 0) {
-                deltaEncoder = 0;
-            }
-        } else if (deltaEncoder < 0) {
-            deltaEncoder += 4;
-            if (deltaEncoder > 0) {
-                deltaEncoder = 0;
-            }
-        }
-        _hardpoint_actuator_data->stepsQueued[i] =
-                deltaEncoder * _position_controller_settings->encoderToStepsCoefficient;
-        _hardpointActuatorState->motionState[i] =
-                _hardpoint_actuator_data->stepsQueued[i] != 0
-                        ? MTM1M3_shared_HardpointActuatorMotionState_QuickPositioning
-                        : MTM1M3_shared_HardpointActuatorMotionState_Standby;
-        loopCycles[i] = abs(_hardpoint_actuator_data->stepsQueued[i]) /
-                        (double)_position_controller_settings->maxStepsPerLoop;
-        if (loopCycles[i] > maxLoopCycles) {
-            maxLoopCycles = loopCycles[i];
-        }
-    }
-    for (int i = 0; i < HP_COUNT; ++i) {
-        _scaledMaxStepsPerLoop[i] =
-                (int32_t)(_position_controller_settings->maxStepsPerLoop / (maxLoopCycles / loopCycles[i]));
-        if (_scaledMaxStepsPerLoop[i] == 0) {
-            _scaledMaxStepsPerLoop[i] = 1;
-        }
+        deltaEncoder[i] = _targetEncoderValues[i] - _hardpoint_actuator_data->encoder[i];
     }
-    M1M3SSPublisher::instance().tryLogHardpointActuatorState();
+    _trajectory.clear();
+    _start_positioning(deltaEncoder);
     return true;
 }
 
 bool PositionController::moveToAbsolute(double x, double y, double z, double rX, double rY, double rZ) {
     SPDLOG_INFO("PositionController: moveToAbsolute({:f}, {:f}, {:f}, {:f}, {:f}, {:f})", x, y, z, rX, rY,
                 rZ);
-    int32_t steps[6];
-    _convert_to_steps(steps, x, y, z, rX, rY, rZ);
-    std::vector<int> encoderValues(6, 0);
-    double stepsToEncoder = _hardpoint_actuator_settings->micrometersPerStep /
-                            _hardpoint_actuator_settings->micrometersPerEncoder;
+    double position[6] = {x, y, z, rX, rY, rZ};
+    int32_t steps[HP_COUNT];
+    _kinematics.positionToSteps(position, steps);
+    std::vector<int> encoderValues(HP_COUNT, 0);
     for (int i = 0; i < HP_COUNT; ++i) {
-        encoderValues[i] = _hardpointInfo->referencePosition[i] + steps[i] * stepsToEncoder;
+        encoderValues[i] = _hardpointInfo->referencePosition[i] + steps[i] * _kinematics.getStepsToEncoder();
     }
     return this->moveToEncoder(encoderValues);
 }
@@ -520,13 +476,12 @@ bool PositionController::moveToLowerPosition() {
 
 bool PositionController::translate(double x, double y, double z, double rX, double rY, double rZ) {
     SPDLOG_INFO("PositionController: translate({:f}, {:f}, {:f}, {:f}, {:f}, {:f})", x, y, z, rX, rY, rZ);
-    int32_t steps[6];
-    _convert_to_steps(steps, x, y, z, rX, rY, rZ);
-    std::vector<int> encoderValues(6, 0);
-    double stepsToEncoder = _hardpoint_actuator_settings->micrometersPerStep /
-                            _hardpoint_actuator_settings->micrometersPerEncoder;
+    double offset[6] = {x, y, z, rX, rY, rZ};
+    int32_t steps[HP_COUNT];
+    _kinematics.positionToSteps(offset, steps);
+    std::vector<int> encoderValues(HP_COUNT, 0);
     for (int i = 0; i < HP_COUNT; ++i) {
-        encoderValues[i] = _hardpoint_actuator_data->encoder[i] + steps[i] * stepsToEncoder;
+        encoderValues[i] = _hardpoint_actuator_data->encoder[i] + steps[i] * _kinematics.getStepsToEncoder();
     }
     return this->moveToEncoder(encoderValues);
 }
@@ -536,13 +491,17 @@ void PositionController::stopMotion(int hardpointIndex) {
     _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
     if (hardpointIndex < 0) {
         for (int i = 0; i < HP_COUNT; i++) {
+            _trajectory.stop(i);
             _hardpoint_actuator_data->stepsQueued[i] = 0;
-            _hardpointActuatorState->motionState[i] = MTM1M3_shared_HardpointActuatorMotionState_Standby;
+            _hardpointActuatorStateTracker->set(_hardpointActuatorState->motionState[i],
+                                                MTM1M3_shared_HardpointActuatorMotionState_Standby);
         }
     } else {
+        _trajectory.stop(hardpointIndex);
         _hardpoint_actuator_data->stepsQueued[hardpointIndex] = 0;
-        _hardpointActuatorState->motionState[hardpointIndex] =
-                MTM1M3_shared_HardpointActuatorMotionState_Standby;
+        _hardpointActuatorStateTracker->set(
+                _hardpointActuatorState->motionState[hardpointIndex],
+                MTM1M3_shared_HardpointActuatorMotionState_Standby);
     }
 
     M1M3SSPublisher::instance().tryLogHardpointActuatorState();
@@ -571,31 +530,27 @@ void PositionController::updateSteps() {
             }
             case MTM1M3_shared_HardpointActuatorMotionState_Stepping: {
                 _check_following_error(i);
-                int32_t moveSteps =
-                        Range::CoerceIntoRange<int32_t>(-_scaledMaxStepsPerLoop[i], _scaledMaxStepsPerLoop[i],
-                                                        _hardpoint_actuator_data->stepsQueued[i]);
-                _hardpoint_actuator_data->stepsQueued[i] -= moveSteps;
+                int32_t moveSteps = _trajectory.next(i);
+                _hardpoint_actuator_data->stepsQueued[i] = _trajectory.remaining(i);
                 _hardpoint_actuator_data->stepsCommanded[i] = (int16_t)moveSteps;
-                if (_hardpoint_actuator_data->stepsQueued[i] == 0 &&
-                    _hardpoint_actuator_data->stepsCommanded[i] == 0) {
+                if (moveSteps == 0 && _trajectory.finished(i)) {
                     publishState = true;
-                    _hardpointActuatorState->motionState[i] =
-                            MTM1M3_shared_HardpointActuatorMotionState_Standby;
+                    _hardpointActuatorStateTracker->set(
+                            _hardpointActuatorState->motionState[i],
+                            MTM1M3_shared_HardpointActuatorMotionState_Standby);
                 }
                 break;
             }
             case MTM1M3_shared_HardpointActuatorMotionState_QuickPositioning: {
                 _check_following_error(i);
-                int32_t moveSteps =
-                        Range::CoerceIntoRange<int32_t>(-_scaledMaxStepsPerLoop[i], _scaledMaxStepsPerLoop[i],
-                                                        _hardpoint_actuator_data->stepsQueued[i]);
-                _hardpoint_actuator_data->stepsQueued[i] -= moveSteps;
+                int32_t moveSteps = _trajectory.next(i);
+                _hardpoint_actuator_data->stepsQueued[i] = _trajectory.remaining(i);
                 _hardpoint_actuator_data->stepsCommanded[i] = (int16_t)moveSteps;
-                if (_hardpoint_actuator_data->stepsQueued[i] == 0 &&
-                    _hardpoint_actuator_data->stepsCommanded[i] == 0) {
+                if (moveSteps == 0 && _trajectory.finished(i)) {
                     publishState = true;
-                    _hardpointActuatorState->motionState[i] =
-                            MTM1M3_shared_HardpointActuatorMotionState_FinePositioning;
+                    _hardpointActuatorStateTracker->set(
+                            _hardpointActuatorState->motionState[i],
+                            MTM1M3_shared_HardpointActuatorMotionState_FinePositioning);
                 }
                 break;
             }
@@ -627,8 +582,9 @@ void PositionController::updateSteps() {
                 if (deltaEncoder == 0 && _stableEncoderCount[i] >= 2) {
                     publishState = true;
                     _hardpoint_actuator_data->stepsCommanded[i] = 0;
-                    _hardpointActuatorState->motionState[i] =
-                            MTM1M3_shared_HardpointActuatorMotionState_Standby;
+                    _hardpointActuatorStateTracker->set(
+                            _hardpointActuatorState->motionState[i],
+                            MTM1M3_shared_HardpointActuatorMotionState_Standby);
                 }
                 break;
             }
@@ -684,59 +640,40 @@ void PositionController::checkLimits(int hp) {
     _safety_controller->positionControllerNotifyLimitHigh(hp, high_limit);
 }
 
-void PositionController::_convert_to_steps(int32_t* steps, double x, double y, double z, double rX, double rY,
-                                           double rZ) {
-    // The reason for defining HP 3 first (index 2) is due to the matrix. Review
-    // the MirrorPositionToHardpointDisplacementTable for a description of the
-    // matrix.
-    steps[2] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[0] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[1] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[2] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[3] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[4] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[5] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
-    steps[3] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[6] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[7] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[8] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[9] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[10] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[11] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
-    steps[4] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[12] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[13] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[14] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[15] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[16] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[17] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
-    steps[5] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[18] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[19] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[20] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[21] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[22] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[23] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
-    steps[0] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[24] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[25] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[26] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[27] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[28] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[29] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
-    steps[1] = (_hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[30] * x +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[31] * y +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[32] * z +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[33] * rX +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[34] * rY +
-                _hardpoint_actuator_settings->MirrorPositionToHardpointDisplacement[35] * rZ) *
-               (MILLIMETERS_PER_METER * MICROMETERS_PER_MILLIMETER /
-                _hardpoint_actuator_settings->micrometersPerStep);
+void PositionController::_start_positioning(const int32_t* lastSegment) {
+    _hardpointActuatorState->timestamp = M1M3SSPublisher::instance().getTimestamp();
+    int32_t steps[HP_COUNT];
+    for (int i = 0; i < HP_COUNT; i++) {
+        _last_encoder_count[i] = _hardpoint_actuator_data->encoder[i];
+        _stableEncoderCount[i] = 0;
+        _unstableEncoderCount[i] = 0;
+        int32_t deltaEncoder = lastSegment[i];
+        // If we overshoot our target encoder value we have to clear what appears to
+        // be quite a bit of backlash So lets not overshoot our target
+        if (deltaEncoder > 0) {
+            deltaEncoder -= 4;
+            // We are already very close to our target so lets not do anything during
+            // the quick positioning phase
+            if (deltaEncoder < 0) {
+                deltaEncoder = 0;
+            }
+        } else if (deltaEncoder < 0) {
+            deltaEncoder += 4;
+            if (deltaEncoder > 0) {
+                deltaEncoder = 0;
+            }
+        }
+        steps[i] = deltaEncoder * _position_controller_settings->encoderToStepsCoefficient;
+    }
+    _trajectory.addSegment(steps, _position_controller_settings->maxStepsPerLoop);
+    for (int i = 0; i < HP_COUNT; i++) {
+        _hardpoint_actuator_data->stepsQueued[i] = _trajectory.remaining(i);
+        _hardpointActuatorStateTracker->set(
+                _hardpointActuatorState->motionState[i],
+                _trajectory.finished(i) ? MTM1M3_shared_HardpointActuatorMotionState_Standby
+                                        : MTM1M3_shared_HardpointActuatorMotionState_QuickPositioning);
+    }
+    M1M3SSPublisher::instance().tryLogHardpointActuatorState();
 }
 
 void PositionController::_check_following_error(int hp) {
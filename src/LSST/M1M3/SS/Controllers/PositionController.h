@@ -26,7 +26,12 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include <vector>
+
+#include <EventChangeTracker.h>
 #include <HardpointActuatorSettings.h>
+#include <HardpointKinematics.h>
+#include <HardpointTrajectory.h>
 #include <PositionControllerSettings.h>
 #include <SafetyController.h>
 #include <Units.h>
@@ -61,6 +66,10 @@ typedef enum { NO_WAIT, CAN_WAIT, WAITING, ALREADY_WAITED } wait_hardpoint_t;
  * Small increments send to the ILC are stored in SAL/DDS
  * MTM1M3_hardpoint_actuator_dataC stepsCommanded. Target steps are stored in
  * stepsQueued.
+ *
+ * Moves are planned when commanded - mirror positions are converted to steps
+ * with HardpointKinematics, and steps are split into per-cycle quotas stored
+ * in HardpointTrajectory. updateSteps only retrieves the precomputed quotas.
  */
 class PositionController {
 public:
@@ -74,6 +83,11 @@ public:
     int getRaiseTimeout() { return _position_controller_settings->raiseTimeout; }
     int getLowerTimeout() { return _position_controller_settings->lowerTimeout; }
 
+    /**
+     * Returns hardpoint kinematics, loaded from HardpointActuatorSettings.
+     */
+    const HardpointKinematics& getKinematics() const { return _kinematics; }
+
     bool enableChaseAll();
     void disableChaseAll();
 
@@ -90,6 +104,13 @@ public:
      * @return true if all hardpoint forces are within tolerance
      */
     bool hpRaiseLowerForcesInTolerance(bool raise);
+
+    /**
+     * Returns the largest ratio of hardpoint measured force to the force limit
+     * used in the last hpRaiseLowerForcesInTolerance call. 0 for no force, 1
+     * on the limit.
+     */
+    float getRaiseLowerForceUtilization() { return _raise_lower_force_utilization; }
     bool motionComplete();
 
     /**
@@ -127,6 +148,7 @@ public:
      * @return false when move cannot be performed
      */
     bool moveToAbsolute(double x, double y, double z, double rX, double rY, double rZ);
+
     bool moveToReferencePosition();
 
     /**
@@ -160,11 +182,9 @@ public:
      * * **Chasing**: MTM1M3_hardpoint_actuator_dataC measuredForce is multiplied
      * by PositionControllerSettings::ForceToStepsCoefficient and coerced into
      * ±PositionControllerSettings::MaxStepsPerLoop.
-     * * **Stepping**: executes steps so stepsQueued are decreased, ultimately
-     * equal to 0. MTM1M3_hardpoint_actuator_dataC stepsQueued are coerced into
-     * ±_scaledMaxStepsPerLoop[HP] and send to HP. stepsQueued are decreased by
-     * stepsCommanded. If coerced value == 0, HP is transitioned into Standby
-     * state.
+     * * **Stepping**: commands next precomputed trajectory quota. stepsQueued
+     * holds sum of the remaining quotas. When trajectory is finished, HP is
+     * transitioned into Standby state.
      * * **QuickPositioning**: same as **Stepping**, but transition into
      * FinePositioning state when finished.
      * * **FinePositioning**: finish movement by removing any residual between
@@ -186,7 +206,7 @@ public:
     void checkLimits(int hp);
 
 private:
-    void _convert_to_steps(int32_t* steps, double x, double y, double z, double rX, double rY, double rZ);
+    void _start_positioning(const int32_t* lastSegment);
 
     void _check_following_error(int hp);
 
@@ -203,8 +223,11 @@ private:
     MTM1M3_hardpointActuatorDataC* _hardpoint_actuator_data;
     MTM1M3_logevent_hardpointActuatorStateC* _hardpointActuatorState;
     MTM1M3_logevent_hardpointActuatorInfoC* _hardpointInfo;
+    EventChangeTracker* _hardpointActuatorStateTracker;
+
+    HardpointKinematics _kinematics;
+    HardpointTrajectory _trajectory;
 
-    int32_t _scaledMaxStepsPerLoop[HP_COUNT];
     int32_t _targetEncoderValues[HP_COUNT];
     int32_t _stableEncoderCount[HP_COUNT];
     int32_t _unstableEncoderCount[HP_COUNT];
@@ -213,6 +236,7 @@ private:
     wait_hardpoint_t _wait_tension[HP_COUNT];
     wait_hardpoint_t _wait_compression[HP_COUNT];
     uint16_t _raising_lowering_in_range_samples[HP_COUNT];
+    float _raise_lower_force_utilization;
 
     SafetyController* _safety_controller;
 };
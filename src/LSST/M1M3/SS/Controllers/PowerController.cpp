@@ -42,6 +42,8 @@ PowerController::PowerController(SafetyController* safetyController) {
     _powerSupplyData = M1M3SSPublisher::instance().getPowerSupplyData();
     _powerStatus = M1M3SSPublisher::instance().getEventPowerStatus();
     _powerWarning = M1M3SSPublisher::instance().getEventPowerWarning();
+    _powerStatusTracker = M1M3SSPublisher::instance().getEventPowerStatusTracker();
+    _powerWarningTracker = M1M3SSPublisher::instance().getEventPowerWarningTracker();
 
     _lastPowerTimestamp = 0;
 }
@@ -56,32 +58,48 @@ void PowerController::processData() {
         _lastPowerTimestamp = fpgaData->PowerSupplyTimestamp;
         double timestamp = Timestamp::fromFPGA(fpgaData->PowerSupplyTimestamp);
         _powerStatus->timestamp = timestamp;
-        _powerStatus->auxPowerNetworkAOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::AuxA) != 0;
-        _powerStatus->auxPowerNetworkBOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::AuxB) != 0;
-        _powerStatus->auxPowerNetworkCOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::AuxC) != 0;
-        _powerStatus->auxPowerNetworkDOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::AuxD) != 0;
-        _powerStatus->powerNetworkAOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::A) != 0;
-        _powerStatus->powerNetworkBOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::B) != 0;
-        _powerStatus->powerNetworkCOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::C) != 0;
-        _powerStatus->powerNetworkDOutputOn = (fpgaData->PowerSupplyStates & PowerSupply::D) != 0;
+        _powerStatusTracker->set(_powerStatus->auxPowerNetworkAOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::AuxA) != 0);
+        _powerStatusTracker->set(_powerStatus->auxPowerNetworkBOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::AuxB) != 0);
+        _powerStatusTracker->set(_powerStatus->auxPowerNetworkCOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::AuxC) != 0);
+        _powerStatusTracker->set(_powerStatus->auxPowerNetworkDOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::AuxD) != 0);
+        _powerStatusTracker->set(_powerStatus->powerNetworkAOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::A) != 0);
+        _powerStatusTracker->set(_powerStatus->powerNetworkBOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::B) != 0);
+        _powerStatusTracker->set(_powerStatus->powerNetworkCOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::C) != 0);
+        _powerStatusTracker->set(_powerStatus->powerNetworkDOutputOn,
+                                 (fpgaData->PowerSupplyStates & PowerSupply::D) != 0);
         M1M3SSPublisher::instance().tryLogPowerStatus();
         _powerWarning->timestamp = timestamp;
-        _powerWarning->auxPowerNetworkAOutputMismatch =
-                _powerStatus->auxPowerNetworkACommandedOn != _powerStatus->auxPowerNetworkAOutputOn;
-        _powerWarning->auxPowerNetworkBOutputMismatch =
-                _powerStatus->auxPowerNetworkBCommandedOn != _powerStatus->auxPowerNetworkBOutputOn;
-        _powerWarning->auxPowerNetworkCOutputMismatch =
-                _powerStatus->auxPowerNetworkCCommandedOn != _powerStatus->auxPowerNetworkCOutputOn;
-        _powerWarning->auxPowerNetworkDOutputMismatch =
-                _powerStatus->auxPowerNetworkDCommandedOn != _powerStatus->auxPowerNetworkDOutputOn;
-        _powerWarning->powerNetworkAOutputMismatch =
-                _powerStatus->powerNetworkACommandedOn != _powerStatus->powerNetworkAOutputOn;
-        _powerWarning->powerNetworkBOutputMismatch =
-                _powerStatus->powerNetworkBCommandedOn != _powerStatus->powerNetworkBOutputOn;
-        _powerWarning->powerNetworkCOutputMismatch =
-                _powerStatus->powerNetworkCCommandedOn != _powerStatus->powerNetworkCOutputOn;
-        _powerWarning->powerNetworkDOutputMismatch =
-                _powerStatus->powerNetworkDCommandedOn != _powerStatus->powerNetworkDOutputOn;
+        _powerWarningTracker->set(
+                _powerWarning->auxPowerNetworkAOutputMismatch,
+                _powerStatus->auxPowerNetworkACommandedOn != _powerStatus->auxPowerNetworkAOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->auxPowerNetworkBOutputMismatch,
+                _powerStatus->auxPowerNetworkBCommandedOn != _powerStatus->auxPowerNetworkBOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->auxPowerNetworkCOutputMismatch,
+                _powerStatus->auxPowerNetworkCCommandedOn != _powerStatus->auxPowerNetworkCOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->auxPowerNetworkDOutputMismatch,
+                _powerStatus->auxPowerNetworkDCommandedOn != _powerStatus->auxPowerNetworkDOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->powerNetworkAOutputMismatch,
+                _powerStatus->powerNetworkACommandedOn != _powerStatus->powerNetworkAOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->powerNetworkBOutputMismatch,
+                _powerStatus->powerNetworkBCommandedOn != _powerStatus->powerNetworkBOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->powerNetworkCOutputMismatch,
+                _powerStatus->powerNetworkCCommandedOn != _powerStatus->powerNetworkCOutputOn);
+        _powerWarningTracker->set(
+                _powerWarning->powerNetworkDOutputMismatch,
+                _powerStatus->powerNetworkDCommandedOn != _powerStatus->powerNetworkDOutputOn);
         M1M3SSPublisher::instance().tryLogPowerWarning();
     }
     double timestamp = M1M3SSPublisher::instance().getTimestamp();
@@ -105,14 +123,14 @@ void PowerController::processData() {
 
 void PowerController::setBothPowerNetworks(bool on) {
     SPDLOG_INFO("PowerController: setBothPowerNetworks({:d})", on);
-    _powerStatus->powerNetworkACommandedOn = on;
-    _powerStatus->powerNetworkBCommandedOn = on;
-    _powerStatus->powerNetworkCCommandedOn = on;
-    _powerStatus->powerNetworkDCommandedOn = on;
-    _powerStatus->auxPowerNetworkACommandedOn = on;
-    _powerStatus->auxPowerNetworkBCommandedOn = on;
-    _powerStatus->auxPowerNetworkCCommandedOn = on;
-    _powerStatus->auxPowerNetworkDCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkACommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkBCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkCCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkDCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkACommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkBCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkCCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkDCommandedOn, on);
     uint16_t buffer[16] = {DCPowerNetworkAOn,    (uint16_t)_powerStatus->powerNetworkACommandedOn,
                            DCPowerNetworkBOn,    (uint16_t)_powerStatus->powerNetworkBCommandedOn,
                            DCPowerNetworkCOn,    (uint16_t)_powerStatus->powerNetworkCCommandedOn,
@@ -127,10 +145,10 @@ void PowerController::setBothPowerNetworks(bool on) {
 
 void PowerController::setAllPowerNetworks(bool on) {
     SPDLOG_INFO("PowerController: setAllPowerNetworks({:d})", on);
-    _powerStatus->powerNetworkACommandedOn = on;
-    _powerStatus->powerNetworkBCommandedOn = on;
-    _powerStatus->powerNetworkCCommandedOn = on;
-    _powerStatus->powerNetworkDCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkACommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkBCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkCCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->powerNetworkDCommandedOn, on);
     uint16_t buffer[8] = {DCPowerNetworkAOn, (uint16_t)_powerStatus->powerNetworkACommandedOn,
                           DCPowerNetworkBOn, (uint16_t)_powerStatus->powerNetworkBCommandedOn,
                           DCPowerNetworkCOn, (uint16_t)_powerStatus->powerNetworkCCommandedOn,
@@ -141,7 +159,7 @@ void PowerController::setAllPowerNetworks(bool on) {
 
 void PowerController::setPowerNetworkA(bool on) {
     SPDLOG_INFO("PowerController: setPowerNetworkA({:d})", on);
-    _powerStatus->powerNetworkACommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkACommandedOn, on);
     uint16_t buffer[2] = {DCPowerNetworkAOn, (uint16_t)_powerStatus->powerNetworkACommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -149,7 +167,7 @@ void PowerController::setPowerNetworkA(bool on) {
 
 void PowerController::setPowerNetworkB(bool on) {
     SPDLOG_INFO("PowerController: setPowerNetworkB({:d})", on);
-    _powerStatus->powerNetworkBCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkBCommandedOn, on);
     uint16_t buffer[2] = {DCPowerNetworkBOn, (uint16_t)_powerStatus->powerNetworkBCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -157,7 +175,7 @@ void PowerController::setPowerNetworkB(bool on) {
 
 void PowerController::setPowerNetworkC(bool on) {
     SPDLOG_INFO("PowerController: setPowerNetworkC({:d})", on);
-    _powerStatus->powerNetworkCCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkCCommandedOn, on);
     uint16_t buffer[2] = {DCPowerNetworkCOn, (uint16_t)_powerStatus->powerNetworkCCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -165,7 +183,7 @@ void PowerController::setPowerNetworkC(bool on) {
 
 void PowerController::setPowerNetworkD(bool on) {
     SPDLOG_INFO("PowerController: setPowerNetworkD({:d})", on);
-    _powerStatus->powerNetworkDCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->powerNetworkDCommandedOn, on);
     uint16_t buffer[2] = {DCPowerNetworkDOn, (uint16_t)_powerStatus->powerNetworkDCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -173,10 +191,10 @@ void PowerController::setPowerNetworkD(bool on) {
 
 void PowerController::setAllAuxPowerNetworks(bool on) {
     SPDLOG_INFO("PowerController: setAllAuxPowerNetworks({:d})", on);
-    _powerStatus->auxPowerNetworkACommandedOn = on;
-    _powerStatus->auxPowerNetworkBCommandedOn = on;
-    _powerStatus->auxPowerNetworkCCommandedOn = on;
-    _powerStatus->auxPowerNetworkDCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkACommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkBCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkCCommandedOn, on);
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkDCommandedOn, on);
     uint16_t buffer[8] = {DCAuxPowerNetworkAOn, (uint16_t)_powerStatus->auxPowerNetworkACommandedOn,
                           DCAuxPowerNetworkBOn, (uint16_t)_powerStatus->auxPowerNetworkBCommandedOn,
                           DCAuxPowerNetworkCOn, (uint16_t)_powerStatus->auxPowerNetworkCCommandedOn,
@@ -187,7 +205,7 @@ void PowerController::setAllAuxPowerNetworks(bool on) {
 
 void PowerController::setAuxPowerNetworkA(bool on) {
     SPDLOG_INFO("PowerController: setAuxPowerNetworkA({:d})", on);
-    _powerStatus->auxPowerNetworkACommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkACommandedOn, on);
     uint16_t buffer[2] = {DCAuxPowerNetworkAOn, (uint16_t)_powerStatus->auxPowerNetworkACommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -195,7 +213,7 @@ void PowerController::setAuxPowerNetworkA(bool on) {
 
 void PowerController::setAuxPowerNetworkB(bool on) {
     SPDLOG_INFO("PowerController: setAuxPowerNetworkB({:d})", on);
-    _powerStatus->auxPowerNetworkBCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkBCommandedOn, on);
     uint16_t buffer[2] = {DCAuxPowerNetworkBOn, (uint16_t)_powerStatus->auxPowerNetworkBCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -203,7 +221,7 @@ void PowerController::setAuxPowerNetworkB(bool on) {
 
 void PowerController::setAuxPowerNetworkC(bool on) {
     SPDLOG_INFO("PowerController: setAuxPowerNetworkC({:d})", on);
-    _powerStatus->auxPowerNetworkCCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkCCommandedOn, on);
     uint16_t buffer[2] = {DCAuxPowerNetworkCOn, (uint16_t)_powerStatus->auxPowerNetworkCCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
@@ -211,7 +229,7 @@ void PowerController::setAuxPowerNetworkC(bool on) {
 
 void PowerController::setAuxPowerNetworkD(bool on) {
     SPDLOG_INFO("PowerController: setAuxPowerNetworkD({:d})", on);
-    _powerStatus->auxPowerNetworkDCommandedOn = on;
+    _powerStatusTracker->set(_powerStatus->auxPowerNetworkDCommandedOn, on);
     uint16_t buffer[2] = {DCAuxPowerNetworkDOn, (uint16_t)_powerStatus->auxPowerNetworkDCommandedOn};
     IFPGA::get().writeCommandFIFO(buffer, 2, 0);
     M1M3SSPublisher::instance().tryLogPowerStatus();
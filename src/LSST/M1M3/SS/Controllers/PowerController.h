@@ -24,6 +24,7 @@
 #ifndef POWERCONTROLLER_H_
 #define POWERCONTROLLER_H_
 
+#include <EventChangeTracker.h>
 #include <IExpansionFPGA.h>
 #include <IFPGA.h>
 #include <SafetyController.h>
@@ -119,6 +120,8 @@ private:
     MTM1M3_powerSupplyDataC* _powerSupplyData;
     MTM1M3_logevent_powerStatusC* _powerStatus;
     MTM1M3_logevent_powerWarningC* _powerWarning;
+    EventChangeTracker* _powerStatusTracker;
+    EventChangeTracker* _powerWarningTracker;
 
     uint64_t _lastPowerTimestamp;
 };
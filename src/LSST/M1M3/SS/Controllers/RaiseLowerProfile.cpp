@@ -0,0 +1,78 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <RaiseLowerProfile.h>
+
+using namespace LSST::M1M3::SS;
+
+RaiseLowerProfile::RaiseLowerProfile()
+        : _enabled(false), _maxFactor(1), _lowUtilization(0), _highUtilization(1), _lastIncrement(0) {}
+
+void RaiseLowerProfile::validate(float maxFactor, float lowUtilization, float highUtilization) {
+    if (maxFactor < 1) {
+        throw std::runtime_error(
+                fmt::format("Raise/lower profile maximal increment factor must be >= 1, was {}", maxFactor));
+    }
+    if (lowUtilization < 0 || highUtilization > 1 || lowUtilization >= highUtilization) {
+        throw std::runtime_error(fmt::format(
+                "Invalid raise/lower profile utilization range {} - {}, expected 0 <= low < high <= 1",
+                lowUtilization, highUtilization));
+    }
+}
+
+void RaiseLowerProfile::configure(bool enabled, float maxFactor, float lowUtilization,
+                                  float highUtilization) {
+    validate(maxFactor, lowUtilization, highUtilization);
+    _enabled = enabled;
+    _maxFactor = maxFactor;
+    _lowUtilization = lowUtilization;
+    _highUtilization = highUtilization;
+    reset();
+}
+
+double RaiseLowerProfile::getIncrement(double increment, float utilization) {
+    if (_enabled == false || std::isfinite(utilization) == false) {
+        _lastIncrement = increment;
+        return increment;
+    }
+
+    float factor = 1;
+    if (utilization <= _lowUtilization) {
+        factor = _maxFactor;
+    } else if (utilization < _highUtilization) {
+        factor = _maxFactor -
+                 (_maxFactor - 1) * (utilization - _lowUtilization) / (_highUtilization - _lowUtilization);
+    }
+
+    double target = increment * factor;
+    if (target > _lastIncrement + increment) {
+        target = _lastIncrement + increment;
+    }
+    _lastIncrement = target;
+    return target;
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RAISELOWERPROFILE_H_
+#define RAISELOWERPROFILE_H_
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Closed loop raise and lower profile. Calculates support percentage
+ * increment from the measured load - the larger of hardpoint forces and force
+ * actuators following error, both relative to their raise/lower tolerances.
+ * With low load, the increment grows up to maxFactor times fixed increment.
+ * When load approaches highUtilization, fixed increment is used.
+ *
+ * The profile never changes tolerance checks - increment is applied only when
+ * all hardpoints and force actuators are in tolerance, as with the fixed
+ * increment. Growth of the increment is limited to fixed increment per cycle,
+ * while decrease is applied immediately.
+ */
+class RaiseLowerProfile {
+public:
+    RaiseLowerProfile();
+
+    /**
+     * Validates profile parameters. Called when settings are loaded, so
+     * invalid profile is reported before raise or lower starts.
+     *
+     * @param maxFactor maximal increment as multiple of fixed increment. Must be >= 1
+     * @param lowUtilization below this utilization maximal increment is used
+     * @param highUtilization above this utilization fixed increment is used
+     *
+     * @throw std::runtime_error on invalid parameters
+     */
+    static void validate(float maxFactor, float lowUtilization, float highUtilization);
+
+    /**
+     * Configure profile.
+     *
+     * @param enabled when false, fixed increment is always returned
+     * @param maxFactor maximal increment as multiple of fixed increment. Must be >= 1
+     * @param lowUtilization below this utilization maximal increment is used
+     * @param highUtilization above this utilization fixed increment is used
+     *
+     * @throw std::runtime_error on invalid parameters
+     *
+     * @see validate
+     */
+    void configure(bool enabled, float maxFactor, float lowUtilization, float highUtilization);
+
+    /**
+     * Resets last increment. Shall be called before raising or lowering
+     * starts.
+     */
+    void reset() { _lastIncrement = 0; }
+
+    /**
+     * Returns increment for the current cycle.
+     *
+     * @param increment fixed increment (percent of mirror weight)
+     * @param utilization ratio of measured value to tolerance limit; 0 for no
+     * load, 1 on the limit
+     *
+     * @return support percentage increment
+     */
+    double getIncrement(double increment, float utilization);
+
+    bool isEnabled() const { return _enabled; }
+
+private:
+    bool _enabled;
+    float _maxFactor;
+    float _lowUtilization;
+    float _highUtilization;
+
+    double _lastIncrement;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* RAISELOWERPROFILE_H_ */
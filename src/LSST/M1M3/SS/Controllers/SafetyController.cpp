@@ -40,6 +40,7 @@ SafetyController::SafetyController(SafetyControllerSettings* safetyControllerSet
     SPDLOG_DEBUG("SafetyController: SafetyController()");
     _safetyControllerSettings = safetyControllerSettings;
     _errorCodeData = M1M3SSPublisher::instance().getEventErrorCode();
+    _errorCodeTracker = M1M3SSPublisher::instance().getEventErrorCodeTracker();
 
     for (int i = 0; i < _safetyControllerSettings->ILC.CommunicationTimeoutPeriod; ++i) {
         _ilcCommunicationTimeoutData.push_back(0);
@@ -700,6 +701,6 @@ States::Type SafetyController::checkSafety(States::Type preferredNextState) {
 }
 
 void SafetyController::_clearError() {
-    _errorCodeData->errorCode = FaultCodes::NoFault;
+    _errorCodeTracker->set(_errorCodeData->errorCode, FaultCodes::NoFault);
     _errorCodeData->errorReport = "Error cleared";
 }
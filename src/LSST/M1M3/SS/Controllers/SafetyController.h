@@ -30,6 +30,7 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include <EventChangeTracker.h>
 #include <FaultCodes.h>
 #include <SafetyControllerSettings.h>
 #include <StateTypes.h>
@@ -186,7 +187,7 @@ private:
                          std::string errorReport, Args&&... args) {
         bool faultConditionExists = enabledFlag && conditionFlag;
         if (faultConditionExists && _errorCodeData->errorCode == FaultCodes::NoFault) {
-            _errorCodeData->errorCode = faultCode;
+            _errorCodeTracker->set(_errorCodeData->errorCode, faultCode);
             _errorCodeData->errorReport = fmt::format(errorReport, args...);
         }
     }
@@ -196,6 +197,7 @@ private:
     SafetyControllerSettings* _safetyControllerSettings;
 
     MTM1M3_logevent_errorCodeC* _errorCodeData;
+    EventChangeTracker* _errorCodeTracker;
 
     std::list<int> _ilcCommunicationTimeoutData;
     std::list<int> _forceActuatorFollowingErrorData[FA_COUNT];
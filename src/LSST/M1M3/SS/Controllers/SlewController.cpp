@@ -51,7 +51,7 @@ void SlewController::enterSlew() {
         Model::instance().getForceController()->applyAccelerationForces();
     }
     if (slew_settings.useBalanceForces) {
-        auto pidSettings = SettingReader::instance().getPIDSettings(true);
+        auto& pidSettings = SettingReader::instance().getPIDSettings(true);
         for (int i = 0; i < 6; i++) {
             Model::instance().getForceController()->updatePID(i, pidSettings.getParameters(i));
         }
@@ -73,7 +73,7 @@ void SlewController::exitSlew() {
         Model::instance().getForceController()->zeroVelocityForces();
     }
     if (slew_settings.useBalanceForces) {
-        auto pidSettings = SettingReader::instance().getPIDSettings(false);
+        auto& pidSettings = SettingReader::instance().getPIDSettings(false);
         for (int i = 0; i < 6; i++) {
             Model::instance().getForceController()->updatePID(i, pidSettings.getParameters(i));
         }
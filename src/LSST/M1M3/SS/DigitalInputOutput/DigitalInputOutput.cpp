@@ -54,6 +54,9 @@ DigitalInputOutput::DigitalInputOutput(token) {
     _airSupplyWarning = M1M3SSPublisher::instance().getEventAirSupplyWarning();
     _cellLightStatus = M1M3SSPublisher::instance().getEventCellLightStatus();
     _cellLightWarning = M1M3SSPublisher::instance().getEventCellLightWarning();
+    _airSupplyWarningTracker = M1M3SSPublisher::instance().getEventAirSupplyWarningTracker();
+    _cellLightStatusTracker = M1M3SSPublisher::instance().getEventCellLightStatusTracker();
+    _cellLightWarningTracker = M1M3SSPublisher::instance().getEventCellLightWarningTracker();
 
     _lastDITimestamp = 0;
     _lastDOTimestamp = 0;
@@ -63,6 +66,9 @@ DigitalInputOutput::DigitalInputOutput(token) {
     memset(_airSupplyWarning, 0, sizeof(MTM1M3_logevent_airSupplyWarningC));
     memset(_cellLightStatus, 0, sizeof(MTM1M3_logevent_cellLightStatusC));
     memset(_cellLightWarning, 0, sizeof(MTM1M3_logevent_cellLightWarningC));
+    _airSupplyWarningTracker->mark();
+    _cellLightStatusTracker->mark();
+    _cellLightWarningTracker->mark();
 }
 
 void DigitalInputOutput::setSafetyController(SafetyController* safetyController) {
@@ -93,16 +99,18 @@ void DigitalInputOutput::processData() {
                 timestamp, (fpgaData->DigitalOutputStates & DigitalOutputs::AirCommandOutputOn) != 0);
 
         _airSupplyWarning->timestamp = timestamp;
-        _airSupplyWarning->commandOutputMismatch = airMismatch;
+        _airSupplyWarningTracker->set(_airSupplyWarning->commandOutputMismatch, airMismatch);
 
         _cellLightStatus->timestamp = timestamp;
         // Polarity is swapped
-        _cellLightStatus->cellLightsOutputOn =
-                (fpgaData->DigitalOutputStates & DigitalOutputs::CellLightsOutputOn) == 0;
+        _cellLightStatusTracker->set(
+                _cellLightStatus->cellLightsOutputOn,
+                (fpgaData->DigitalOutputStates & DigitalOutputs::CellLightsOutputOn) == 0);
 
         _cellLightWarning->timestamp = timestamp;
-        _cellLightWarning->cellLightsOutputMismatch =
-                _cellLightStatus->cellLightsOutputOn != _cellLightStatus->cellLightsCommandedOn;
+        _cellLightWarningTracker->set(
+                _cellLightWarning->cellLightsOutputMismatch,
+                _cellLightStatus->cellLightsOutputOn != _cellLightStatus->cellLightsCommandedOn);
 
         _interlock_status.set_heartbeat_output(
                 timestamp, (fpgaData->DigitalOutputStates & DigitalOutputs::HeartbeatOutputState));
@@ -133,15 +141,17 @@ void DigitalInputOutput::processData() {
                 (fpgaData->DigitalInputStates & DigitalInputs::AirValveOpened) == 0);
 
         _airSupplyWarning->timestamp = timestamp;
-        _airSupplyWarning->commandSensorMismatch = airMismatch;
+        _airSupplyWarningTracker->set(_airSupplyWarning->commandSensorMismatch, airMismatch);
 
         _cellLightStatus->timestamp = timestamp;
-        _cellLightStatus->cellLightsOn = (fpgaData->DigitalInputStates & DigitalInputs::CellLightsOn) != 0;
+        _cellLightStatusTracker->set(_cellLightStatus->cellLightsOn,
+                                     (fpgaData->DigitalInputStates & DigitalInputs::CellLightsOn) != 0);
 
         _cellLightWarning->timestamp = timestamp;
-        _cellLightWarning->cellLightsSensorMismatch =
-                (now - _lightToggledTime) > std::chrono::milliseconds(100) &&
-                _cellLightStatus->cellLightsCommandedOn != _cellLightStatus->cellLightsOn;
+        _cellLightWarningTracker->set(_cellLightWarning->cellLightsSensorMismatch,
+                                      (now - _lightToggledTime) > std::chrono::milliseconds(100) &&
+                                              _cellLightStatus->cellLightsCommandedOn !=
+                                                      _cellLightStatus->cellLightsOn);
 
         InterlockWarning::instance().setData(timestamp, fpgaData->DigitalInputStates);
 
@@ -206,7 +216,7 @@ void DigitalInputOutput::turnAirOff() {
 
 void DigitalInputOutput::turnCellLightsOn() {
     SPDLOG_INFO("DigitalInputOutput: turnCellLightsOn()");
-    _cellLightStatus->cellLightsCommandedOn = true;
+    _cellLightStatusTracker->set(_cellLightStatus->cellLightsCommandedOn, true);
     // Polarity is swapped
     uint16_t buffer[2] = {FPGAAddresses::MirrorCellLightControl,
                           (uint16_t)(!_cellLightStatus->cellLightsCommandedOn)};
@@ -216,7 +226,7 @@ void DigitalInputOutput::turnCellLightsOn() {
 
 void DigitalInputOutput::turnCellLightsOff() {
     SPDLOG_INFO("DigitalInputOutput: turnCellLightsOff()");
-    _cellLightStatus->cellLightsCommandedOn = false;
+    _cellLightStatusTracker->set(_cellLightStatus->cellLightsCommandedOn, false);
     // Polarity is swapped
     uint16_t buffer[2] = {FPGAAddresses::MirrorCellLightControl,
                           (uint16_t)(!_cellLightStatus->cellLightsCommandedOn)};
@@ -29,6 +29,7 @@
 #include <cRIO/Singleton.h>
 
 #include <AirSupplyStatus.h>
+#include <EventChangeTracker.h>
 #include <IFPGA.h>
 #include <InterlockStatus.h>
 #include <SafetyController.h>
@@ -100,6 +101,9 @@ private:
     MTM1M3_logevent_airSupplyWarningC* _airSupplyWarning;
     MTM1M3_logevent_cellLightStatusC* _cellLightStatus;
     MTM1M3_logevent_cellLightWarningC* _cellLightWarning;
+    EventChangeTracker* _airSupplyWarningTracker;
+    EventChangeTracker* _cellLightStatusTracker;
+    EventChangeTracker* _cellLightWarningTracker;
     InterlockStatus _interlock_status;
 
     uint64_t _lastDOTimestamp;
@@ -38,6 +38,43 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+namespace {
+
+typedef MTM1M3_logevent_displacementSensorWarningC W;
+typedef Displacement::DisplacementWarningTable DisplacementWarningTable;
+
+const DisplacementWarningTable::Entry errorEntries[] = {
+        {&W::anyWarning, 0, DisplacementWarningTable::ANY_CODE, false, nullptr},
+        {&W::unknownProblem, 0, DisplacementWarningTable::codeWord(1), false,
+         &SafetyController::displacementNotifyUnknownProblem},
+        {&W::invalidResponse, 0, DisplacementWarningTable::codeWord(2), false,
+         &SafetyController::displacementNotifyInvalidResponse},
+        {&W::responseTimeout, 0, DisplacementWarningTable::codeWord(3), false,
+         &SafetyController::displacementNotifyResponseTimeoutError},
+        {&W::sensorReportsInvalidCommand, 0, DisplacementWarningTable::codeWord(4), false,
+         &SafetyController::displacementNotifySensorReportsInvalidCommand},
+        {&W::sensorReportsCommunicationTimeoutError, 0, DisplacementWarningTable::codeWord(5), false,
+         &SafetyController::displacementNotifySensorReportsCommunicationTimeoutError},
+        {&W::sensorReportsDataLengthError, 0, DisplacementWarningTable::codeWord(6), false,
+         &SafetyController::displacementNotifySensorReportsDataLengthError},
+        {&W::sensorReportsNumberOfParametersError, 0, DisplacementWarningTable::codeWord(7), false,
+         &SafetyController::displacementNotifySensorReportsNumberOfParametersError},
+        {&W::sensorReportsParameterError, 0, DisplacementWarningTable::codeWord(8), false,
+         &SafetyController::displacementNotifySensorReportsParameterError},
+        {&W::sensorReportsCommunicationError, 0, DisplacementWarningTable::codeWord(9), false,
+         &SafetyController::displacementNotifySensorReportsCommunicationError},
+        {&W::sensorReportsIDNumberError, 0, DisplacementWarningTable::codeWord(10), false,
+         &SafetyController::displacementNotifySensorReportsIDNumberError},
+        {&W::sensorReportsExpansionLineError, 0, DisplacementWarningTable::codeWord(11), false,
+         &SafetyController::displacementNotifySensorReportsExpansionLineError},
+        {&W::sensorReportsWriteControlError, 0, DisplacementWarningTable::codeWord(12), false,
+         &SafetyController::displacementNotifySensorReportsWriteControlError},
+};
+
+}  // namespace
+
+const Displacement::DisplacementWarningTable Displacement::ERROR_TABLE(errorEntries);
+
 Displacement::Displacement(SupportFPGAData* fpgaData, SafetyController* safetyController) {
     SPDLOG_DEBUG("Displacement: Displacement()");
     _displacementSensorSettings = &DisplacementSensorSettings::instance();
@@ -46,6 +83,7 @@ Displacement::Displacement(SupportFPGAData* fpgaData, SafetyController* safetyCo
 
     _imsData = M1M3SSPublisher::instance().getIMSData();
     _displacementWarning = M1M3SSPublisher::instance().getEventDisplacementSensorWarning();
+    _displacementWarningTracker = M1M3SSPublisher::instance().getEventDisplacementSensorWarningTracker();
 
     _lastSampleTimestamp = 0;
     _lastErrorTimestamp = 0;
@@ -60,40 +98,9 @@ void Displacement::processData() {
         _lastErrorTimestamp = _fpgaData->DisplacementErrorTimestamp;
         _errorCleared = false;
         _displacementWarning->timestamp = Timestamp::fromFPGA(_fpgaData->DisplacementErrorTimestamp);
-        _displacementWarning->anyWarning = _fpgaData->DisplacementErrorCode != 0;
-        _displacementWarning->unknownProblem = _fpgaData->DisplacementErrorCode == 1;
-        _displacementWarning->invalidResponse = _fpgaData->DisplacementErrorCode == 2;
-        _displacementWarning->responseTimeout = _fpgaData->DisplacementErrorCode == 3;
-        _displacementWarning->sensorReportsInvalidCommand = _fpgaData->DisplacementErrorCode == 4;
-        _displacementWarning->sensorReportsCommunicationTimeoutError = _fpgaData->DisplacementErrorCode == 5;
-        _displacementWarning->sensorReportsDataLengthError = _fpgaData->DisplacementErrorCode == 6;
-        _displacementWarning->sensorReportsNumberOfParametersError = _fpgaData->DisplacementErrorCode == 7;
-        _displacementWarning->sensorReportsParameterError = _fpgaData->DisplacementErrorCode == 8;
-        _displacementWarning->sensorReportsCommunicationError = _fpgaData->DisplacementErrorCode == 9;
-        _displacementWarning->sensorReportsIDNumberError = _fpgaData->DisplacementErrorCode == 10;
-        _displacementWarning->sensorReportsExpansionLineError = _fpgaData->DisplacementErrorCode == 11;
-        _displacementWarning->sensorReportsWriteControlError = _fpgaData->DisplacementErrorCode == 12;
-        _safetyController->displacementNotifyUnknownProblem(_displacementWarning->unknownProblem);
-        _safetyController->displacementNotifyInvalidResponse(_displacementWarning->invalidResponse);
-        _safetyController->displacementNotifyResponseTimeoutError(_displacementWarning->responseTimeout);
-        _safetyController->displacementNotifySensorReportsInvalidCommand(
-                _displacementWarning->sensorReportsInvalidCommand);
-        _safetyController->displacementNotifySensorReportsCommunicationTimeoutError(
-                _displacementWarning->sensorReportsCommunicationTimeoutError);
-        _safetyController->displacementNotifySensorReportsDataLengthError(
-                _displacementWarning->sensorReportsDataLengthError);
-        _safetyController->displacementNotifySensorReportsNumberOfParametersError(
-                _displacementWarning->sensorReportsNumberOfParametersError);
-        _safetyController->displacementNotifySensorReportsParameterError(
-                _displacementWarning->sensorReportsParameterError);
-        _safetyController->displacementNotifySensorReportsCommunicationError(
-                _displacementWarning->sensorReportsCommunicationError);
-        _safetyController->displacementNotifySensorReportsIDNumberError(
-                _displacementWarning->sensorReportsIDNumberError);
-        _safetyController->displacementNotifySensorReportsExpansionLineError(
-                _displacementWarning->sensorReportsExpansionLineError);
-        _safetyController->displacementNotifySensorReportsWriteControlError(
-                _displacementWarning->sensorReportsWriteControlError);
+        uint32_t errorWord = DisplacementWarningTable::codeWord(_fpgaData->DisplacementErrorCode);
+        ERROR_TABLE.decode(&errorWord, _displacementWarning, _displacementWarningTracker, _safetyController);
+        _displacementWarningTracker->mark();
         M1M3SSPublisher::instance().tryLogDisplacementSensorWarning();
     }
     if (_fpgaData->DisplacementSampleTimestamp > _lastSampleTimestamp) {
@@ -178,39 +185,8 @@ void Displacement::processData() {
             _fpgaData->DisplacementSampleTimestamp > _fpgaData->DisplacementErrorTimestamp) {
             _errorCleared = true;
             _displacementWarning->timestamp = Timestamp::fromFPGA(_fpgaData->DisplacementSampleTimestamp);
-            _displacementWarning->unknownProblem = false;
-            _displacementWarning->invalidResponse = false;
-            _displacementWarning->responseTimeout = false;
-            _displacementWarning->sensorReportsInvalidCommand = false;
-            _displacementWarning->sensorReportsCommunicationTimeoutError = false;
-            _displacementWarning->sensorReportsDataLengthError = false;
-            _displacementWarning->sensorReportsNumberOfParametersError = false;
-            _displacementWarning->sensorReportsParameterError = false;
-            _displacementWarning->sensorReportsCommunicationError = false;
-            _displacementWarning->sensorReportsIDNumberError = false;
-            _displacementWarning->sensorReportsExpansionLineError = false;
-            _displacementWarning->sensorReportsWriteControlError = false;
-            _safetyController->displacementNotifyUnknownProblem(_displacementWarning->unknownProblem);
-            _safetyController->displacementNotifyInvalidResponse(_displacementWarning->invalidResponse);
-            _safetyController->displacementNotifyResponseTimeoutError(_displacementWarning->responseTimeout);
-            _safetyController->displacementNotifySensorReportsInvalidCommand(
-                    _displacementWarning->sensorReportsInvalidCommand);
-            _safetyController->displacementNotifySensorReportsCommunicationTimeoutError(
-                    _displacementWarning->sensorReportsCommunicationTimeoutError);
-            _safetyController->displacementNotifySensorReportsDataLengthError(
-                    _displacementWarning->sensorReportsDataLengthError);
-            _safetyController->displacementNotifySensorReportsNumberOfParametersError(
-                    _displacementWarning->sensorReportsNumberOfParametersError);
-            _safetyController->displacementNotifySensorReportsParameterError(
-                    _displacementWarning->sensorReportsParameterError);
-            _safetyController->displacementNotifySensorReportsCommunicationError(
-                    _displacementWarning->sensorReportsCommunicationError);
-            _safetyController->displacementNotifySensorReportsIDNumberError(
-                    _displacementWarning->sensorReportsIDNumberError);
-            _safetyController->displacementNotifySensorReportsExpansionLineError(
-                    _displacementWarning->sensorReportsExpansionLineError);
-            _safetyController->displacementNotifySensorReportsWriteControlError(
-                    _displacementWarning->sensorReportsWriteControlError);
+            ERROR_TABLE.clear(_displacementWarning, _displacementWarningTracker, _safetyController);
+            _displacementWarningTracker->mark();
             M1M3SSPublisher::instance().tryLogDisplacementSensorWarning();
         }
     }
@@ -25,8 +25,10 @@
 #define DISPLACEMENT_H_
 
 #include <DisplacementSensorSettings.h>
+#include <EventChangeTracker.h>
 #include <SafetyController.h>
 #include <SupportFPGAData.h>
+#include <WarningTable.h>
 #include <cRIO/DataTypes.h>
 
 struct MTM1M3_imsDataC;
@@ -53,6 +55,12 @@ public:
      */
     void processData();
 
+    typedef WarningTable<MTM1M3_logevent_displacementSensorWarningC, SafetyController>
+            DisplacementWarningTable;
+
+    //* decodes error code, raises SafetyController faults
+    static const DisplacementWarningTable ERROR_TABLE;
+
 private:
     DisplacementSensorSettings* _displacementSensorSettings;
     SupportFPGAData* _fpgaData;
@@ -60,6 +68,7 @@ private:
 
     MTM1M3_imsDataC* _imsData;
     MTM1M3_logevent_displacementSensorWarningC* _displacementWarning;
+    EventChangeTracker* _displacementWarningTracker;
 
     uint64_t _lastSampleTimestamp;
     uint64_t _lastErrorTimestamp;
@@ -115,6 +115,7 @@ SimulatedFPGA::SimulatedFPGA() {
 
     _sendResponse = true;
 
+    _realTime = true;
     _nextClock = std::chrono::steady_clock::now();
     _lastAirOpen = _nextClock;
     _error_counter = 0;
@@ -136,19 +137,31 @@ void SimulatedFPGA::close() { SPDLOG_DEBUG("SimulatedFPGA: close()"); }
 
 void SimulatedFPGA::finalize() { SPDLOG_DEBUG("SimulatedFPGA: finalize()"); }
 
+void SimulatedFPGA::setRealTime(bool realTime) {
+    _realTime = realTime;
+    _nextClock = std::chrono::steady_clock::now();
+    _lastAirOpen = _nextClock;
+}
+
 void SimulatedFPGA::waitForOuterLoopClock(uint32_t) {
-    std::this_thread::sleep_until(_nextClock);
+    if (_realTime) {
+        std::this_thread::sleep_until(_nextClock);
+    }
     _nextClock += std::chrono::milliseconds(20);
 }
 
 void SimulatedFPGA::ackOuterLoopClock() {}
 
-void SimulatedFPGA::waitForPPS(uint32_t) { std::this_thread::sleep_for(std::chrono::seconds(1)); }
+void SimulatedFPGA::waitForPPS(uint32_t) {
+    if (_realTime) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+}
 
 void SimulatedFPGA::ackPPS() {}
 
 void SimulatedFPGA::waitForModbusIRQs(uint32_t, uint32_t) {
-    if (_error_counter == 3000) {
+    if (_realTime && _error_counter == 3000) {
         std::this_thread::sleep_for(std::chrono::microseconds(20123));
     }
     // shall trigger every 5 minutes
@@ -395,7 +408,7 @@ void SimulatedFPGA::writeCommandFIFO(uint16_t* data, size_t length, uint32_t tim
                 setBit(supportFPGAData.DigitalInputStates, DigitalInputs::AirValveOpened, !state);
                 setBit(supportFPGAData.DigitalInputStates, DigitalInputs::AirValveClosed, state);
                 if (state == true) {
-                    _lastAirOpen = std::chrono::steady_clock::now();
+                    _lastAirOpen = _now();
                 }
                 break;
             }
@@ -1135,7 +1148,7 @@ void SimulatedFPGA::_writeHP_ILCStatus(std::queue<uint16_t>* response, int index
 
 float SimulatedFPGA::_getAirPressure() {
     float baseValue = 120;
-    auto now = std::chrono::steady_clock::now();
+    auto now = _now();
 #define WAIT_SECONDS 5
     if (AirSupplyStatus::instance().airValveClosed == true) {
         baseValue = 0;
@@ -1147,6 +1160,10 @@ float SimulatedFPGA::_getAirPressure() {
     return fabs(baseValue + getRndPM1() * 0.5);
 }
 
+std::chrono::time_point<std::chrono::steady_clock> SimulatedFPGA::_now() {
+    return _realTime ? std::chrono::steady_clock::now() : _nextClock;
+}
+
 void SimulatedFPGA::_fill_HP_status(int address, int function, int steps, std::queue<uint16_t>* response) {
     int index = address - 1;
     auto encoder = _hardpointActuatorData->encoder[index];
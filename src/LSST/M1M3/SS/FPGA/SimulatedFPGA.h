@@ -55,6 +55,18 @@ public:
     void close() override;
     void finalize() override;
 
+    /**
+     * Sets clock pacing. When real time is disabled, outer loop clock and PPS
+     * waits return immediately and simulated time (used for air pressure)
+     * advances by an outer loop period on each outer loop clock. Used by
+     * offline tools running faster than the real time.
+     *
+     * @param realTime true (default) to pace clocks with wall time
+     */
+    void setRealTime(bool realTime);
+
+    bool isRealTime() { return _realTime; }
+
     void waitForOuterLoopClock(uint32_t) override;
     void ackOuterLoopClock() override;
 
@@ -125,6 +137,11 @@ private:
     // simulates properly clock signal
     std::chrono::time_point<std::chrono::steady_clock> _nextClock;
 
+    // when false, _nextClock is advanced without waiting and serves as simulated time
+    bool _realTime;
+
+    std::chrono::time_point<std::chrono::steady_clock> _now();
+
     // simulates pressure raising after air valve is opened
     std::chrono::time_point<std::chrono::steady_clock> _lastAirOpen;
 
@@ -31,7 +31,6 @@
 #include "ForcesAndMoments.h"
 #include "M1M3SSPublisher.h"
 #include "Model.h"
-#include "Range.h"
 
 using namespace LSST::M1M3::SS;
 
@@ -46,6 +45,8 @@ AccelerationForceComponent::AccelerationForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedAccelerationForces = M1M3SSPublisher::instance().getAppliedAccelerationForces();
 }
 
@@ -114,66 +115,32 @@ void AccelerationForceComponent::postEnableDisableActions() {
 void AccelerationForceComponent::postUpdateActions() {
     SPDLOG_TRACE("AccelerationForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedAccelerationForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_acceleration_forces.timestamp = _appliedAccelerationForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->accelerationForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().AccelerationLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().AccelerationLimitXTable[xIndex].HighFault;
-            _preclipped_acceleration_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_acceleration_forces.xForces[xIndex],
-                                                  _appliedAccelerationForces->xForces[xIndex]);
-            _forceSetpointWarning->accelerationForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->accelerationForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().AccelerationLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().AccelerationLimitYTable[yIndex].HighFault;
-            _preclipped_acceleration_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_acceleration_forces.yForces[yIndex],
-                                                  _appliedAccelerationForces->yForces[yIndex]);
-            _forceSetpointWarning->accelerationForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->accelerationForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().AccelerationLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().AccelerationLimitZTable[zIndex].HighFault;
-        _preclipped_acceleration_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange = !Range::InRangeAndCoerce(zLowFault, zHighFault,
-                                              _preclipped_acceleration_forces.zForces[zIndex],
-                                              _appliedAccelerationForces->zForces[zIndex]);
-        _forceSetpointWarning->accelerationForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->accelerationForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->accelerationForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped =
+                clipForces(ForceActuatorSettings::instance().AccelerationLimits,
+                           _preclipped_acceleration_forces, *_appliedAccelerationForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->accelerationForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
+                _appliedAccelerationForces->xForces, _appliedAccelerationForces->yForces,
+                _appliedAccelerationForces->zForces);
+        _appliedAccelerationForces->fx = fm.Fx;
+        _appliedAccelerationForces->fy = fm.Fy;
+        _appliedAccelerationForces->fz = fm.Fz;
+        _appliedAccelerationForces->mx = fm.Mx;
+        _appliedAccelerationForces->my = fm.My;
+        _appliedAccelerationForces->mz = fm.Mz;
+        _appliedAccelerationForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedAccelerationForces->xForces, _appliedAccelerationForces->yForces,
-            _appliedAccelerationForces->zForces);
-    _appliedAccelerationForces->fx = fm.Fx;
-    _appliedAccelerationForces->fy = fm.Fy;
-    _appliedAccelerationForces->fz = fm.Fz;
-    _appliedAccelerationForces->mx = fm.Mx;
-    _appliedAccelerationForces->my = fm.My;
-    _appliedAccelerationForces->mz = fm.Mz;
-    _appliedAccelerationForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyAccelerationForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyAccelerationForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_acceleration_forces.has_unsent_changes())) {
         _preclipped_acceleration_forces.calculate_forces_and_moments();
         _preclipped_acceleration_forces.check_changes();
     }
@@ -26,7 +26,9 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include "EventChangeTracker.h"
 #include "ForceComponent.h"
+#include "ForcesAndMomentsCache.h"
 #include "PreclippedForces.h"
 #include "SafetyController.h"
 
@@ -61,6 +63,9 @@ private:
     SafetyController* _safetyController;
 
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
+    ForcesAndMomentsCache _forcesAndMomentsCache;
+    bool _clippingRequired;
     MTM1M3_appliedAccelerationForcesC* _appliedAccelerationForces;
     PreclippedForces<MTM1M3_logevent_preclippedAccelerationForcesC> _preclipped_acceleration_forces;
 };
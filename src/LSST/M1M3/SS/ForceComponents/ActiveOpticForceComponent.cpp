@@ -46,6 +46,8 @@ ActiveOpticForceComponent::ActiveOpticForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedActiveOpticForces = M1M3SSPublisher::instance().getEventAppliedActiveOpticForces();
 }
 
@@ -74,50 +76,45 @@ void ActiveOpticForceComponent::postEnableDisableActions() {
 void ActiveOpticForceComponent::postUpdateActions() {
     SPDLOG_TRACE("ActiveOpticForceController: postUpdateActions()");
 
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedActiveOpticForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_active_optic_forces.timestamp = _appliedActiveOpticForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_Z_COUNT; ++zIndex) {
-        float zLowFault = ForceActuatorSettings::instance().ActiveOpticLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().ActiveOpticLimitZTable[zIndex].HighFault;
-
-        _forceSetpointWarning->activeOpticForceWarning[zIndex] = false;
-
-        _preclipped_active_optic_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange = !Range::InRangeAndCoerce(zLowFault, zHighFault,
-                                              _preclipped_active_optic_forces.zForces[zIndex],
-                                              _appliedActiveOpticForces->zForces[zIndex]);
-        _forceSetpointWarning->activeOpticForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->activeOpticForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->activeOpticForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped =
+                clipZForces(ForceActuatorSettings::instance().ActiveOpticLimits,
+                            _preclipped_active_optic_forces, *_appliedActiveOpticForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->activeOpticForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(_appliedActiveOpticForces->zForces);
+        _appliedActiveOpticForces->fz = fm.Fz;
+        _appliedActiveOpticForces->mx = fm.Mx;
+        _appliedActiveOpticForces->my = fm.My;
+
+        _forceSetpointWarningTracker->set(
+                _forceSetpointWarning->activeOpticNetForceWarning,
+                !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                _appliedActiveOpticForces->fz) ||
+                !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                _appliedActiveOpticForces->mx) ||
+                !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                ForceActuatorSettings::instance().netActiveOpticForceTolerance,
+                                _appliedActiveOpticForces->my));
     }
 
-    ForcesAndMoments fm =
-            ForceActuatorSettings::instance().calculateForcesAndMoments(_appliedActiveOpticForces->zForces);
-    _appliedActiveOpticForces->fz = fm.Fz;
-    _appliedActiveOpticForces->mx = fm.Mx;
-    _appliedActiveOpticForces->my = fm.My;
-
-    _forceSetpointWarning->activeOpticNetForceWarning =
-            !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            _appliedActiveOpticForces->fz) ||
-            !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            _appliedActiveOpticForces->mx) ||
-            !Range::InRange(-ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            ForceActuatorSettings::instance().netActiveOpticForceTolerance,
-                            _appliedActiveOpticForces->my);
-
-    _safetyController->forceControllerNotifyActiveOpticForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyActiveOpticForceClipping(_clippingRequired);
     _safetyController->forceControllerNotifyActiveOpticNetForceCheck(
             _forceSetpointWarning->activeOpticNetForceWarning);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_active_optic_forces.has_unsent_changes())) {
         _preclipped_active_optic_forces.calculate_forces_and_moments();
         _preclipped_active_optic_forces.check_changes();
     }
-    M1M3SSPublisher::instance().logAppliedActiveOpticForces();
+    // applied forces event is sent only when changed
+    if (changed) {
+        M1M3SSPublisher::instance().logAppliedActiveOpticForces();
+    }
 }
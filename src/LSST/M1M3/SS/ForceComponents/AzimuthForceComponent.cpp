@@ -47,6 +47,8 @@ AzimuthForceComponent::AzimuthForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedAzimuthForces = M1M3SSPublisher::instance().getAppliedAzimuthForces();
 }
 
@@ -108,65 +110,31 @@ void AzimuthForceComponent::postEnableDisableActions() {
 void AzimuthForceComponent::postUpdateActions() {
     SPDLOG_TRACE("AzimuthForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedAzimuthForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_azimuth_forces.timestamp = _appliedAzimuthForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->azimuthForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().AzimuthLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().AzimuthLimitXTable[xIndex].HighFault;
-            _preclipped_azimuth_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_azimuth_forces.xForces[xIndex],
-                                                  _appliedAzimuthForces->xForces[xIndex]);
-            _forceSetpointWarning->azimuthForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->azimuthForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().AzimuthLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().AzimuthLimitYTable[yIndex].HighFault;
-            _preclipped_azimuth_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_azimuth_forces.yForces[yIndex],
-                                                  _appliedAzimuthForces->yForces[yIndex]);
-            _forceSetpointWarning->azimuthForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->azimuthForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().AzimuthLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().AzimuthLimitZTable[zIndex].HighFault;
-        _preclipped_azimuth_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_azimuth_forces.zForces[zIndex],
-                                         _appliedAzimuthForces->zForces[zIndex]);
-        _forceSetpointWarning->azimuthForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->azimuthForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->azimuthForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().AzimuthLimits,
+                                                     _preclipped_azimuth_forces, *_appliedAzimuthForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->azimuthForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(_appliedAzimuthForces->xForces,
+                                                                      _appliedAzimuthForces->yForces,
+                                                                      _appliedAzimuthForces->zForces);
+        _appliedAzimuthForces->fx = fm.Fx;
+        _appliedAzimuthForces->fy = fm.Fy;
+        _appliedAzimuthForces->fz = fm.Fz;
+        _appliedAzimuthForces->mx = fm.Mx;
+        _appliedAzimuthForces->my = fm.My;
+        _appliedAzimuthForces->mz = fm.Mz;
+        _appliedAzimuthForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedAzimuthForces->xForces, _appliedAzimuthForces->yForces, _appliedAzimuthForces->zForces);
-    _appliedAzimuthForces->fx = fm.Fx;
-    _appliedAzimuthForces->fy = fm.Fy;
-    _appliedAzimuthForces->fz = fm.Fz;
-    _appliedAzimuthForces->mx = fm.Mx;
-    _appliedAzimuthForces->my = fm.My;
-    _appliedAzimuthForces->mz = fm.Mz;
-    _appliedAzimuthForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyAzimuthForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyAzimuthForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_azimuth_forces.has_unsent_changes())) {
         _preclipped_azimuth_forces.calculate_forces_and_moments();
         _preclipped_azimuth_forces.check_changes();
     }
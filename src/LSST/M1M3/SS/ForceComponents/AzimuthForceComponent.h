@@ -26,7 +26,9 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include "EventChangeTracker.h"
 #include "ForceComponent.h"
+#include "ForcesAndMomentsCache.h"
 #include "PreclippedForces.h"
 #include "SafetyController.h"
 
@@ -55,6 +57,9 @@ private:
     SafetyController* _safetyController;
 
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
+    ForcesAndMomentsCache _forcesAndMomentsCache;
+    bool _clippingRequired;
     MTM1M3_appliedAzimuthForcesC* _appliedAzimuthForces;
     PreclippedForces<MTM1M3_logevent_preclippedAzimuthForcesC> _preclipped_azimuth_forces;
 };
@@ -31,19 +31,12 @@
 #include "ForcesAndMoments.h"
 #include "M1M3SSPublisher.h"
 #include "Model.h"
-#include "Range.h"
 #include "SettingReader.h"
 
 using namespace LSST::M1M3::SS;
 
 BalanceForceComponent::BalanceForceComponent()
         : ForceComponent("Balance", &ForceActuatorSettings::instance().BalanceComponentSettings),
-          _fx(0, SettingReader::instance().getPIDSettings(false).getParameters(0)),
-          _fy(1, SettingReader::instance().getPIDSettings(false).getParameters(1)),
-          _fz(2, SettingReader::instance().getPIDSettings(false).getParameters(2)),
-          _mx(3, SettingReader::instance().getPIDSettings(false).getParameters(3)),
-          _my(4, SettingReader::instance().getPIDSettings(false).getParameters(4)),
-          _mz(5, SettingReader::instance().getPIDSettings(false).getParameters(5)),
           _preclipped_balance_forces(
                   [](MTM1M3_logevent_preclippedBalanceForcesC* data) {
                       M1M3SSPublisher::instance().logPreclippedBalanceForces(data);
@@ -53,7 +46,16 @@ BalanceForceComponent::BalanceForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
     _appliedBalanceForces = M1M3SSPublisher::instance().getAppliedBalanceForces();
+    _pidData = M1M3SSPublisher::instance().getPIDData();
+    _pidInfo = M1M3SSPublisher::instance().getEventPIDInfo();
+
+    auto& pidSettings = SettingReader::instance().getPIDSettings(false);
+    for (int id = 0; id < PIDBank::PID_COUNT; id++) {
+        _pids.configure(id, pidSettings.getParameters(id));
+    }
+    _publishPIDInfo();
 }
 
 void BalanceForceComponent::applyBalanceForces(const std::vector<float>& x, const std::vector<float>& y,
@@ -87,16 +89,17 @@ void BalanceForceComponent::applyBalanceForcesByMirrorForces(float xForce, float
             "{:.1f}, {:.1f}, {:.1f}, "
             "{:.1f})",
             xForce, yForce, zForce, xMoment, yMoment, zMoment);
-    float fx = _fx.process(0, xForce);
-    float fy = _fy.process(0, yForce);
-    float fz = _fz.process(0, zForce);
-    float mx = _mx.process(0, xMoment);
-    float my = _my.process(0, yMoment);
-    float mz = _mz.process(0, zMoment);
-    // Note: Publishing from any PID will publish ALL PID data
-    _fx.publishTelemetry();
-    DistributedForces forces =
-            ForceActuatorSettings::instance().calculateForceDistribution(fx, fy, fz, mx, my, mz);
+    static const double setpoints[PIDBank::PID_COUNT] = {0, 0, 0, 0, 0, 0};
+    double measurements[PIDBank::PID_COUNT] = {xForce, yForce, zForce, xMoment, yMoment, zMoment};
+    double outputs[PIDBank::PID_COUNT];
+    _pids.process(setpoints, measurements, outputs);
+
+    _pids.copyData(_pidData);
+    _pidData->timestamp = M1M3SSPublisher::instance().getTimestamp();
+    M1M3SSPublisher::instance().putPIDData();
+
+    DistributedForces forces = ForceActuatorSettings::instance().calculateForceDistribution(
+            outputs[0], outputs[1], outputs[2], outputs[3], outputs[4], outputs[5]);
     std::vector<float> xForces(FA_X_COUNT, 0);
     std::vector<float> yForces(FA_Y_COUNT, 0);
     std::vector<float> zForces(FA_Z_COUNT, 0);
@@ -119,15 +122,10 @@ void BalanceForceComponent::applyBalanceForcesByMirrorForces(float xForce, float
 }
 
 bool BalanceForceComponent::applyFreezedForces() {
-    bool changed = false;
-    float fx = _fx.getOffset(&changed);
-    float fy = _fy.getOffset(&changed);
-    float fz = _fz.getOffset(&changed);
-    float mx = _mx.getOffset(&changed);
-    float my = _my.getOffset(&changed);
-    float mz = _mz.getOffset(&changed);
-    DistributedForces forces =
-            ForceActuatorSettings::instance().calculateForceDistribution(fx, fy, fz, mx, my, mz);
+    double offsets[PIDBank::PID_COUNT];
+    bool changed = _pids.getOffsets(offsets);
+    DistributedForces forces = ForceActuatorSettings::instance().calculateForceDistribution(
+            offsets[0], offsets[1], offsets[2], offsets[3], offsets[4], offsets[5]);
     std::vector<float> xForces(FA_X_COUNT, 0);
     std::vector<float> yForces(FA_Y_COUNT, 0);
     std::vector<float> zForces(FA_Z_COUNT, 0);
@@ -152,48 +150,38 @@ bool BalanceForceComponent::applyFreezedForces() {
 
 void BalanceForceComponent::updatePID(int id, PIDParameters parameters) {
     SPDLOG_DEBUG("BalanceForceComponent: updatePID({})", id);
-    PID* pid = _idToPID(id);
-    if (pid != NULL) {
-        pid->updateParameters(parameters);
+    if (id < 0 || id >= PIDBank::PID_COUNT) {
+        return;
     }
+    _pids.updateParameters(id, parameters);
+    _publishPIDInfo();
 }
 
 void BalanceForceComponent::resetPID(int id) {
     SPDLOG_DEBUG("BalanceForceComponent: resetPID()");
-    PID* pid = _idToPID(id);
-    if (pid != NULL) {
-        pid->restoreInitialParameters();
+    if (id < 0 || id >= PIDBank::PID_COUNT) {
+        return;
     }
+    _pids.restoreInitialParameters(id);
+    _publishPIDInfo();
 }
 
 void BalanceForceComponent::resetPIDs() {
     SPDLOG_INFO("BalanceForceComponent: resetPIDs()");
-    _fx.restoreInitialParameters();
-    _fy.restoreInitialParameters();
-    _fz.restoreInitialParameters();
-    _mx.restoreInitialParameters();
-    _my.restoreInitialParameters();
-    _mz.restoreInitialParameters();
+    for (int id = 0; id < PIDBank::PID_COUNT; id++) {
+        _pids.restoreInitialParameters(id);
+    }
+    _publishPIDInfo();
 }
 
 void BalanceForceComponent::freezePIDs() {
     SPDLOG_INFO("BalanceForceComponent: freezePIDs()");
-    _fx.freeze();
-    _fy.freeze();
-    _fz.freeze();
-    _mx.freeze();
-    _my.freeze();
-    _mz.freeze();
+    _pids.freeze();
 }
 
 void BalanceForceComponent::thawPIDs() {
     SPDLOG_INFO("BalanceForceComponent: thawPIDs()");
-    _fx.thaw();
-    _fy.thaw();
-    _fz.thaw();
-    _mx.thaw();
-    _my.thaw();
-    _mz.thaw();
+    _pids.thaw();
 }
 
 void BalanceForceComponent::postEnableDisableActions() {
@@ -205,53 +193,15 @@ void BalanceForceComponent::postEnableDisableActions() {
 void BalanceForceComponent::postUpdateActions() {
     SPDLOG_TRACE("BalanceForceController: postUpdateActions()");
 
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedBalanceForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_balance_forces.timestamp = _appliedBalanceForces->timestamp;
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->balanceForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().BalanceLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().BalanceLimitXTable[xIndex].HighFault;
-            _preclipped_balance_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_balance_forces.xForces[xIndex],
-                                                  _appliedBalanceForces->xForces[xIndex]);
-            _forceSetpointWarning->balanceForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->balanceForceWarning[zIndex];
-        }
+    std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().BalanceLimits,
+                                                 _preclipped_balance_forces, *_appliedBalanceForces);
+    bool clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->balanceForceWarning,
+                                             _forceSetpointWarningTracker);
 
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().BalanceLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().BalanceLimitYTable[yIndex].HighFault;
-            _preclipped_balance_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_balance_forces.yForces[yIndex],
-                                                  _appliedBalanceForces->yForces[yIndex]);
-            _forceSetpointWarning->balanceForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->balanceForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().BalanceLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().BalanceLimitZTable[zIndex].HighFault;
-        _preclipped_balance_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_balance_forces.zForces[zIndex],
-                                         _appliedBalanceForces->zForces[zIndex]);
-        _forceSetpointWarning->balanceForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->balanceForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->balanceForceWarning[zIndex] || clippingRequired;
-    }
-
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
+    const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
             _appliedBalanceForces->xForces, _appliedBalanceForces->yForces, _appliedBalanceForces->zForces);
     _appliedBalanceForces->fx = fm.Fx;
     _appliedBalanceForces->fy = fm.Fy;
@@ -271,21 +221,8 @@ void BalanceForceComponent::postUpdateActions() {
     M1M3SSPublisher::instance().logAppliedBalanceForces();
 }
 
-PID* BalanceForceComponent::_idToPID(int id) {
-    switch (id) {
-        case 0:
-            return &_fx;
-        case 1:
-            return &_fy;
-        case 2:
-            return &_fz;
-        case 3:
-            return &_mx;
-        case 4:
-            return &_my;
-        case 5:
-            return &_mz;
-        default:
-            return 0;
-    }
+void BalanceForceComponent::_publishPIDInfo() {
+    _pids.copyInfo(_pidInfo);
+    _pidInfo->timestamp = M1M3SSPublisher::instance().getTimestamp();
+    M1M3SSPublisher::instance().logPIDInfo();
 }
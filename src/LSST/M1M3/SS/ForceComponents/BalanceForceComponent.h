@@ -26,8 +26,10 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include "EventChangeTracker.h"
 #include "ForceComponent.h"
-#include "PID.h"
+#include "ForcesAndMomentsCache.h"
+#include "PIDBank.h"
 #include "PreclippedForces.h"
 #include "SafetyController.h"
 
@@ -49,7 +51,7 @@ namespace SS {
  * are being measured on hardpoints load cells) offloaded to 156 mirror force
  * actuators (assuming hardpoints chase is enabled).
  *
- * @see LSST::M1M3::SS::PID
+ * @see LSST::M1M3::SS::PIDBank
  */
 class BalanceForceComponent : public ForceComponent {
 public:
@@ -85,18 +87,18 @@ protected:
     void postUpdateActions() override;
 
 private:
-    PID* _idToPID(int id);
+    void _publishPIDInfo();
 
     SafetyController* _safetyController;
 
-    PID _fx;
-    PID _fy;
-    PID _fz;
-    PID _mx;
-    PID _my;
-    PID _mz;
+    //* fx, fy, fz, mx, my and mz PIDs
+    PIDBank _pids;
+    MTM1M3_pidDataC* _pidData;
+    MTM1M3_logevent_pidInfoC* _pidInfo;
 
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
+    ForcesAndMomentsCache _forcesAndMomentsCache;
     MTM1M3_appliedBalanceForcesC* _appliedBalanceForces;
 
     PreclippedForces<MTM1M3_logevent_preclippedBalanceForcesC> _preclipped_balance_forces;
@@ -0,0 +1,153 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include <DisabledForcesRedistribution.h>
+#include <ForceActuatorApplicationSettings.h>
+
+using namespace LSST::M1M3::SS;
+
+DisabledForcesRedistribution::DisabledForcesRedistribution() : _planned(false), _disabledCount(0) {
+    memset(_enabled, 1, sizeof(_enabled));
+    memset(&_xPlan, 0, sizeof(_xPlan));
+    memset(&_yPlan, 0, sizeof(_yPlan));
+    memset(&_zPlan, 0, sizeof(_zPlan));
+}
+
+void DisabledForcesRedistribution::plan(const bool enabled[FA_COUNT]) {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    memcpy(_enabled, enabled, sizeof(_enabled));
+    _planned = true;
+    _disabledCount = 0;
+
+    int xSources = 0, ySources = 0, zSources = 0;
+    int xTargets = 0, yTargets = 0, zTargets = 0;
+
+    for (int q = 0; q < 4; q++) {
+        auto& qz = faa_settings.QuadrantZ[q];
+
+        int xStart = xSources, yStart = ySources, zStart = zSources;
+
+        // disabled actuators are sources for all axes
+        for (auto zIndex : qz) {
+            if (enabled[zIndex]) {
+                continue;
+            }
+            _zPlan.sources[zSources++] = zIndex;
+            _disabledCount++;
+
+            int yIndex = faa_settings.ZIndexToYIndex[zIndex];
+            if (yIndex >= 0) {
+                _yPlan.sources[ySources++] = yIndex;
+            }
+
+            int xIndex = faa_settings.ZIndexToXIndex[zIndex];
+            if (xIndex >= 0) {
+                _xPlan.sources[xSources++] = xIndex;
+            }
+        }
+
+        // lateral targets are excluded by matching their X/Y index against
+        // Z indices of the disabled actuators, as the original per-cycle
+        // redistribution did
+        auto isDisabled = [&](int index) {
+            return index < FA_COUNT && enabled[index] == false &&
+                   int(faa_settings.ZIndexToActuatorId(index) / 100) - 1 == q;
+        };
+
+        for (auto zIndex : qz) {
+            if (enabled[zIndex]) {
+                _zPlan.targets[zTargets++] = zIndex;
+            }
+        }
+
+        auto& qy = faa_settings.QuadrantY[q];
+        for (auto yIndex : qy) {
+            if (isDisabled(yIndex) == false) {
+                _yPlan.targets[yTargets++] = yIndex;
+            }
+        }
+
+        auto& qx = faa_settings.QuadrantX[q];
+        for (auto xIndex : qx) {
+            if (isDisabled(xIndex) == false) {
+                _xPlan.targets[xTargets++] = xIndex;
+            }
+        }
+
+        // quadrants without disabled actuator are skipped for all axes
+        bool redistribute = zSources > zStart;
+        _xPlan.redistribute[q] = _yPlan.redistribute[q] = _zPlan.redistribute[q] = redistribute;
+
+        _xPlan.divisor[q] = qx.size() - (xSources - xStart);
+        _yPlan.divisor[q] = qy.size() - (ySources - yStart);
+        _zPlan.divisor[q] = qz.size() - (zSources - zStart);
+
+        _xPlan.sourcesEnd[q] = xSources;
+        _xPlan.targetsEnd[q] = xTargets;
+        _yPlan.sourcesEnd[q] = ySources;
+        _yPlan.targetsEnd[q] = yTargets;
+        _zPlan.sourcesEnd[q] = zSources;
+        _zPlan.targetsEnd[q] = zTargets;
+    }
+}
+
+bool DisabledForcesRedistribution::planRequired(const bool enabled[FA_COUNT]) const {
+    return _planned == false || memcmp(_enabled, enabled, sizeof(_enabled)) != 0;
+}
+
+void DisabledForcesRedistribution::apply(float* xForces, float* yForces, float* zForces) const {
+    if (_disabledCount == 0) {
+        return;
+    }
+
+    _zPlan.apply(zForces);
+    _yPlan.apply(yForces);
+    _xPlan.apply(xForces);
+}
+
+template <int N>
+void DisabledForcesRedistribution::AxisPlan<N>::apply(float* forces) const {
+    int s = 0;
+    int t = 0;
+    for (int q = 0; q < 4; q++) {
+        if (redistribute[q] == false) {
+            s = sourcesEnd[q];
+            t = targetsEnd[q];
+            continue;
+        }
+
+        float excess = 0;
+        for (; s < sourcesEnd[q]; s++) {
+            excess += forces[sources[s]];
+            forces[sources[s]] = 0;
+        }
+
+        float share = excess / divisor[q];
+        for (; t < targetsEnd[q]; t++) {
+            forces[targets[t]] += share;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef DISABLEDFORCESREDISTRIBUTION_H_
+#define DISABLEDFORCESREDISTRIBUTION_H_
+
+#include <cRIO/DataTypes.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Redistributes forces of disabled force actuators to enabled actuators in
+ * the same mirror quadrant. Forces of the disabled actuators are zeroed, and
+ * their sum is evenly distributed to remaining enabled actuators in the
+ * quadrant, for each axis separately.
+ *
+ * Indices of the disabled (source) and enabled (target) actuators are
+ * calculated in plan, which shall be called when the set of enabled actuators
+ * changes. The apply method then only accumulates and distributes forces,
+ * without any allocation or lookup.
+ *
+ * Results are identical to the original per-cycle redistribution. That
+ * includes its handling of lateral (X and Y) actuators - lateral actuators
+ * are excluded from targets when their X/Y index matches Z index of a
+ * disabled actuator in the quadrant, and the share is divided by the number
+ * of quadrant lateral actuators minus the disabled ones.
+ */
+class DisabledForcesRedistribution {
+public:
+    DisabledForcesRedistribution();
+
+    /**
+     * Calculates redistribution plan.
+     *
+     * @param enabled true for enabled actuators, indexed by Z index
+     */
+    void plan(const bool enabled[FA_COUNT]);
+
+    /**
+     * Returns true if plan is required - either no plan was calculated yet,
+     * or the enabled actuators changed since the last plan call.
+     *
+     * @param enabled true for enabled actuators, indexed by Z index
+     */
+    bool planRequired(const bool enabled[FA_COUNT]) const;
+
+    /**
+     * Returns true if there isn't any disabled actuator, so apply is no-op.
+     */
+    bool empty() const { return _disabledCount == 0; }
+
+    /**
+     * Redistributes forces from disabled actuators.
+     *
+     * @param xForces X forces, FA_X_COUNT elements
+     * @param yForces Y forces, FA_Y_COUNT elements
+     * @param zForces Z forces, FA_Z_COUNT elements
+     */
+    void apply(float* xForces, float* yForces, float* zForces) const;
+
+private:
+    /**
+     * Redistribution plan for single axis. Sources and targets are stored
+     * quadrant after quadrant, quadrant boundaries are in source and target
+     * ends. Excess force is divided by quadrant divisor.
+     */
+    template <int N>
+    struct AxisPlan {
+        int sources[N];
+        int targets[N];
+        int sourcesEnd[4];
+        int targetsEnd[4];
+        float divisor[4];
+        bool redistribute[4];
+
+        void apply(float* forces) const;
+    };
+
+    bool _planned;
+    bool _enabled[FA_COUNT];
+    int _disabledCount;
+
+    AxisPlan<FA_X_COUNT> _xPlan;
+    AxisPlan<FA_Y_COUNT> _yPlan;
+    AxisPlan<FA_Z_COUNT> _zPlan;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* DISABLEDFORCESREDISTRIBUTION_H_ */
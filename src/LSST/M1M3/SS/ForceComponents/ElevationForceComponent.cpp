@@ -32,7 +32,6 @@
 #include "M1M3SSPublisher.h"
 #include "Model.h"
 #include "RaisingLoweringInfo.h"
-#include "Range.h"
 #include "SafetyController.h"
 
 using namespace LSST::M1M3::SS;
@@ -48,6 +47,8 @@ ElevationForceComponent::ElevationForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedElevationForces = M1M3SSPublisher::instance().getAppliedElevationForces();
 }
 
@@ -112,67 +113,31 @@ void ElevationForceComponent::postEnableDisableActions() {
 void ElevationForceComponent::postUpdateActions() {
     SPDLOG_TRACE("ElevationForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedElevationForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_elevation_forces.timestamp = _appliedElevationForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_Z_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->elevationForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().ElevationLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().ElevationLimitXTable[xIndex].HighFault;
-            _preclipped_elevation_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_elevation_forces.xForces[xIndex],
-                                                  _appliedElevationForces->xForces[xIndex]);
-            _forceSetpointWarning->elevationForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->elevationForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().ElevationLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().ElevationLimitYTable[yIndex].HighFault;
-            _preclipped_elevation_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_elevation_forces.yForces[yIndex],
-                                                  _appliedElevationForces->yForces[yIndex]);
-            _forceSetpointWarning->elevationForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->elevationForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().ElevationLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().ElevationLimitZTable[zIndex].HighFault;
-        _preclipped_elevation_forces.zForces[zIndex] = zCurrent[zIndex];
-
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_elevation_forces.zForces[zIndex],
-                                         _appliedElevationForces->zForces[zIndex]);
-        _forceSetpointWarning->elevationForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->elevationForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->elevationForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().ElevationLimits,
+                                                     _preclipped_elevation_forces, *_appliedElevationForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->elevationForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
+                _appliedElevationForces->xForces, _appliedElevationForces->yForces,
+                _appliedElevationForces->zForces);
+        _appliedElevationForces->fx = fm.Fx;
+        _appliedElevationForces->fy = fm.Fy;
+        _appliedElevationForces->fz = fm.Fz;
+        _appliedElevationForces->mx = fm.Mx;
+        _appliedElevationForces->my = fm.My;
+        _appliedElevationForces->mz = fm.Mz;
+        _appliedElevationForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedElevationForces->xForces, _appliedElevationForces->yForces,
-            _appliedElevationForces->zForces);
-    _appliedElevationForces->fx = fm.Fx;
-    _appliedElevationForces->fy = fm.Fy;
-    _appliedElevationForces->fz = fm.Fz;
-    _appliedElevationForces->mx = fm.Mx;
-    _appliedElevationForces->my = fm.My;
-    _appliedElevationForces->mz = fm.Mz;
-    _appliedElevationForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyElevationForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyElevationForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_elevation_forces.has_unsent_changes())) {
         _preclipped_elevation_forces.calculate_forces_and_moments();
         _preclipped_elevation_forces.check_changes();
     }
@@ -21,10 +21,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <algorithm>
-
 #include <spdlog/spdlog.h>
 
+#include "DisabledForcesRedistribution.h"
 #include "DistributedForces.h"
 #include "FinalForceComponent.h"
 #include "ForceActuatorApplicationSettings.h"
@@ -51,6 +50,7 @@ FinalForceComponent::FinalForceComponent()
     _enabledForceActuators = M1M3SSPublisher::instance().getEnabledForceActuators();
     _forceActuatorState = M1M3SSPublisher::instance().getEventForceActuatorState();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
     _appliedForces = M1M3SSPublisher::instance().getAppliedForces();
 
     _appliedAccelerationForces = M1M3SSPublisher::instance().getAppliedAccelerationForces();
@@ -95,83 +95,15 @@ void FinalForceComponent::applyForcesByComponents() {
                       _appliedVelocityForces->zForces[i]);
     }
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    // find disabled FAs quadrants
-    std::vector<int> disabledInQuadrants[4];
-
+    // distribute any disabled FA force per quadrants
+    bool enabled[FA_COUNT];
     for (int i = 0; i < FA_COUNT; i++) {
-        if (_enabledForceActuators->forceActuatorEnabled[i] == false) {
-            disabledInQuadrants[int(faa_settings.ZIndexToActuatorId(i) / 100) - 1].push_back(i);
-        }
+        enabled[i] = _enabledForceActuators->forceActuatorEnabled[i];
     }
-
-    // 2nd pass - distribute any disabled FA force per quadrants
-    for (int q = 0; q < 4; q++) {
-        auto qd = disabledInQuadrants[q];
-
-        if (disabledInQuadrants[q].size() == 0) {
-            continue;
-        }
-
-        float excess_z = 0;
-        float excess_y = 0;
-        float excess_x = 0;
-
-        int z_disabled = 0;
-        int y_disabled = 0;
-        int x_disabled = 0;
-
-        for (auto disabled : qd) {
-            excess_z += zTarget[disabled];
-            zTarget[disabled] = 0;
-            z_disabled++;
-
-            int yIndex = faa_settings.ZIndexToYIndex[disabled];
-            if (yIndex >= 0) {
-                excess_y += yTarget[yIndex];
-                yTarget[yIndex] = 0;
-                y_disabled++;
-            }
-
-            int xIndex = faa_settings.ZIndexToXIndex[disabled];
-            if (xIndex >= 0) {
-                excess_x += xTarget[xIndex];
-                xTarget[xIndex] = 0;
-                x_disabled++;
-            }
-        }
-
-        auto qz = faa_settings.QuadrantZ[q];
-
-        for (auto fa : qz) {
-            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
-                continue;
-            }
-
-            zTarget[fa] += excess_z / (qz.size() - z_disabled);
-        }
-
-        auto qy = faa_settings.QuadrantY[q];
-
-        for (auto fa : qy) {
-            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
-                continue;
-            }
-
-            yTarget[fa] += excess_y / (qy.size() - y_disabled);
-        }
-
-        auto qx = faa_settings.QuadrantX[q];
-
-        for (auto fa : qx) {
-            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
-                continue;
-            }
-
-            xTarget[fa] += excess_x / (qx.size() - x_disabled);
-        }
+    if (_disabledForcesRedistribution.planRequired(enabled)) {
+        _disabledForcesRedistribution.plan(enabled);
     }
+    _disabledForcesRedistribution.apply(xTarget, yTarget, zTarget);
 }
 
 void FinalForceComponent::postEnableDisableActions() {
@@ -191,7 +123,7 @@ void FinalForceComponent::postUpdateActions() {
         int xIndex = faa_settings.ZIndexToXIndex[zIndex];
         int yIndex = faa_settings.ZIndexToYIndex[zIndex];
 
-        _forceSetpointWarning->forceWarning[zIndex] = false;
+        bool warning = false;
 
         if (xIndex != -1) {
             float xLow = ForceActuatorSettings::instance().appliedXForceLowLimit[xIndex];
@@ -199,8 +131,7 @@ void FinalForceComponent::postUpdateActions() {
             _preclipped_forces.xForces[xIndex] = xCurrent[xIndex];
             notInRange = !Range::InRangeAndCoerce(xLow, xHigh, _preclipped_forces.xForces[xIndex],
                                                   _appliedForces->xForces[xIndex]);
-            _forceSetpointWarning->forceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->forceWarning[zIndex];
+            warning = notInRange || warning;
         }
 
         if (yIndex != -1) {
@@ -209,8 +140,7 @@ void FinalForceComponent::postUpdateActions() {
             _preclipped_forces.yForces[yIndex] = yCurrent[yIndex];
             notInRange = !Range::InRangeAndCoerce(yLow, yHigh, _preclipped_forces.yForces[yIndex],
                                                   _appliedForces->yForces[yIndex]);
-            _forceSetpointWarning->forceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->forceWarning[zIndex];
+            warning = notInRange || warning;
         }
 
         float zLow = ForceActuatorSettings::instance().appliedZForceLowLimit[zIndex];
@@ -218,12 +148,11 @@ void FinalForceComponent::postUpdateActions() {
         _preclipped_forces.zForces[zIndex] = zCurrent[zIndex];
         notInRange = !Range::InRangeAndCoerce(zLow, zHigh, _preclipped_forces.zForces[zIndex],
                                               _appliedForces->zForces[zIndex]);
-        _forceSetpointWarning->forceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->forceWarning[zIndex];
+        _forceSetpointWarningTracker->set(_forceSetpointWarning->forceWarning[zIndex], notInRange || warning);
         clippingRequired = _forceSetpointWarning->forceWarning[zIndex] || clippingRequired;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
+    const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
             _appliedForces->xForces, _appliedForces->yForces, _appliedForces->zForces);
     _appliedForces->fx = fm.Fx;
     _appliedForces->fy = fm.Fy;
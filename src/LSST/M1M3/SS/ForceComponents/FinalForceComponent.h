@@ -24,8 +24,11 @@
 #ifndef LSST_M1M3_SS_FORCECONTROLLER_FINALFORCECOMPONENT_H_
 #define LSST_M1M3_SS_FORCECONTROLLER_FINALFORCECOMPONENT_H_
 
+#include "DisabledForcesRedistribution.h"
 #include "EnabledForceActuators.h"
+#include "EventChangeTracker.h"
 #include "ForceComponent.h"
+#include "ForcesAndMomentsCache.h"
 #include "PreclippedForces.h"
 #include "SAL_MTM1M3C.h"
 #include "SafetyController.h"
@@ -66,9 +69,12 @@ protected:
 private:
     SafetyController* _safetyController;
     EnabledForceActuators* _enabledForceActuators;
+    DisabledForcesRedistribution _disabledForcesRedistribution;
 
     MTM1M3_logevent_forceActuatorStateC* _forceActuatorState;
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
+    ForcesAndMomentsCache _forcesAndMomentsCache;
     MTM1M3_appliedForcesC* _appliedForces;
     PreclippedForces<MTM1M3_logevent_preclippedForcesC> _preclipped_forces;
 
@@ -21,7 +21,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <ForceActuatorApplicationSettings.h>
+#include <ForceActuatorSettings.h>
 #include <ForceComponent.h>
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <spdlog/spdlog.h>
@@ -32,6 +35,9 @@ ForceComponent::ForceComponent(const char* name, ForceComponentSettings* forceCo
         : _forceComponentSettings(forceComponentSettings) {
     _name = name;
     _state = INITIALISING;
+    _currentChanged = true;
+    _settingsVersion = 0;
+    _forceWarningsSet = false;
 
     _zeroAll();
 }
@@ -76,6 +82,7 @@ void ForceComponent::update() {
             memset(xCurrent, 0, sizeof(xCurrent));
             memset(yCurrent, 0, sizeof(yCurrent));
             memset(zCurrent, 0, sizeof(zCurrent));
+            _currentChanged = true;
             postEnableDisableActions();
             postUpdateActions();
         }
@@ -131,21 +138,20 @@ void ForceComponent::update() {
                 zOffset[i] /= scalar;
                 zCurrent[i] += zOffset[i];
             }
+            _currentChanged = true;
         } else {
             // If it is less than 1 outer loop cycle just set current as the target
             // we do this to prevent rounding errors from making it so when we
             // request 100N we don't put 99.998N and claim that is what we where asked
-            // to produce.
-            for (int i = 0; i < FA_COUNT; ++i) {
-                if (i < FA_X_COUNT) {
-                    xCurrent[i] = xTarget[i];
-                }
-
-                if (i < FA_Y_COUNT) {
-                    yCurrent[i] = yTarget[i];
-                }
-
-                zCurrent[i] = zTarget[i];
+            // to produce. Targets are usually constant, so copy only when
+            // they differ.
+            if (memcmp(xCurrent, xTarget, sizeof(xCurrent)) != 0 ||
+                memcmp(yCurrent, yTarget, sizeof(yCurrent)) != 0 ||
+                memcmp(zCurrent, zTarget, sizeof(zCurrent)) != 0) {
+                memcpy(xCurrent, xTarget, sizeof(xCurrent));
+                memcpy(yCurrent, yTarget, sizeof(yCurrent));
+                memcpy(zCurrent, zTarget, sizeof(zCurrent));
+                _currentChanged = true;
             }
         }
         postUpdateActions();
@@ -154,10 +160,61 @@ void ForceComponent::update() {
 
 void ForceComponent::reset() {
     _state = DISABLED;
+    _currentChanged = true;
     postEnableDisableActions();
     postUpdateActions();
 }
 
+bool ForceComponent::updateRequired() {
+    uint32_t settingsVersion = ForceActuatorSettings::instance().getVersion();
+    bool ret = _currentChanged || _settingsVersion != settingsVersion;
+    _currentChanged = false;
+    _settingsVersion = settingsVersion;
+    return ret;
+}
+
+std::bitset<FA_Z_COUNT> ForceComponent::_clipForces(const ForceClippingLimits& limits,
+                                                    std::vector<float>& preclippedX,
+                                                    std::vector<float>& preclippedY,
+                                                    std::vector<float>& preclippedZ,
+                                                    std::vector<float>& appliedX,
+                                                    std::vector<float>& appliedY,
+                                                    std::vector<float>& appliedZ) {
+    std::copy(xCurrent, xCurrent + FA_X_COUNT, preclippedX.begin());
+    std::copy(yCurrent, yCurrent + FA_Y_COUNT, preclippedY.begin());
+
+    std::bitset<FA_Z_COUNT> clipped = _clipZForces(limits.z, preclippedZ, appliedZ);
+    std::bitset<FA_X_COUNT> xClipped = limits.x.clip(preclippedX.data(), appliedX.data());
+    std::bitset<FA_Y_COUNT> yClipped = limits.y.clip(preclippedY.data(), appliedY.data());
+
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    if (xClipped.any()) {
+        for (int xIndex = 0; xIndex < FA_X_COUNT; ++xIndex) {
+            if (xClipped[xIndex]) {
+                clipped.set(faa_settings.XIndexToZIndex[xIndex]);
+            }
+        }
+    }
+
+    if (yClipped.any()) {
+        for (int yIndex = 0; yIndex < FA_Y_COUNT; ++yIndex) {
+            if (yClipped[yIndex]) {
+                clipped.set(faa_settings.YIndexToZIndex[yIndex]);
+            }
+        }
+    }
+
+    return clipped;
+}
+
+std::bitset<FA_Z_COUNT> ForceComponent::_clipZForces(const ClippingLimits<FA_Z_COUNT>& limits,
+                                                     std::vector<float>& preclippedZ,
+                                                     std::vector<float>& appliedZ) {
+    std::copy(zCurrent, zCurrent + FA_Z_COUNT, preclippedZ.begin());
+    return limits.clip(preclippedZ.data(), appliedZ.data());
+}
+
 void ForceComponent::_zeroTarget() {
     memset(xTarget, 0, sizeof(xTarget));
     memset(yTarget, 0, sizeof(yTarget));
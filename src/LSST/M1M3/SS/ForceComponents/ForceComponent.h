@@ -24,8 +24,12 @@
 #ifndef LSST_M1M3_SS_FORCECONTROLLER_FORCECOMPONENT_H_
 #define LSST_M1M3_SS_FORCECONTROLLER_FORCECOMPONENT_H_
 
+#include <bitset>
 #include <string>
+#include <vector>
 
+#include <ClippingLimits.h>
+#include <EventChangeTracker.h>
 #include <ForceComponentSettings.h>
 #include <cRIO/DataTypes.h>
 
@@ -141,6 +145,82 @@ protected:
      */
     virtual void postUpdateActions() = 0;
 
+    /**
+     * Returns true if current forces or force actuator settings changed since
+     * the last call. Components use this in postUpdateActions to skip
+     * clipping and forces and moments calculation of unchanged forces.
+     *
+     * @return true if current forces shall be processed
+     */
+    bool updateRequired();
+
+    /**
+     * Copies current forces into preclipped forces, and clips them into
+     * limits. Clipped forces are stored into applied forces.
+     *
+     * @tparam P preclipped forces type
+     * @tparam A applied forces type
+     *
+     * @param limits clipping limits
+     * @param preclipped preclipped forces
+     * @param applied applied (clipped) forces
+     *
+     * @return Z indexed mask of actuators with X, Y or Z force out of limits
+     */
+    template <typename P, typename A>
+    std::bitset<FA_Z_COUNT> clipForces(const ForceClippingLimits& limits, P& preclipped, A& applied) {
+        return _clipForces(limits, preclipped.xForces, preclipped.yForces, preclipped.zForces,
+                           applied.xForces, applied.yForces, applied.zForces);
+    }
+
+    /**
+     * Copies current Z forces into preclipped forces, and clips them into
+     * limits. Clipped forces are stored into applied forces.
+     *
+     * @tparam P preclipped forces type
+     * @tparam A applied forces type
+     *
+     * @param limits clipping limits
+     * @param preclipped preclipped forces
+     * @param applied applied (clipped) forces
+     *
+     * @return mask of actuators with Z force out of limits
+     */
+    template <typename P, typename A>
+    std::bitset<FA_Z_COUNT> clipZForces(const ClippingLimits<FA_Z_COUNT>& limits, P& preclipped,
+                                        A& applied) {
+        return _clipZForces(limits, preclipped.zForces, applied.zForces);
+    }
+
+    /**
+     * Sets force setpoint warnings of actuators which clipping state changed
+     * since the last call. Marks the event as changed if any warning changed.
+     *
+     * @param clipped Z indexed mask of clipped actuators
+     * @param warnings component warnings in force setpoint warning event
+     * @param tracker force setpoint warning event change tracker
+     *
+     * @return true if any actuator force is clipped
+     */
+    template <typename W>
+    bool setForceWarnings(const std::bitset<FA_Z_COUNT>& clipped, W& warnings, EventChangeTracker* tracker) {
+        std::bitset<FA_Z_COUNT> changed = clipped ^ _forceWarnings;
+        if (_forceWarningsSet == false) {
+            changed.set();
+            _forceWarningsSet = true;
+        }
+        if (changed.any()) {
+            for (int zIndex = 0; zIndex < FA_Z_COUNT; ++zIndex) {
+                if (changed[zIndex]) {
+                    warnings[zIndex] = clipped[zIndex];
+                }
+            }
+            _forceWarnings = clipped;
+            tracker->mark();
+        }
+        return clipped.any();
+    }
+
     /// measured actuator current X force
     float xCurrent[FA_X_COUNT];
     /// measured actuator current Y force
@@ -169,6 +249,21 @@ private:
 
     ForceComponentState _state;
 
+    bool _currentChanged;
+    uint32_t _settingsVersion;
+
+    // warnings as set in the force setpoint warning event
+    std::bitset<FA_Z_COUNT> _forceWarnings;
+    bool _forceWarningsSet;
+
+    std::bitset<FA_Z_COUNT> _clipForces(const ForceClippingLimits& limits, std::vector<float>& preclippedX,
+                                        std::vector<float>& preclippedY, std::vector<float>& preclippedZ,
+                                        std::vector<float>& appliedX, std::vector<float>& appliedY,
+                                        std::vector<float>& appliedZ);
+
+    std::bitset<FA_Z_COUNT> _clipZForces(const ClippingLimits<FA_Z_COUNT>& limits,
+                                         std::vector<float>& preclippedZ, std::vector<float>& appliedZ);
+
     /**
      * Zero target forces.
      */
@@ -0,0 +1,75 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstring>
+
+#include <ForceActuatorSettings.h>
+#include <ForcesAndMomentsCache.h>
+
+using namespace LSST::M1M3::SS;
+
+ForcesAndMomentsCache::ForcesAndMomentsCache() : _valid(false), _zOnly(false), _settingsVersion(0) {
+    _forcesAndMoments = ForcesAndMoments{0, 0, 0, 0, 0, 0, 0};
+}
+
+const ForcesAndMoments& ForcesAndMomentsCache::calculate(const std::vector<float>& xForces,
+                                                         const std::vector<float>& yForces,
+                                                         const std::vector<float>& zForces) {
+    auto& settings = ForceActuatorSettings::instance();
+
+    // all caches must be updated, don't short-circuit
+    bool changed = _update(xForces, _xForces) | _update(yForces, _yForces) | _update(zForces, _zForces);
+
+    if (changed || _valid == false || _zOnly || _settingsVersion != settings.getVersion()) {
+        _forcesAndMoments = settings.calculateForcesAndMoments(xForces, yForces, zForces);
+        _valid = true;
+        _zOnly = false;
+        _settingsVersion = settings.getVersion();
+    }
+
+    return _forcesAndMoments;
+}
+
+const ForcesAndMoments& ForcesAndMomentsCache::calculate(const std::vector<float>& zForces) {
+    auto& settings = ForceActuatorSettings::instance();
+
+    bool changed = _update(zForces, _zForces);
+
+    if (changed || _valid == false || _zOnly == false || _settingsVersion != settings.getVersion()) {
+        _forcesAndMoments = settings.calculateForcesAndMoments(zForces);
+        _valid = true;
+        _zOnly = true;
+        _settingsVersion = settings.getVersion();
+    }
+
+    return _forcesAndMoments;
+}
+
+bool ForcesAndMomentsCache::_update(const std::vector<float>& forces, std::vector<float>& cached) {
+    if (forces.size() == cached.size() &&
+        memcmp(forces.data(), cached.data(), forces.size() * sizeof(float)) == 0) {
+        return false;
+    }
+    cached = forces;
+    return true;
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef FORCESANDMOMENTSCACHE_H_
+#define FORCESANDMOMENTSCACHE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <ForcesAndMoments.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Caches mirror forces and moments calculated from actuator forces. Keeps
+ * copy of the forces used for the last calculation, and returns the last
+ * result if forces (bitwise compared, so NaNs are handled) and the actuator
+ * settings didn't change. Most force components are constant for long
+ * periods, so this saves the full calculation in the majority of cycles.
+ *
+ * Each owner shall use its own instance.
+ */
+class ForcesAndMomentsCache {
+public:
+    ForcesAndMomentsCache();
+
+    /**
+     * Returns forces and moments, recalculating them only if forces changed.
+     *
+     * @param xForces
+     * @param yForces
+     * @param zForces
+     */
+    const ForcesAndMoments& calculate(const std::vector<float>& xForces, const std::vector<float>& yForces,
+                                      const std::vector<float>& zForces);
+
+    /**
+     * Returns forces and moments calculated from Z forces only, recalculating
+     * them only if forces changed.
+     *
+     * @param zForces
+     */
+    const ForcesAndMoments& calculate(const std::vector<float>& zForces);
+
+    /**
+     * Forces the next calculate call to recalculate forces and moments.
+     */
+    void invalidate() { _valid = false; }
+
+private:
+    static bool _update(const std::vector<float>& forces, std::vector<float>& cached);
+
+    bool _valid;
+    bool _zOnly;
+    uint32_t _settingsVersion;
+
+    std::vector<float> _xForces;
+    std::vector<float> _yForces;
+    std::vector<float> _zForces;
+
+    ForcesAndMoments _forcesAndMoments;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* FORCESANDMOMENTSCACHE_H_ */
@@ -47,6 +47,8 @@ OffsetForceComponent::OffsetForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedOffsetForces = M1M3SSPublisher::instance().getEventAppliedOffsetForces();
     zeroOffsetForces();
 }
@@ -135,67 +137,35 @@ void OffsetForceComponent::postEnableDisableActions() {
 void OffsetForceComponent::postUpdateActions() {
     SPDLOG_TRACE("OffsetForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedOffsetForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_offset_forces.timestamp = _appliedOffsetForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->offsetForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().OffsetLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().OffsetLimitXTable[xIndex].HighFault;
-            _preclipped_offset_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange =
-                    !Range::InRangeAndCoerce(xLowFault, xHighFault, _preclipped_offset_forces.xForces[xIndex],
-                                             _appliedOffsetForces->xForces[xIndex]);
-            _forceSetpointWarning->offsetForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->offsetForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().OffsetLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().OffsetLimitYTable[yIndex].HighFault;
-            _preclipped_offset_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange =
-                    !Range::InRangeAndCoerce(yLowFault, yHighFault, _preclipped_offset_forces.yForces[yIndex],
-                                             _appliedOffsetForces->yForces[yIndex]);
-            _forceSetpointWarning->offsetForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->offsetForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().OffsetLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().OffsetLimitZTable[zIndex].HighFault;
-        _preclipped_offset_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_offset_forces.zForces[zIndex],
-                                         _appliedOffsetForces->zForces[zIndex]);
-        _forceSetpointWarning->offsetForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->offsetForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->offsetForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().OffsetLimits,
+                                                     _preclipped_offset_forces, *_appliedOffsetForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->offsetForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
+                _appliedOffsetForces->xForces, _appliedOffsetForces->yForces, _appliedOffsetForces->zForces);
+        _appliedOffsetForces->fx = fm.Fx;
+        _appliedOffsetForces->fy = fm.Fy;
+        _appliedOffsetForces->fz = fm.Fz;
+        _appliedOffsetForces->mx = fm.Mx;
+        _appliedOffsetForces->my = fm.My;
+        _appliedOffsetForces->mz = fm.Mz;
+        _appliedOffsetForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedOffsetForces->xForces, _appliedOffsetForces->yForces, _appliedOffsetForces->zForces);
-    _appliedOffsetForces->fx = fm.Fx;
-    _appliedOffsetForces->fy = fm.Fy;
-    _appliedOffsetForces->fz = fm.Fz;
-    _appliedOffsetForces->mx = fm.Mx;
-    _appliedOffsetForces->my = fm.My;
-    _appliedOffsetForces->mz = fm.Mz;
-    _appliedOffsetForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyOffsetForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyOffsetForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_offset_forces.has_unsent_changes())) {
         _preclipped_offset_forces.calculate_forces_and_moments();
         _preclipped_offset_forces.check_changes();
     }
-    M1M3SSPublisher::instance().logAppliedOffsetForces();
+    // applied forces event is sent only when changed
+    if (changed) {
+        M1M3SSPublisher::instance().logAppliedOffsetForces();
+    }
 }
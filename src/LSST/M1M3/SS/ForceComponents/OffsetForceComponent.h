@@ -26,7 +26,9 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include "EventChangeTracker.h"
 #include "ForceComponent.h"
+#include "ForcesAndMomentsCache.h"
 #include "PreclippedForces.h"
 #include "SafetyController.h"
 
@@ -57,6 +59,9 @@ private:
     SafetyController* _safetyController;
 
     MTM1M3_logevent_forceSetpointWarningC* _forceSetpointWarning;
+    EventChangeTracker* _forceSetpointWarningTracker;
+    ForcesAndMomentsCache _forcesAndMomentsCache;
+    bool _clippingRequired;
     MTM1M3_logevent_appliedOffsetForcesC* _appliedOffsetForces;
     PreclippedForces<MTM1M3_logevent_preclippedOffsetForcesC> _preclipped_offset_forces;
 };
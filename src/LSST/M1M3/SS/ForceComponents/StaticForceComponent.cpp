@@ -30,7 +30,6 @@
 #include "ForcesAndMoments.h"
 #include "M1M3SSPublisher.h"
 #include "Model.h"
-#include "Range.h"
 #include "SafetyController.h"
 #include "StaticForceComponent.h"
 
@@ -47,6 +46,8 @@ StaticForceComponent::StaticForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedStaticForces = M1M3SSPublisher::instance().getEventAppliedStaticForces();
 }
 
@@ -83,67 +84,35 @@ void StaticForceComponent::postEnableDisableActions() {
 void StaticForceComponent::postUpdateActions() {
     SPDLOG_TRACE("StaticForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedStaticForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_static_forces.timestamp = _appliedStaticForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->staticForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().StaticLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().StaticLimitXTable[xIndex].HighFault;
-            _preclipped_static_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange =
-                    !Range::InRangeAndCoerce(xLowFault, xHighFault, _preclipped_static_forces.xForces[xIndex],
-                                             _appliedStaticForces->xForces[xIndex]);
-            _forceSetpointWarning->staticForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->staticForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().StaticLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().StaticLimitYTable[yIndex].HighFault;
-            _preclipped_static_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange =
-                    !Range::InRangeAndCoerce(yLowFault, yHighFault, _preclipped_static_forces.yForces[yIndex],
-                                             _appliedStaticForces->yForces[yIndex]);
-            _forceSetpointWarning->staticForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->staticForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().StaticLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().StaticLimitZTable[zIndex].HighFault;
-        _preclipped_static_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_static_forces.zForces[zIndex],
-                                         _appliedStaticForces->zForces[zIndex]);
-        _forceSetpointWarning->staticForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->staticForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->staticForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().StaticLimits,
+                                                     _preclipped_static_forces, *_appliedStaticForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->staticForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
+                _appliedStaticForces->xForces, _appliedStaticForces->yForces, _appliedStaticForces->zForces);
+        _appliedStaticForces->fx = fm.Fx;
+        _appliedStaticForces->fy = fm.Fy;
+        _appliedStaticForces->fz = fm.Fz;
+        _appliedStaticForces->mx = fm.Mx;
+        _appliedStaticForces->my = fm.My;
+        _appliedStaticForces->mz = fm.Mz;
+        _appliedStaticForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedStaticForces->xForces, _appliedStaticForces->yForces, _appliedStaticForces->zForces);
-    _appliedStaticForces->fx = fm.Fx;
-    _appliedStaticForces->fy = fm.Fy;
-    _appliedStaticForces->fz = fm.Fz;
-    _appliedStaticForces->mx = fm.Mx;
-    _appliedStaticForces->my = fm.My;
-    _appliedStaticForces->mz = fm.Mz;
-    _appliedStaticForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyStaticForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyStaticForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_static_forces.has_unsent_changes())) {
         _preclipped_static_forces.calculate_forces_and_moments();
         _preclipped_static_forces.check_changes();
     }
-    M1M3SSPublisher::instance().logAppliedStaticForces();
+    // applied forces event is sent only when changed
+    if (changed) {
+        M1M3SSPublisher::instance().logAppliedStaticForces();
+    }
 }
@@ -47,6 +47,8 @@ ThermalForceComponent::ThermalForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedThermalForces = M1M3SSPublisher::instance().getAppliedThermalForces();
 }
 
@@ -107,65 +109,31 @@ void ThermalForceComponent::postEnableDisableActions() {
 void ThermalForceComponent::postUpdateActions() {
     SPDLOG_TRACE("ThermalForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedThermalForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_thermal_forces.timestamp = _appliedThermalForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->thermalForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().ThermalLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().ThermalLimitXTable[xIndex].HighFault;
-            _preclipped_thermal_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_thermal_forces.xForces[xIndex],
-                                                  _appliedThermalForces->xForces[xIndex]);
-            _forceSetpointWarning->thermalForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->thermalForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().ThermalLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().ThermalLimitYTable[yIndex].HighFault;
-            _preclipped_thermal_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_thermal_forces.yForces[yIndex],
-                                                  _appliedThermalForces->yForces[yIndex]);
-            _forceSetpointWarning->thermalForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->thermalForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().ThermalLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().ThermalLimitZTable[zIndex].HighFault;
-        _preclipped_thermal_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_thermal_forces.zForces[zIndex],
-                                         _appliedThermalForces->zForces[zIndex]);
-        _forceSetpointWarning->thermalForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->thermalForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->thermalForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().ThermalLimits,
+                                                     _preclipped_thermal_forces, *_appliedThermalForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->thermalForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(_appliedThermalForces->xForces,
+                                                                      _appliedThermalForces->yForces,
+                                                                      _appliedThermalForces->zForces);
+        _appliedThermalForces->fx = fm.Fx;
+        _appliedThermalForces->fy = fm.Fy;
+        _appliedThermalForces->fz = fm.Fz;
+        _appliedThermalForces->mx = fm.Mx;
+        _appliedThermalForces->my = fm.My;
+        _appliedThermalForces->mz = fm.Mz;
+        _appliedThermalForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedThermalForces->xForces, _appliedThermalForces->yForces, _appliedThermalForces->zForces);
-    _appliedThermalForces->fx = fm.Fx;
-    _appliedThermalForces->fy = fm.Fy;
-    _appliedThermalForces->fz = fm.Fz;
-    _appliedThermalForces->mx = fm.Mx;
-    _appliedThermalForces->my = fm.My;
-    _appliedThermalForces->mz = fm.Mz;
-    _appliedThermalForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyThermalForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyThermalForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_thermal_forces.has_unsent_changes())) {
         _preclipped_thermal_forces.calculate_forces_and_moments();
         _preclipped_thermal_forces.check_changes();
     }
@@ -30,7 +30,6 @@
 #include "ForcesAndMoments.h"
 #include "M1M3SSPublisher.h"
 #include "Model.h"
-#include "Range.h"
 #include "SafetyController.h"
 #include "VelocityForceComponent.h"
 
@@ -47,6 +46,8 @@ VelocityForceComponent::VelocityForceComponent()
                           static_cast<int>(ForceActuatorSettings::instance().preclippedMaxDelay * 1000.0))) {
     _safetyController = Model::instance().getSafetyController();
     _forceSetpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    _forceSetpointWarningTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+    _clippingRequired = false;
     _appliedVelocityForces = M1M3SSPublisher::instance().getAppliedVelocityForces();
 }
 
@@ -113,66 +114,31 @@ void VelocityForceComponent::postEnableDisableActions() {
 void VelocityForceComponent::postUpdateActions() {
     SPDLOG_TRACE("VelocityForceController: postUpdateActions()");
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
-    bool notInRange = false;
-    bool clippingRequired = false;
     _appliedVelocityForces->timestamp = M1M3SSPublisher::instance().getTimestamp();
     _preclipped_velocity_forces.timestamp = _appliedVelocityForces->timestamp;
-    for (int zIndex = 0; zIndex < FA_Z_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-
-        _forceSetpointWarning->velocityForceWarning[zIndex] = false;
-
-        if (xIndex != -1) {
-            float xLowFault = ForceActuatorSettings::instance().VelocityLimitXTable[xIndex].LowFault;
-            float xHighFault = ForceActuatorSettings::instance().VelocityLimitXTable[xIndex].HighFault;
-            _preclipped_velocity_forces.xForces[xIndex] = xCurrent[xIndex];
-            notInRange = !Range::InRangeAndCoerce(xLowFault, xHighFault,
-                                                  _preclipped_velocity_forces.xForces[xIndex],
-                                                  _appliedVelocityForces->xForces[xIndex]);
-            _forceSetpointWarning->velocityForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->velocityForceWarning[zIndex];
-        }
-
-        if (yIndex != -1) {
-            float yLowFault = ForceActuatorSettings::instance().VelocityLimitYTable[yIndex].LowFault;
-            float yHighFault = ForceActuatorSettings::instance().VelocityLimitYTable[yIndex].HighFault;
-            _preclipped_velocity_forces.yForces[yIndex] = yCurrent[yIndex];
-            notInRange = !Range::InRangeAndCoerce(yLowFault, yHighFault,
-                                                  _preclipped_velocity_forces.yForces[yIndex],
-                                                  _appliedVelocityForces->yForces[yIndex]);
-            _forceSetpointWarning->velocityForceWarning[zIndex] =
-                    notInRange || _forceSetpointWarning->velocityForceWarning[zIndex];
-        }
-
-        float zLowFault = ForceActuatorSettings::instance().VelocityLimitZTable[zIndex].LowFault;
-        float zHighFault = ForceActuatorSettings::instance().VelocityLimitZTable[zIndex].HighFault;
-        _preclipped_velocity_forces.zForces[zIndex] = zCurrent[zIndex];
-        notInRange =
-                !Range::InRangeAndCoerce(zLowFault, zHighFault, _preclipped_velocity_forces.zForces[zIndex],
-                                         _appliedVelocityForces->zForces[zIndex]);
-        _forceSetpointWarning->velocityForceWarning[zIndex] =
-                notInRange || _forceSetpointWarning->velocityForceWarning[zIndex];
-        clippingRequired = _forceSetpointWarning->velocityForceWarning[zIndex] || clippingRequired;
+    bool changed = updateRequired();
+    if (changed) {
+        std::bitset<FA_Z_COUNT> clipped = clipForces(ForceActuatorSettings::instance().VelocityLimits,
+                                                     _preclipped_velocity_forces, *_appliedVelocityForces);
+        _clippingRequired = setForceWarnings(clipped, _forceSetpointWarning->velocityForceWarning,
+                                             _forceSetpointWarningTracker);
+
+        const ForcesAndMoments& fm = _forcesAndMomentsCache.calculate(
+                _appliedVelocityForces->xForces, _appliedVelocityForces->yForces,
+                _appliedVelocityForces->zForces);
+        _appliedVelocityForces->fx = fm.Fx;
+        _appliedVelocityForces->fy = fm.Fy;
+        _appliedVelocityForces->fz = fm.Fz;
+        _appliedVelocityForces->mx = fm.Mx;
+        _appliedVelocityForces->my = fm.My;
+        _appliedVelocityForces->mz = fm.Mz;
+        _appliedVelocityForces->forceMagnitude = fm.ForceMagnitude;
     }
 
-    ForcesAndMoments fm = ForceActuatorSettings::instance().calculateForcesAndMoments(
-            _appliedVelocityForces->xForces, _appliedVelocityForces->yForces,
-            _appliedVelocityForces->zForces);
-    _appliedVelocityForces->fx = fm.Fx;
-    _appliedVelocityForces->fy = fm.Fy;
-    _appliedVelocityForces->fz = fm.Fz;
-    _appliedVelocityForces->mx = fm.Mx;
-    _appliedVelocityForces->my = fm.My;
-    _appliedVelocityForces->mz = fm.Mz;
-    _appliedVelocityForces->forceMagnitude = fm.ForceMagnitude;
-
-    _safetyController->forceControllerNotifyVelocityForceClipping(clippingRequired);
+    _safetyController->forceControllerNotifyVelocityForceClipping(_clippingRequired);
 
     M1M3SSPublisher::instance().tryLogForceSetpointWarning();
-    if (clippingRequired) {
+    if (_clippingRequired && (changed || _preclipped_velocity_forces.has_unsent_changes())) {
         _preclipped_velocity_forces.calculate_forces_and_moments();
         _preclipped_velocity_forces.check_changes();
     }
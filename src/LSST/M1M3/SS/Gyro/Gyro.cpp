@@ -32,6 +32,7 @@
 #include <GyroSettings.h>
 #include <IFPGA.h>
 #include <M1M3SSPublisher.h>
+#include <SafetyController.h>
 #include <SupportFPGAData.h>
 #include <Timestamp.h>
 
@@ -39,12 +40,90 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+namespace {
+
+typedef MTM1M3_logevent_gyroWarningC W;
+typedef Gyro::GyroWarningTable GyroWarningTable;
+
+const GyroWarningTable::Entry errorEntries[] = {
+        {&W::invalidHeaderWarning, 0, GyroWarningTable::codeWord(1), false, nullptr},
+        {&W::crcMismatchWarning, 0, GyroWarningTable::codeWord(2) | GyroWarningTable::codeWord(4), false,
+         nullptr},
+        {&W::incompleteFrameWarning, 0, GyroWarningTable::codeWord(3), false, nullptr},
+        // TODO: Add Checksum Error
+};
+
+const GyroWarningTable::Entry bitEntries[] = {
+        {&W::gyroXSLDWarning, 0, 0x01, true, nullptr},
+        {&W::gyroXMODDACWarning, 0, 0x02, true, nullptr},
+        {&W::gyroXPhaseWarning, 0, 0x04, true, nullptr},
+        {&W::gyroXFlashWarning, 0, 0x08, true, nullptr},
+        {&W::gyroYSLDWarning, 0, 0x10, true, nullptr},
+        {&W::gyroYMODDACWarning, 0, 0x20, true, nullptr},
+        {&W::gyroYPhaseWarning, 0, 0x40, true, nullptr},
+        {&W::gyroYFlashWarning, 1, 0x01, true, nullptr},
+        {&W::gyroZSLDWarning, 1, 0x02, true, nullptr},
+        {&W::gyroZMODDACWarning, 1, 0x04, true, nullptr},
+        {&W::gyroZPhaseWarning, 1, 0x08, true, nullptr},
+        {&W::gyroZFlashWarning, 1, 0x10, true, nullptr},
+        {&W::gyroAccelXStatusWarning, 1, 0x20, true, nullptr},
+        {&W::gyroAccelYStatusWarning, 1, 0x40, true, nullptr},
+        {&W::gyroAccelZStatusWarning, 2, 0x01, true, nullptr},
+        {&W::gyroXPZTTemperatureStatusWarning, 2, 0x02, true, nullptr},
+        {&W::gyroXSLDTemperatureStatusWarning, 2, 0x04, true, nullptr},
+        {&W::gyroYPZTTemperatureStatusWarning, 2, 0x08, true, nullptr},
+        {&W::gyroYSLDTemperatureStatusWarning, 2, 0x10, true, nullptr},
+        {&W::gyroZPZTTemperatureStatusWarning, 2, 0x20, true, nullptr},
+        {&W::gyroZSLDTemperatureStatusWarning, 2, 0x40, true, nullptr},
+        {&W::gyroAccelXTemperatureStatusWarning, 3, 0x01, true, nullptr},
+        {&W::gyroAccelYTemperatureStatusWarning, 3, 0x02, true, nullptr},
+        {&W::gyroAccelZTemperatureStatusWarning, 3, 0x04, true, nullptr},
+        {&W::gcbTemperatureStatusWarning, 3, 0x08, true, nullptr},
+        {&W::temperatureStatusWarning, 3, 0x10, true, nullptr},
+        {&W::gcbDSPSPIFlashStatusWarning, 3, 0x20, true, nullptr},
+        {&W::gcbFPGASPIFlashStatusWarning, 3, 0x40, true, nullptr},
+        {&W::dspSPIFlashStatusWarning, 4, 0x01, true, nullptr},
+        {&W::fpgaSPIFlashStatusWarning, 4, 0x02, true, nullptr},
+        {&W::gcb1_2VStatusWarning, 4, 0x04, true, nullptr},
+        {&W::gcb3_3VStatusWarning, 4, 0x08, true, nullptr},
+        {&W::gcb5VStatusWarning, 4, 0x10, true, nullptr},
+        {&W::v1_2StatusWarning, 4, 0x20, true, nullptr},
+        {&W::v3_3StatusWarning, 4, 0x40, true, nullptr},
+        {&W::v5StatusWarning, 5, 0x01, true, nullptr},
+        {&W::v15StatusWarning, 5, 0x02, true, nullptr},
+        {&W::gcbFPGAStatusWarning, 5, 0x04, true, nullptr},
+        {&W::fpgaStatusWarning, 5, 0x08, true, nullptr},
+        {&W::hiSpeedSPORTStatusWarning, 5, 0x10, true, nullptr},
+        {&W::auxSPORTStatusWarning, 5, 0x20, true, nullptr},
+        {&W::sufficientSoftwareResourcesWarning, 5, 0x40, true, nullptr},
+        {&W::gyroEOVoltsPositiveWarning, 6, 0x01, true, nullptr},
+        {&W::gyroEOVoltsNegativeWarning, 6, 0x02, true, nullptr},
+        {&W::gyroXVoltsWarning, 6, 0x04, true, nullptr},
+        {&W::gyroYVoltsWarning, 6, 0x08, true, nullptr},
+        {&W::gyroZVoltsWarning, 6, 0x10, true, nullptr},
+        {&W::gcbADCCommsWarning, 7, 0x01, true, nullptr},
+        {&W::mSYNCExternalTimingWarning, 7, 0x02, true, nullptr},
+};
+
+const GyroWarningTable::Entry statusEntries[] = {
+        {&W::gyroXStatusWarning, 0, 0x01, true, nullptr},
+        {&W::gyroYStatusWarning, 0, 0x02, true, nullptr},
+        {&W::gyroZStatusWarning, 0, 0x04, true, nullptr},
+};
+
+}  // namespace
+
+const Gyro::GyroWarningTable Gyro::ERROR_TABLE(errorEntries);
+const Gyro::GyroWarningTable Gyro::BIT_TABLE(bitEntries);
+const Gyro::GyroWarningTable Gyro::STATUS_TABLE(statusEntries);
+
 Gyro::Gyro() {
     SPDLOG_DEBUG("Gyro: Gyro()");
     _gyroSettings = &GyroSettings::instance();
 
     _gyroData = M1M3SSPublisher::instance().getGyroData();
     _gyroWarning = M1M3SSPublisher::instance().getEventGyroWarning();
+    _gyroWarningTracker = M1M3SSPublisher::instance().getEventGyroWarningTracker();
 
     _lastBITTimestamp = 0;
     _lastErrorTimestamp = 0;
@@ -54,6 +133,7 @@ Gyro::Gyro() {
 
     memset(_gyroData, 0, sizeof(MTM1M3_gyroDataC));
     memset(_gyroWarning, 0, sizeof(MTM1M3_logevent_gyroWarningC));
+    _gyroWarningTracker->mark();
 }
 
 void Gyro::bit() {
@@ -118,72 +198,19 @@ void Gyro::processData() {
         _lastErrorTimestamp = fpgaData->GyroErrorTimestamp;
         _errorCleared = false;
         _gyroWarning->timestamp = Timestamp::fromFPGA(fpgaData->GyroErrorTimestamp);
-        _gyroWarning->invalidHeaderWarning = fpgaData->GyroErrorCode == 1;
-        _gyroWarning->crcMismatchWarning = fpgaData->GyroErrorCode == 2 || fpgaData->GyroErrorCode == 4;
-        _gyroWarning->incompleteFrameWarning = fpgaData->GyroErrorCode == 3;
-        // TODO: Add Checksum Error
+        uint32_t errorWord = GyroWarningTable::codeWord(fpgaData->GyroErrorCode);
+        ERROR_TABLE.decode(&errorWord, _gyroWarning, _gyroWarningTracker, nullptr);
+        _gyroWarningTracker->mark();
         tryLogWarning = true;
     }
     if (fpgaData->GyroBITTimestamp > _lastBITTimestamp) {
         _lastBITTimestamp = fpgaData->GyroBITTimestamp;
         _gyroWarning->timestamp = Timestamp::fromFPGA(fpgaData->GyroBITTimestamp);
-        uint8_t word0 = fpgaData->GyroBIT0;
-        _gyroWarning->gyroXSLDWarning = (word0 & 0x01) == 0;
-        _gyroWarning->gyroXMODDACWarning = (word0 & 0x02) == 0;
-        _gyroWarning->gyroXPhaseWarning = (word0 & 0x04) == 0;
-        _gyroWarning->gyroXFlashWarning = (word0 & 0x08) == 0;
-        _gyroWarning->gyroYSLDWarning = (word0 & 0x10) == 0;
-        _gyroWarning->gyroYMODDACWarning = (word0 & 0x20) == 0;
-        _gyroWarning->gyroYPhaseWarning = (word0 & 0x40) == 0;
-        uint8_t word1 = fpgaData->GyroBIT1;
-        _gyroWarning->gyroYFlashWarning = (word1 & 0x01) == 0;
-        _gyroWarning->gyroZSLDWarning = (word1 & 0x02) == 0;
-        _gyroWarning->gyroZMODDACWarning = (word1 & 0x04) == 0;
-        _gyroWarning->gyroZPhaseWarning = (word1 & 0x08) == 0;
-        _gyroWarning->gyroZFlashWarning = (word1 & 0x10) == 0;
-        _gyroWarning->gyroAccelXStatusWarning = (word1 & 0x20) == 0;
-        _gyroWarning->gyroAccelYStatusWarning = (word1 & 0x40) == 0;
-        uint8_t word2 = fpgaData->GyroBIT2;
-        _gyroWarning->gyroAccelZStatusWarning = (word2 & 0x10) == 0;
-        _gyroWarning->gyroXPZTTemperatureStatusWarning = (word2 & 0x02) == 0;
-        _gyroWarning->gyroXSLDTemperatureStatusWarning = (word2 & 0x04) == 0;
-        _gyroWarning->gyroYPZTTemperatureStatusWarning = (word2 & 0x08) == 0;
-        _gyroWarning->gyroYSLDTemperatureStatusWarning = (word2 & 0x10) == 0;
-        _gyroWarning->gyroZPZTTemperatureStatusWarning = (word2 & 0x20) == 0;
-        _gyroWarning->gyroZSLDTemperatureStatusWarning = (word2 & 0x40) == 0;
-        uint8_t word3 = fpgaData->GyroBIT3;
-        _gyroWarning->gyroAccelXTemperatureStatusWarning = (word3 & 0x01) == 0;
-        _gyroWarning->gyroAccelYTemperatureStatusWarning = (word3 & 0x02) == 0;
-        _gyroWarning->gyroAccelZTemperatureStatusWarning = (word3 & 0x04) == 0;
-        _gyroWarning->gcbTemperatureStatusWarning = (word3 & 0x08) == 0;
-        _gyroWarning->temperatureStatusWarning = (word3 & 0x10) == 0;
-        _gyroWarning->gcbDSPSPIFlashStatusWarning = (word3 & 0x20) == 0;
-        _gyroWarning->gcbFPGASPIFlashStatusWarning = (word3 & 0x40) == 0;
-        uint8_t word4 = fpgaData->GyroBIT4;
-        _gyroWarning->dspSPIFlashStatusWarning = (word4 & 0x01) == 0;
-        _gyroWarning->fpgaSPIFlashStatusWarning = (word4 & 0x02) == 0;
-        _gyroWarning->gcb1_2VStatusWarning = (word4 & 0x04) == 0;
-        _gyroWarning->gcb3_3VStatusWarning = (word4 & 0x08) == 0;
-        _gyroWarning->gcb5VStatusWarning = (word4 & 0x10) == 0;
-        _gyroWarning->v1_2StatusWarning = (word4 & 0x20) == 0;
-        _gyroWarning->v3_3StatusWarning = (word4 & 0x40) == 0;
-        uint8_t word5 = fpgaData->GyroBIT5;
-        _gyroWarning->v5StatusWarning = (word5 & 0x01) == 0;
-        _gyroWarning->v15StatusWarning = (word5 & 0x02) == 0;
-        _gyroWarning->gcbFPGAStatusWarning = (word5 & 0x04) == 0;
-        _gyroWarning->fpgaStatusWarning = (word5 & 0x08) == 0;
-        _gyroWarning->hiSpeedSPORTStatusWarning = (word5 & 0x10) == 0;
-        _gyroWarning->auxSPORTStatusWarning = (word5 & 0x20) == 0;
-        _gyroWarning->sufficientSoftwareResourcesWarning = (word5 & 0x40) == 0;
-        uint8_t word6 = fpgaData->GyroBIT6;
-        _gyroWarning->gyroEOVoltsPositiveWarning = (word6 & 0x01) == 0;
-        _gyroWarning->gyroEOVoltsNegativeWarning = (word6 & 0x02) == 0;
-        _gyroWarning->gyroXVoltsWarning = (word6 & 0x04) == 0;
-        _gyroWarning->gyroYVoltsWarning = (word6 & 0x08) == 0;
-        _gyroWarning->gyroZVoltsWarning = (word6 & 0x10) == 0;
-        uint8_t word7 = fpgaData->GyroBIT7;
-        _gyroWarning->gcbADCCommsWarning = (word7 & 0x01) == 0;
-        _gyroWarning->mSYNCExternalTimingWarning = (word7 & 0x02) == 0;
+        uint32_t words[8] = {fpgaData->GyroBIT0, fpgaData->GyroBIT1, fpgaData->GyroBIT2,
+                             fpgaData->GyroBIT3, fpgaData->GyroBIT4, fpgaData->GyroBIT5,
+                             fpgaData->GyroBIT6, fpgaData->GyroBIT7};
+        BIT_TABLE.decode(words, _gyroWarning, _gyroWarningTracker, nullptr);
+        _gyroWarningTracker->mark();
         tryLogWarning = true;
     }
     if (fpgaData->GyroSampleTimestamp > _lastSampleTimestamp) {
@@ -194,20 +221,16 @@ void Gyro::processData() {
         _gyroData->angularVelocityZ = fpgaData->GyroRawZ + _gyroSettings->angularVelocityOffset[2];
         _gyroData->sequenceNumber = fpgaData->GyroSequenceNumber;
         _gyroData->temperature = fpgaData->GyroTemperature;
-        uint8_t status = fpgaData->GyroStatus;
-        _gyroWarning->gyroXStatusWarning = (status & 0x01) == 0;
-        _gyroWarning->gyroYStatusWarning = (status & 0x02) == 0;
-        _gyroWarning->gyroZStatusWarning = (status & 0x04) == 0;
+        uint32_t status = fpgaData->GyroStatus;
+        STATUS_TABLE.decode(&status, _gyroWarning, _gyroWarningTracker, nullptr);
         M1M3SSPublisher::instance().putGyroData();
         tryLogWarning = true;
         if (!_errorCleared && fpgaData->GyroSampleTimestamp > _lastErrorTimestamp) {
             _lastErrorTimestamp = fpgaData->GyroErrorTimestamp;
             _errorCleared = true;
             _gyroWarning->timestamp = Timestamp::fromFPGA(fpgaData->GyroSampleTimestamp);
-            _gyroWarning->invalidHeaderWarning = false;
-            _gyroWarning->crcMismatchWarning = false;
-            _gyroWarning->incompleteFrameWarning = false;
-            // TODO: Add Checksum Error
+            ERROR_TABLE.clear(_gyroWarning, _gyroWarningTracker, nullptr);
+            _gyroWarningTracker->mark();
             tryLogWarning = true;
         }
     }
@@ -24,8 +24,10 @@
 #ifndef GYRO_H_
 #define GYRO_H_
 
+#include <EventChangeTracker.h>
 #include <GyroSettings.h>
 #include <SupportFPGAData.h>
+#include <WarningTable.h>
 #include <cRIO/DataTypes.h>
 #include <string>
 
@@ -36,6 +38,8 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+class SafetyController;
+
 /*!
  * The class used to process gyro data.
  */
@@ -87,6 +91,15 @@ public:
      */
     void processData();
 
+    typedef WarningTable<MTM1M3_logevent_gyroWarningC, SafetyController> GyroWarningTable;
+
+    //* decodes GyroErrorCode
+    static const GyroWarningTable ERROR_TABLE;
+    //* decodes GyroBIT0-7 words
+    static const GyroWarningTable BIT_TABLE;
+    //* decodes GyroStatus
+    static const GyroWarningTable STATUS_TABLE;
+
 private:
     /*!
      * Writes a command to the gyro.
@@ -98,6 +111,7 @@ private:
 
     MTM1M3_gyroDataC* _gyroData;
     MTM1M3_logevent_gyroWarningC* _gyroWarning;
+    EventChangeTracker* _gyroWarningTracker;
 
     uint64_t _lastSampleTimestamp;
     uint64_t _lastBITTimestamp;
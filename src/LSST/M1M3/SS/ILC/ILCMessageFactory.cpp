@@ -143,11 +143,28 @@ void ILCMessageFactory::broadcastForceDemand(ModbusBuffer* buffer, uint8_t broad
         buffer->writeI24(daaPrimarySetpoint[i]);
         buffer->writeI24(daaSecondarySetpoint[i]);
     }
-    buffer->writeCRC(244);
+    buffer->writeCRC(BROADCAST_FORCE_DEMAND_LENGTH);
     buffer->writeEndOfFrame();
     buffer->writeDelay(_ilcApplicationSettings->BroadcastForceDemand);
 }
 
+void ILCMessageFactory::patchBroadcastForceDemand(ModbusFramePatcher* patcher, uint8_t broadcastCounter,
+                                                  uint8_t boosterValves, int32_t* saaPrimarySetpoint,
+                                                  int32_t* daaPrimarySetpoint,
+                                                  int32_t* daaSecondarySetpoint) {
+    patcher->patchU8(2, broadcastCounter);
+    patcher->patchU8(3, boosterValves);
+    int32_t offset = 4;
+    for (int i = 0; i < 16; i++, offset += 3) {
+        patcher->patchI24(offset, saaPrimarySetpoint[i]);
+    }
+    for (int i = 0; i < 32; i++, offset += 6) {
+        patcher->patchI24(offset, daaPrimarySetpoint[i]);
+        patcher->patchI24(offset + 3, daaSecondarySetpoint[i]);
+    }
+    patcher->writeCRC();
+}
+
 void ILCMessageFactory::unicastForceDemand(ModbusBuffer* buffer, uint8_t address, uint8_t boosterValve,
                                            int32_t primarySetpoint, int32_t secondarySetpoint = 0) {
     if (address <= 16) {
@@ -26,6 +26,7 @@
 
 #include <ILCApplicationSettings.h>
 #include <ModbusBuffer.h>
+#include <ModbusFramePatcher.h>
 #include <cRIO/DataTypes.h>
 
 namespace LSST {
@@ -60,6 +61,26 @@ public:
     void broadcastForceDemand(ModbusBuffer* buffer, uint8_t broadcastCounter, uint8_t boosterValves,
                               int32_t* saaPrimarySetpoint, int32_t* daaPrimarySetpoint,
                               int32_t* daaSecondarySetpoint);
+
+    /**
+     * Patches setpoints of broadcast force demand frame written by
+     * broadcastForceDemand. Only changed bytes are written.
+     *
+     * @param patcher patcher attached to frame written by broadcastForceDemand,
+     * with BROADCAST_FORCE_DEMAND_LENGTH length
+     * @param broadcastCounter broadcast counter
+     * @param boosterValves booster valves status
+     * @param saaPrimarySetpoint 16 single axis primary setpoints
+     * @param daaPrimarySetpoint 32 dual axis primary setpoints
+     * @param daaSecondarySetpoint 32 dual axis secondary setpoints
+     */
+    static void patchBroadcastForceDemand(ModbusFramePatcher* patcher, uint8_t broadcastCounter,
+                                          uint8_t boosterValves, int32_t* saaPrimarySetpoint,
+                                          int32_t* daaPrimarySetpoint, int32_t* daaSecondarySetpoint);
+
+    /// length of broadcast force demand frame, without CRC
+    static constexpr int32_t BROADCAST_FORCE_DEMAND_LENGTH = 4 + 16 * 3 + 32 * 6;
+
     void unicastForceDemand(ModbusBuffer* buffer, uint8_t address, uint8_t boosterValve,
                             int32_t primarySetpoint, int32_t secondarySetpoint);
     void unicastSingleAxisForceDemand(ModbusBuffer* buffer, uint8_t address, uint8_t boosterValve,
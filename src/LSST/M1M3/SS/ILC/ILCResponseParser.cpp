@@ -63,6 +63,12 @@ ILCResponseParser::ILCResponseParser() {
     _hardpointMonitorInfo = 0;
     _hardpointMonitorState = 0;
     _hardpointMonitorWarning = 0;
+    _hardpointActuatorInfoTracker = 0;
+    _hardpointActuatorStateTracker = 0;
+    _forceActuatorStateTracker = 0;
+    _hardpointMonitorInfoTracker = 0;
+    _hardpointMonitorStateTracker = 0;
+    _hardpointMonitorWarningTracker = 0;
     _hardpointMonitorData = 0;
     _outerLoopData = 0;
 }
@@ -80,6 +86,12 @@ ILCResponseParser::ILCResponseParser(ILCSubnetData* subnetData, SafetyController
     _hardpointMonitorInfo = M1M3SSPublisher::instance().getEventHardpointMonitorInfo();
     _hardpointMonitorState = M1M3SSPublisher::instance().getEventHardpointMonitorState();
     _hardpointMonitorWarning = M1M3SSPublisher::instance().getEventHardpointMonitorWarning();
+    _hardpointActuatorInfoTracker = M1M3SSPublisher::instance().getEventHardpointActuatorInfoTracker();
+    _hardpointActuatorStateTracker = M1M3SSPublisher::instance().getEventHardpointActuatorStateTracker();
+    _forceActuatorStateTracker = M1M3SSPublisher::instance().getEventForceActuatorStateTracker();
+    _hardpointMonitorInfoTracker = M1M3SSPublisher::instance().getEventHardpointMonitorInfoTracker();
+    _hardpointMonitorStateTracker = M1M3SSPublisher::instance().getEventHardpointMonitorStateTracker();
+    _hardpointMonitorWarningTracker = M1M3SSPublisher::instance().getEventHardpointMonitorWarningTracker();
     _hardpointMonitorData = M1M3SSPublisher::instance().getHardpointMonitorData();
     _outerLoopData = M1M3SSPublisher::instance().getOuterLoopData();
 
@@ -450,49 +462,60 @@ void ILCResponseParser::_parseErrorResponse(ModbusBuffer* buffer, uint8_t called
 
 void ILCResponseParser::_parseReportHPServerIDResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
     uint8_t length = buffer->readU8();
-    _hardpointActuatorInfo->ilcUniqueId[ilc.DataIndex] = buffer->readU48();
-    _hardpointActuatorInfo->ilcApplicationType[ilc.DataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->networkNodeType[ilc.DataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->ilcSelectedOptions[ilc.DataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->networkNodeOptions[ilc.DataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->majorRevision[ilc.DataIndex] = buffer->readU8();
-    _hardpointActuatorInfo->minorRevision[ilc.DataIndex] = buffer->readU8();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->ilcUniqueId[ilc.DataIndex], buffer->readU48());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->ilcApplicationType[ilc.DataIndex],
+                                       buffer->readU8());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->networkNodeType[ilc.DataIndex],
+                                       buffer->readU8());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->ilcSelectedOptions[ilc.DataIndex],
+                                       buffer->readU8());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->networkNodeOptions[ilc.DataIndex],
+                                       buffer->readU8());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->majorRevision[ilc.DataIndex],
+                                       buffer->readU8());
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->minorRevision[ilc.DataIndex],
+                                       buffer->readU8());
     buffer->incIndex(length - 12);
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseReportHMServerIDResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
     uint8_t length = buffer->readU8();
-    _hardpointMonitorInfo->ilcUniqueId[ilc.DataIndex] = buffer->readU48();
-    _hardpointMonitorInfo->ilcApplicationType[ilc.DataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->networkNodeType[ilc.DataIndex] = buffer->readU8();
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->ilcUniqueId[ilc.DataIndex], buffer->readU48());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->ilcApplicationType[ilc.DataIndex],
+                                      buffer->readU8());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->networkNodeType[ilc.DataIndex],
+                                      buffer->readU8());
     buffer->readU8();  // ILCSelectedOptions
     buffer->readU8();  // NetworkNodeOptions
-    _hardpointMonitorInfo->majorRevision[ilc.DataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->minorRevision[ilc.DataIndex] = buffer->readU8();
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->majorRevision[ilc.DataIndex], buffer->readU8());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->minorRevision[ilc.DataIndex], buffer->readU8());
     buffer->incIndex(length - 12);
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseReportHPServerStatusResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointActuatorState->ilcState[ilc.DataIndex] = buffer->readU8();
+    _hardpointActuatorStateTracker->set(_hardpointActuatorState->ilcState[ilc.DataIndex], buffer->readU8());
     HardpointActuatorWarning::instance().parseIlcStatus(buffer, ilc.DataIndex);
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseReportFAServerStatusResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _forceActuatorState->ilcState[ilc.DataIndex] = buffer->readU8();
+    _forceActuatorStateTracker->set(_forceActuatorState->ilcState[ilc.DataIndex], buffer->readU8());
     M1M3SSPublisher::getForceActuatorWarning()->parseFAServerStatusResponse(buffer, ilc.DataIndex);
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointMonitorState->ilcState[ilc.DataIndex] = buffer->readU8();
+    _hardpointMonitorStateTracker->set(_hardpointMonitorState->ilcState[ilc.DataIndex], buffer->readU8());
     uint16_t ilcStatus = buffer->readU16();
-    _hardpointMonitorWarning->majorFault[ilc.DataIndex] = (ilcStatus & 0x0001) != 0;
-    _hardpointMonitorWarning->minorFault[ilc.DataIndex] = (ilcStatus & 0x0002) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->majorFault[ilc.DataIndex],
+                                         (ilcStatus & 0x0001) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->minorFault[ilc.DataIndex],
+                                         (ilcStatus & 0x0002) != 0);
     // 0x0004 is reserved
-    _hardpointMonitorWarning->faultOverride[ilc.DataIndex] = (ilcStatus & 0x0008) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->faultOverride[ilc.DataIndex],
+                                         (ilcStatus & 0x0008) != 0);
     // 0x0010 is main calibration error (not used by HM)
     // 0x0020 is backup calibration error (not used by HM)
     // 0x0040 is reserved
@@ -506,39 +529,51 @@ void ILCResponseParser::_parseReportHMServerStatusResponse(ModbusBuffer* buffer,
     // 0x4000 is DCA firmware update (FA only)
     // 0x8000 is reserved
     uint16_t ilcFaults = buffer->readU16();
-    _hardpointMonitorWarning->uniqueIdCRCError[ilc.DataIndex] = (ilcFaults & 0x0001) != 0;
-    _hardpointMonitorWarning->applicationTypeMismatch[ilc.DataIndex] = (ilcFaults & 0x0002) != 0;
-    _hardpointMonitorWarning->applicationMissing[ilc.DataIndex] = (ilcFaults & 0x0004) != 0;
-    _hardpointMonitorWarning->applicationCRCMismatch[ilc.DataIndex] = (ilcFaults & 0x0008) != 0;
-    _hardpointMonitorWarning->oneWireMissing[ilc.DataIndex] = (ilcFaults & 0x0010) != 0;
-    _hardpointMonitorWarning->oneWire1Mismatch[ilc.DataIndex] = (ilcFaults & 0x0020) != 0;
-    _hardpointMonitorWarning->oneWire2Mismatch[ilc.DataIndex] = (ilcFaults & 0x0040) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->uniqueIdCRCError[ilc.DataIndex],
+                                         (ilcFaults & 0x0001) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->applicationTypeMismatch[ilc.DataIndex],
+                                         (ilcFaults & 0x0002) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->applicationMissing[ilc.DataIndex],
+                                         (ilcFaults & 0x0004) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->applicationCRCMismatch[ilc.DataIndex],
+                                         (ilcFaults & 0x0008) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->oneWireMissing[ilc.DataIndex],
+                                         (ilcFaults & 0x0010) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->oneWire1Mismatch[ilc.DataIndex],
+                                         (ilcFaults & 0x0020) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->oneWire2Mismatch[ilc.DataIndex],
+                                         (ilcFaults & 0x0040) != 0);
     // 0x0080 is reserved
-    _hardpointMonitorWarning->watchdogReset[ilc.DataIndex] = (ilcFaults & 0x0100) != 0;
-    _hardpointMonitorWarning->brownOut[ilc.DataIndex] = (ilcFaults & 0x0200) != 0;
-    _hardpointMonitorWarning->eventTrapReset[ilc.DataIndex] = (ilcFaults & 0x0400) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->watchdogReset[ilc.DataIndex],
+                                         (ilcFaults & 0x0100) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->brownOut[ilc.DataIndex],
+                                         (ilcFaults & 0x0200) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->eventTrapReset[ilc.DataIndex],
+                                         (ilcFaults & 0x0400) != 0);
     // 0x0800 is Motor Driver (HP only)
-    _hardpointMonitorWarning->ssrPowerFault[ilc.DataIndex] = (ilcFaults & 0x1000) != 0;
-    _hardpointMonitorWarning->auxPowerFault[ilc.DataIndex] = (ilcFaults & 0x2000) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->ssrPowerFault[ilc.DataIndex],
+                                         (ilcFaults & 0x1000) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->auxPowerFault[ilc.DataIndex],
+                                         (ilcFaults & 0x2000) != 0);
     // 0x4000 is SMC Power (HP only)
     // 0x8000 is reserved
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseChangeHPILCModeResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointActuatorState->ilcState[ilc.DataIndex] = buffer->readU16();
+    _hardpointActuatorStateTracker->set(_hardpointActuatorState->ilcState[ilc.DataIndex], buffer->readU16());
     // buffer->readU8();
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseChangeFAILCModeResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _forceActuatorState->ilcState[ilc.DataIndex] = buffer->readU16();
+    _forceActuatorStateTracker->set(_forceActuatorState->ilcState[ilc.DataIndex], buffer->readU16());
     // buffer->readU8();
     buffer->skipToNextFrame();
 }
 
 void ILCResponseParser::_parseChangeHMILCModeResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointMonitorState->ilcState[ilc.DataIndex] = buffer->readU16();
+    _hardpointMonitorStateTracker->set(_hardpointMonitorState->ilcState[ilc.DataIndex], buffer->readU16());
     // buffer->readU8();
     buffer->skipToNextFrame();
 }
@@ -709,7 +744,7 @@ void ILCResponseParser::_parseDualAxisPneumaticForceStatusResponse(ModbusBuffer*
 }
 
 void ILCResponseParser::_parseSetHPADCScanRateResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointActuatorInfo->adcScanRate[ilc.DataIndex] = buffer->readU8();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->adcScanRate[ilc.DataIndex], buffer->readU8());
     buffer->skipToNextFrame();
 }
 
@@ -738,25 +773,31 @@ void ILCResponseParser::_parseHMResetResponse(ModbusBuffer* buffer, const ILCMap
 void ILCResponseParser::_parseReadHPCalibrationResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
     buffer->readSGL();  // Main Coefficient K1
     buffer->readSGL();  // Main Coefficient K2
-    _hardpointActuatorInfo->mainLoadCellCoefficient[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->mainLoadCellCoefficient[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Main Coefficient K4
-    _hardpointActuatorInfo->mainLoadCellOffset[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->mainLoadCellOffset[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Main Offset Channel 2
     buffer->readSGL();  // Main Offset Channel 3
     buffer->readSGL();  // Main Offset Channel 4
-    _hardpointActuatorInfo->mainLoadCellSensitivity[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->mainLoadCellSensitivity[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Main Sensitivity Channel 2
     buffer->readSGL();  // Main Sensitivity Channel 3
     buffer->readSGL();  // Main Sensitivity Channel 4
     buffer->readSGL();  // Backup Coefficient K1
     buffer->readSGL();  // Backup Coefficient K2
-    _hardpointActuatorInfo->backupLoadCellCoefficient[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->backupLoadCellCoefficient[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Backup Coefficient K4
-    _hardpointActuatorInfo->backupLoadCellOffset[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->backupLoadCellOffset[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Backup Offset Channel 2
     buffer->readSGL();  // Backup Offset Channel 3
     buffer->readSGL();  // Backup Offset Channel 4
-    _hardpointActuatorInfo->backupLoadCellSensitivity[ilc.DataIndex] = buffer->readSGL();
+    _hardpointActuatorInfoTracker->set(_hardpointActuatorInfo->backupLoadCellSensitivity[ilc.DataIndex],
+                                       buffer->readSGL());
     buffer->readSGL();  // Backup Sensitivity Channel 2
     buffer->readSGL();  // Backup Sensitivity Channel 3
     buffer->readSGL();  // Backup Sensitivity Channel 4
@@ -781,10 +822,14 @@ void ILCResponseParser::_parseReadHMPressureValuesResponse(ModbusBuffer* buffer,
 }
 
 void ILCResponseParser::_parseReportHMMezzanineIDResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
-    _hardpointMonitorInfo->mezzanineUniqueId[ilc.DataIndex] = buffer->readU48();
-    _hardpointMonitorInfo->mezzanineFirmwareType[ilc.DataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->mezzanineMajorRevision[ilc.DataIndex] = buffer->readU8();
-    _hardpointMonitorInfo->mezzanineMinorRevision[ilc.DataIndex] = buffer->readU8();
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->mezzanineUniqueId[ilc.DataIndex],
+                                      buffer->readU48());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->mezzanineFirmwareType[ilc.DataIndex],
+                                      buffer->readU8());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->mezzanineMajorRevision[ilc.DataIndex],
+                                      buffer->readU8());
+    _hardpointMonitorInfoTracker->set(_hardpointMonitorInfo->mezzanineMinorRevision[ilc.DataIndex],
+                                      buffer->readU8());
     buffer->skipToNextFrame();
 }
 
@@ -795,22 +840,33 @@ void ILCResponseParser::_parseReportDCAStatusResponse(ModbusBuffer* buffer, cons
 
 void ILCResponseParser::_parseReportHMMezzanineStatusResponse(ModbusBuffer* buffer, const ILCMap& ilc) {
     uint16_t status = buffer->readU16();
-    _hardpointMonitorWarning->mezzanineS1AInterface1Fault[ilc.DataIndex] = (status & 0x0001) != 0;
-    _hardpointMonitorWarning->mezzanineS1ALVDT1Fault[ilc.DataIndex] = (status & 0x0002) != 0;
-    _hardpointMonitorWarning->mezzanineS1AInterface2Fault[ilc.DataIndex] = (status & 0x0004) != 0;
-    _hardpointMonitorWarning->mezzanineS1ALVDT2Fault[ilc.DataIndex] = (status & 0x0008) != 0;
-    _hardpointMonitorWarning->mezzanineUniqueIdCRCError[ilc.DataIndex] = (status & 0x0010) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineS1AInterface1Fault[ilc.DataIndex],
+                                         (status & 0x0001) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineS1ALVDT1Fault[ilc.DataIndex],
+                                         (status & 0x0002) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineS1AInterface2Fault[ilc.DataIndex],
+                                         (status & 0x0004) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineS1ALVDT2Fault[ilc.DataIndex],
+                                         (status & 0x0008) != 0);
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineUniqueIdCRCError[ilc.DataIndex],
+                                         (status & 0x0010) != 0);
     // 0x0020 is reserved
     // 0x0040 is reserved
     // 0x0080 is reserved
-    _hardpointMonitorWarning->mezzanineEventTrapReset[ilc.DataIndex] = (status & 0x0100) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineEventTrapReset[ilc.DataIndex],
+                                         (status & 0x0100) != 0);
     // 0x0200 is reserved
-    _hardpointMonitorWarning->mezzanineDCPRS422ChipFault[ilc.DataIndex] = (status & 0x0400) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineDCPRS422ChipFault[ilc.DataIndex],
+                                         (status & 0x0400) != 0);
     // 0x0800 is reserved
-    _hardpointMonitorWarning->mezzanineApplicationMissing[ilc.DataIndex] = (status & 0x1000) != 0;
-    _hardpointMonitorWarning->mezzanineApplicationCRCMismatch[ilc.DataIndex] = (status & 0x2000) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineApplicationMissing[ilc.DataIndex],
+                                         (status & 0x1000) != 0);
+    _hardpointMonitorWarningTracker->set(
+            _hardpointMonitorWarning->mezzanineApplicationCRCMismatch[ilc.DataIndex],
+            (status & 0x2000) != 0);
     // 0x4000 is reserved
-    _hardpointMonitorWarning->mezzanineBootloaderActive[ilc.DataIndex] = (status & 0x8000) != 0;
+    _hardpointMonitorWarningTracker->set(_hardpointMonitorWarning->mezzanineBootloaderActive[ilc.DataIndex],
+                                         (status & 0x8000) != 0);
     buffer->skipToNextFrame();
 }
 
@@ -26,6 +26,7 @@
 
 #include <SAL_MTM1M3C.h>
 
+#include <EventChangeTracker.h>
 #include <ForceActuatorSettings.h>
 #include <HardpointActuatorSettings.h>
 #include <ILCDataTypes.h>
@@ -118,6 +119,13 @@ private:
     MTM1M3_logevent_hardpointMonitorWarningC* _hardpointMonitorWarning;
     MTM1M3_hardpointMonitorDataC* _hardpointMonitorData;
 
+    EventChangeTracker* _hardpointActuatorInfoTracker;
+    EventChangeTracker* _hardpointActuatorStateTracker;
+    EventChangeTracker* _forceActuatorStateTracker;
+    EventChangeTracker* _hardpointMonitorInfoTracker;
+    EventChangeTracker* _hardpointMonitorStateTracker;
+    EventChangeTracker* _hardpointMonitorWarningTracker;
+
     MTM1M3_outerLoopDataC* _outerLoopData;
 };
 
@@ -21,8 +21,10 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
+#include <stdexcept>
+
 #include <ForceActuatorApplicationSettings.h>
-#include <ForceActuatorSettings.h>
 #include <HardpointActuatorApplicationSettings.h>
 #include <HardpointMonitorApplicationSettings.h>
 #include <ILCSubnetData.h>
@@ -36,127 +38,118 @@ ILCSubnetData::ILCSubnetData(HardpointActuatorApplicationSettings* hardpointActu
 
     auto& faa_settings = ForceActuatorApplicationSettings::instance();
 
-    for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
-        this->subnetData[subnetIndex].FACount = 0;
-        this->subnetData[subnetIndex].HPCount = 0;
-        this->subnetData[subnetIndex].HMCount = 0;
-    }
-    for (int i = 0; i < FA_COUNT; i++) {
-        ForceActuatorTableRow row = faa_settings.Table[i];
-        int32_t subnetIndex = row.Subnet - 1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Type = ILCTypes::FA;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Subnet = row.Subnet;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Address = row.Address;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].ActuatorId = row.ActuatorID;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].DataIndex = i;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].XDataIndex =
-                faa_settings.ZIndexToXIndex[i];
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].YDataIndex =
-                faa_settings.ZIndexToYIndex[i];
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].SecondaryDataIndex =
-                faa_settings.ZIndexToSecondaryCylinderIndex[i];
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Disabled = false;
-        ILCMap map = this->subnetData[subnetIndex].ILCDataFromAddress[row.Address];
-        this->subnetData[subnetIndex].FAIndex.push_back(map);
-        this->subnetData[subnetIndex].FACount += 1;
-    }
-    for (int i = 0; i < HP_COUNT; i++) {
-        HardpointActuatorTableRow row = hardpointActuatorApplicationSettings->Table[i];
-        int32_t subnetIndex = row.Subnet - 1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Type = ILCTypes::HP;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Subnet = row.Subnet;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Address = row.Address;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].ActuatorId = row.ActuatorID;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].DataIndex = row.Index;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].XDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].YDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].SecondaryDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Disabled = false;
-        ILCMap map = this->subnetData[subnetIndex].ILCDataFromAddress[row.Address];
-        this->subnetData[subnetIndex].HPIndex.push_back(map);
-        this->subnetData[subnetIndex].HPCount += 1;
-    }
-    for (int i = 0; i < HP_COUNT; i++) {
-        HardpointMonitorTableRow row = hardpointMonitorApplicationSettings->Table[i];
-        int32_t subnetIndex = row.Subnet - 1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Type = ILCTypes::HM;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Subnet = row.Subnet;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Address = row.Address;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].ActuatorId = row.ActuatorID;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].DataIndex = row.Index;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].XDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].YDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].SecondaryDataIndex = -1;
-        this->subnetData[subnetIndex].ILCDataFromAddress[row.Address].Disabled = false;
-        ILCMap map = this->subnetData[subnetIndex].ILCDataFromAddress[row.Address];
-        this->subnetData[subnetIndex].HMIndex.push_back(map);
-        this->subnetData[subnetIndex].HMCount += 1;
+    ILCMap& unknown = _ilcs[UNKNOWN_ILC];
+    unknown.Type = ILCTypes::Unknown;
+    unknown.Subnet = 255;
+    unknown.Address = 255;
+    unknown.ActuatorId = -1;
+    unknown.DataIndex = -1;
+    unknown.XDataIndex = -1;
+    unknown.YDataIndex = -1;
+    unknown.SecondaryDataIndex = -1;
+    unknown.Disabled = true;
+
+    _ilcCount = 0;
+    memset(_subnets, 0, sizeof(_subnets));
+    for (auto& subnet : _subnets) {
+        memset(subnet.ILCIndexFromAddress, UNKNOWN_ILC, sizeof(subnet.ILCIndexFromAddress));
     }
-}
+    memset(_indexFromActuatorId, UNKNOWN_ILC, sizeof(_indexFromActuatorId));
 
-ILCMap ILCSubnetData::getMap(int32_t actuatorId) {
-    for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
-        Container container = this->subnetData[subnetIndex];
-        for (int i = 0; i < container.HPCount; ++i) {
-            if (container.HPIndex[i].ActuatorId == actuatorId) {
-                return container.HPIndex[i];
+    // fill the table subnet by subnet, so ILCs on the same subnet are close in memory
+    for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
+        Subnet& subnet = _subnets[subnetIndex];
+        for (int i = 0; i < FA_COUNT; i++) {
+            ForceActuatorTableRow row = faa_settings.Table[i];
+            if (row.Subnet - 1 != subnetIndex) {
+                continue;
             }
+            subnet.FAIndex[subnet.FACount++] = _add(
+                    ILCTypes::FA, row.Subnet, row.Address, row.ActuatorID, i, faa_settings.ZIndexToXIndex[i],
+                    faa_settings.ZIndexToYIndex[i], faa_settings.ZIndexToSecondaryCylinderIndex[i]);
         }
-        for (int i = 0; i < container.FACount; ++i) {
-            if (container.FAIndex[i].ActuatorId == actuatorId) {
-                return container.FAIndex[i];
+        for (int i = 0; i < HP_COUNT; i++) {
+            HardpointActuatorTableRow row = hardpointActuatorApplicationSettings->Table[i];
+            if (row.Subnet - 1 != subnetIndex) {
+                continue;
             }
+            subnet.HPIndex[subnet.HPCount++] =
+                    _add(ILCTypes::HP, row.Subnet, row.Address, row.ActuatorID, row.Index, -1, -1, -1);
         }
-        for (int i = 0; i < container.HMCount; ++i) {
-            if (container.HMIndex[i].ActuatorId == actuatorId) {
-                return container.HMIndex[i];
+        for (int i = 0; i < HP_COUNT; i++) {
+            HardpointMonitorTableRow row = hardpointMonitorApplicationSettings->Table[i];
+            if (row.Subnet - 1 != subnetIndex) {
+                continue;
             }
+            subnet.HMIndex[subnet.HMCount++] =
+                    _add(ILCTypes::HM, row.Subnet, row.Address, row.ActuatorID, row.Index, -1, -1, -1);
         }
     }
-    ILCMap none;
-    none.Address = 255;
-    none.Subnet = 255;
-    return none;
 }
 
 void ILCSubnetData::disableFA(int32_t actuatorId) {
-    for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
-        Container* container = &subnetData[subnetIndex];
-        for (int i = 0; i < container->FACount; ++i) {
-            if (container->FAIndex[i].ActuatorId == actuatorId) {
-                container->FAIndex[i].Disabled = true;
-                SPDLOG_INFO("ILCSubnetData::disableFA({}, {}, {}) actuator disabled", actuatorId, subnetIndex,
-                            i);
-                return;
-            }
-        }
+    ILCMap* fa = _findFA(actuatorId);
+    if (fa == nullptr) {
+        SPDLOG_ERROR("ILCSubnetData::disableFA cannot find actuator with ID {}", actuatorId);
+        return;
     }
-    SPDLOG_ERROR("ILCSubnetData::enableFA cannot find actuator with ID {}", actuatorId);
+    fa->Disabled = true;
+    SPDLOG_INFO("ILCSubnetData::disableFA({}, {}, {}) actuator disabled", actuatorId, fa->Subnet - 1,
+                fa->Address);
 }
 
 void ILCSubnetData::enableFA(int32_t actuatorId) {
-    for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
-        Container* container = &subnetData[subnetIndex];
-        for (int i = 0; i < container->FACount; ++i) {
-            if (container->FAIndex[i].ActuatorId == actuatorId) {
-                if (container->FAIndex[i].Disabled == true) {
-                    container->FAIndex[i].Disabled = false;
-                    SPDLOG_INFO("ILCSubnetData::enableFA({}, {}, {}) actuator enabled", actuatorId,
-                                subnetIndex, i);
-                }
-                return;
-            }
-        }
+    ILCMap* fa = _findFA(actuatorId);
+    if (fa == nullptr) {
+        SPDLOG_ERROR("ILCSubnetData::enableFA cannot find actuator with ID {}", actuatorId);
+        return;
+    }
+    if (fa->Disabled == true) {
+        fa->Disabled = false;
+        SPDLOG_INFO("ILCSubnetData::enableFA({}, {}, {}) actuator enabled", actuatorId, fa->Subnet - 1,
+                    fa->Address);
     }
-    SPDLOG_ERROR("ILCSubnetData::enableFA cannot find actuator with ID {}", actuatorId);
 }
 
 void ILCSubnetData::enableAllFA() {
-    for (int subnetIndex = 0; subnetIndex < 5; ++subnetIndex) {
-        Container* container = &subnetData[subnetIndex];
-        for (int i = 0; i < container->FACount; ++i) {
-            container->FAIndex[i].Disabled = false;
+    for (int i = 0; i < _ilcCount; i++) {
+        if (_ilcs[i].Type == ILCTypes::FA) {
+            _ilcs[i].Disabled = false;
         }
     }
     SPDLOG_INFO("ILCSubnetData::enableAllFA()");
 }
+
+int ILCSubnetData::_add(ILCTypes::Type type, uint8_t subnet, uint8_t address, int32_t actuatorId,
+                        int32_t dataIndex, int32_t xDataIndex, int32_t yDataIndex,
+                        int32_t secondaryDataIndex) {
+    if (actuatorId < 0 || actuatorId >= ACTUATOR_ID_LIMIT) {
+        throw std::runtime_error(fmt::format("ILC actuator ID {} out of range 0-{}", actuatorId,
+                                             ACTUATOR_ID_LIMIT - 1));
+    }
+
+    int index = _ilcCount++;
+    ILCMap& ilc = _ilcs[index];
+    ilc.Type = type;
+    ilc.Subnet = subnet;
+    ilc.Address = address;
+    ilc.ActuatorId = actuatorId;
+    ilc.DataIndex = dataIndex;
+    ilc.XDataIndex = xDataIndex;
+    ilc.YDataIndex = yDataIndex;
+    ilc.SecondaryDataIndex = secondaryDataIndex;
+    ilc.Disabled = false;
+
+    _subnets[subnet - 1].ILCIndexFromAddress[address] = index;
+    _indexFromActuatorId[actuatorId] = index;
+
+    return index;
+}
+
+ILCMap* ILCSubnetData::_findFA(int32_t actuatorId) {
+    const ILCMap& ilc = getMap(actuatorId);
+    if (ilc.Type != ILCTypes::FA) {
+        return nullptr;
+    }
+    return &_ilcs[&ilc - _ilcs];
+}
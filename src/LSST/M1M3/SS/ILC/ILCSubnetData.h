@@ -34,36 +34,39 @@ class ForceActuatorSettings;
 class HardpointActuatorApplicationSettings;
 class HardpointMonitorApplicationSettings;
 
+/**
+ * Holds ILC metadata. All ILCs are stored in a single flat table, ordered by
+ * subnet, so ILCs on a subnet are stored in consecutive memory. Per subnet
+ * FA, HP and HM lists and address lookup contain only indices into the table.
+ * Lookups return references into the table, so Disabled flag is shared by
+ * all lookups.
+ */
 class ILCSubnetData {
-    struct Container {
-        int32_t HPCount;
-        std::vector<ILCMap> HPIndex;
-        int32_t FACount;
-        std::vector<ILCMap> FAIndex;
-        int32_t HMCount;
-        std::vector<ILCMap> HMIndex;
-        ILCMap ILCDataFromAddress[256];
-    };
-    Container subnetData[5];
-
 public:
     ILCSubnetData(HardpointActuatorApplicationSettings* hardpointActuatorApplicationSettings,
                   HardpointMonitorApplicationSettings* hardpointMonitorApplicationSettings);
 
-    int32_t getHPCount(int32_t subnetIndex) { return this->subnetData[subnetIndex].HPIndex.size(); }
-    ILCMap getHPIndex(int32_t subnetIndex, int32_t hpIndex) {
-        return this->subnetData[subnetIndex].HPIndex[hpIndex];
+    int32_t getHPCount(int32_t subnetIndex) const { return _subnets[subnetIndex].HPCount; }
+    const ILCMap& getHPIndex(int32_t subnetIndex, int32_t hpIndex) const {
+        return _ilcs[_subnets[subnetIndex].HPIndex[hpIndex]];
     }
-    int32_t getFACount(int32_t subnetIndex) { return this->subnetData[subnetIndex].FAIndex.size(); }
-    ILCMap getFAIndex(int32_t subnetIndex, int32_t faIndex) {
-        return this->subnetData[subnetIndex].FAIndex[faIndex];
+    int32_t getFACount(int32_t subnetIndex) const { return _subnets[subnetIndex].FACount; }
+    const ILCMap& getFAIndex(int32_t subnetIndex, int32_t faIndex) const {
+        return _ilcs[_subnets[subnetIndex].FAIndex[faIndex]];
     }
-    int32_t getHMCount(int32_t subnetIndex) { return this->subnetData[subnetIndex].HMIndex.size(); }
-    ILCMap getHMIndex(int32_t subnetIndex, int32_t hmIndex) {
-        return this->subnetData[subnetIndex].HMIndex[hmIndex];
+    int32_t getHMCount(int32_t subnetIndex) const { return _subnets[subnetIndex].HMCount; }
+    const ILCMap& getHMIndex(int32_t subnetIndex, int32_t hmIndex) const {
+        return _ilcs[_subnets[subnetIndex].HMIndex[hmIndex]];
     }
-    ILCMap getILCDataFromAddress(int32_t subnetIndex, uint8_t address) {
-        return this->subnetData[subnetIndex].ILCDataFromAddress[address];
+
+    /**
+     * Returns ILC with the address on the subnet.
+     *
+     * @return ILCMap with Unknown type when no ILC is configured on the
+     * address
+     */
+    const ILCMap& getILCDataFromAddress(int32_t subnetIndex, uint8_t address) const {
+        return _ilcs[_subnets[subnetIndex].ILCIndexFromAddress[address]];
     }
 
     /**
@@ -74,11 +77,44 @@ public:
      * @return ILCMap object with Address and Subnet set to 255 when actuator
      * isn't found.
      */
-    ILCMap getMap(int32_t actuatorId);
+    const ILCMap& getMap(int32_t actuatorId) const {
+        if (actuatorId < 0 || actuatorId >= ACTUATOR_ID_LIMIT) {
+            return _ilcs[UNKNOWN_ILC];
+        }
+        return _ilcs[_indexFromActuatorId[actuatorId]];
+    }
 
     void disableFA(int32_t actuatorId);
     void enableFA(int32_t actuatorId);
     void enableAllFA();
+
+private:
+    static constexpr int ILC_COUNT = FA_COUNT + HP_COUNT + HP_COUNT;
+    // index of entry returned for unknown ILCs
+    static constexpr int UNKNOWN_ILC = ILC_COUNT;
+    static constexpr int ACTUATOR_ID_LIMIT = 512;
+
+    static_assert(UNKNOWN_ILC < 256, "ILC indices shall fit into uint8_t");
+
+    struct Subnet {
+        int32_t HPCount;
+        int32_t FACount;
+        int32_t HMCount;
+        uint8_t HPIndex[HP_COUNT];
+        uint8_t FAIndex[FA_COUNT];
+        uint8_t HMIndex[HP_COUNT];
+        uint8_t ILCIndexFromAddress[256];
+    };
+
+    int _add(ILCTypes::Type type, uint8_t subnet, uint8_t address, int32_t actuatorId, int32_t dataIndex,
+             int32_t xDataIndex, int32_t yDataIndex, int32_t secondaryDataIndex);
+
+    ILCMap* _findFA(int32_t actuatorId);
+
+    ILCMap _ilcs[ILC_COUNT + 1];
+    int _ilcCount;
+    Subnet _subnets[5];
+    uint8_t _indexFromActuatorId[ACTUATOR_ID_LIMIT];
 };
 
 } /* namespace SS */
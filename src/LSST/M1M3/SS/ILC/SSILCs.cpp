@@ -38,7 +38,6 @@
 #include "ForceActuatorInfo.h"
 #include "ForceActuatorSettings.h"
 #include "HardpointActuatorApplicationSettings.h"
-#include "HardpointActuatorSettings.h"
 #include "IFPGA.h"
 #include "ILCApplicationSettings.h"
 #include "M1M3SSPublisher.h"
@@ -83,7 +82,6 @@ SSILCs::SSILCs(PositionController* positionController,
           _busListActive(&_subnetData, &_ilcMessageFactory) {
     SPDLOG_DEBUG("SSILCs: SSILCs()");
     _safetyController = safetyController;
-    _hardpointActuatorSettings = &HardpointActuatorSettings::instance();
     _hardpointActuatorData = M1M3SSPublisher::instance().getHardpointActuatorData();
     _hardpointActuatorInfo = M1M3SSPublisher::instance().getEventHardpointActuatorInfo();
     _controlListToggle = 0;
@@ -216,7 +214,8 @@ void SSILCs::writeControlListBuffer() {
     } else {
         writeActiveListBuffer();
     }
-    _controlListToggle = RoundRobin::Inc(_controlListToggle, 3);
+    _controlListToggle =
+            RoundRobin::Inc(_controlListToggle, ILCApplicationSettings::instance().HardpointStepMotorRate);
 }
 
 void SSILCs::triggerModbus() {
@@ -286,68 +285,15 @@ void SSILCs::flushAll() {
 }
 
 void SSILCs::calculateHPPostion() {
-    double displacement[] = {
-            ((_hardpointActuatorData->encoder[0] - _hardpointActuatorInfo->referencePosition[0]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-            ((_hardpointActuatorData->encoder[1] - _hardpointActuatorInfo->referencePosition[1]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-            ((_hardpointActuatorData->encoder[2] - _hardpointActuatorInfo->referencePosition[2]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-            ((_hardpointActuatorData->encoder[3] - _hardpointActuatorInfo->referencePosition[3]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-            ((_hardpointActuatorData->encoder[4] - _hardpointActuatorInfo->referencePosition[4]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-            ((_hardpointActuatorData->encoder[5] - _hardpointActuatorInfo->referencePosition[5]) *
-             _hardpointActuatorSettings->micrometersPerEncoder) /
-                    (MICROMETERS_PER_MILLIMETER * MILLIMETERS_PER_METER),
-    };
-    _hardpointActuatorData->xPosition =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[0] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[1] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[2] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[3] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[4] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[5] * displacement[1];
-    _hardpointActuatorData->yPosition =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[6] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[7] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[8] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[9] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[10] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[11] * displacement[1];
-    _hardpointActuatorData->zPosition =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[12] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[13] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[14] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[15] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[16] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[17] * displacement[1];
-    _hardpointActuatorData->xRotation =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[18] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[19] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[20] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[21] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[22] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[23] * displacement[1];
-    _hardpointActuatorData->yRotation =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[24] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[25] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[26] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[27] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[28] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[29] * displacement[1];
-    _hardpointActuatorData->zRotation =
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[30] * displacement[2] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[31] * displacement[3] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[32] * displacement[4] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[33] * displacement[5] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[34] * displacement[0] +
-            _hardpointActuatorSettings->HardpointDisplacementToMirrorPosition[35] * displacement[1];
+    double position[6];
+    _positionController->getKinematics().encoderToPosition(
+            &_hardpointActuatorData->encoder[0], &_hardpointActuatorInfo->referencePosition[0], position);
+    _hardpointActuatorData->xPosition = position[0];
+    _hardpointActuatorData->yPosition = position[1];
+    _hardpointActuatorData->zPosition = position[2];
+    _hardpointActuatorData->xRotation = position[3];
+    _hardpointActuatorData->yRotation = position[4];
+    _hardpointActuatorData->zRotation = position[5];
 }
 
 void SSILCs::calculateHPMirrorForces() {
@@ -31,7 +31,6 @@
 #include <ForceActuatorSettings.h>
 #include <FreezeSensorBusList.h>
 #include <HardpointActuatorApplicationSettings.h>
-#include <HardpointActuatorSettings.h>
 #include <HardpointMonitorApplicationSettings.h>
 #include <ILCDataTypes.h>
 #include <ILCMessageFactory.h>
@@ -104,8 +103,9 @@ public:
     void writeActiveListBuffer();
 
     /**
-     * Called in enabled state. Calls once writeRaisedListBuffer and twice (to
-     * get more data) writeActiveListBuffer.
+     * Called in enabled state. Calls once writeRaisedListBuffer and
+     * HardpointStepMotor rate - 1 times (to get more data)
+     * writeActiveListBuffer.
      */
     void writeControlListBuffer();
 
@@ -202,7 +202,6 @@ private:
     RaisedBusList _busListRaised;
     ActiveBusList _busListActive;
 
-    HardpointActuatorSettings* _hardpointActuatorSettings;
     MTM1M3_hardpointActuatorDataC* _hardpointActuatorData;
     MTM1M3_logevent_hardpointActuatorInfoC* _hardpointActuatorInfo;
     PositionController* _positionController;
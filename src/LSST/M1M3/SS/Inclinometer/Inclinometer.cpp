@@ -36,6 +36,34 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+namespace {
+
+typedef MTM1M3_logevent_inclinometerSensorWarningC W;
+typedef Inclinometer::InclinometerWarningTable InclinometerWarningTable;
+
+const InclinometerWarningTable::Entry errorEntries[] = {
+        {&W::unknownAddress, 0, InclinometerWarningTable::codeWord(1), false,
+         &SafetyController::inclinometerNotifyUnknownAddress},
+        {&W::unknownFunction, 0, InclinometerWarningTable::codeWord(2), false,
+         &SafetyController::inclinometerNotifyUnknownFunction},
+        {&W::invalidLength, 0, InclinometerWarningTable::codeWord(3), false,
+         &SafetyController::inclinometerNotifyInvalidLength},
+        {&W::invalidCRC, 0, InclinometerWarningTable::codeWord(4), false,
+         &SafetyController::inclinometerNotifyInvalidCRC},
+        {&W::unknownProblem, 0, InclinometerWarningTable::codeWord(5), false,
+         &SafetyController::inclinometerNotifyUnknownProblem},
+        {&W::responseTimeout, 0, InclinometerWarningTable::codeWord(6), false,
+         &SafetyController::inclinometerNotifyResponseTimeout},
+        {&W::sensorReportsIllegalFunction, 0, InclinometerWarningTable::codeWord(7), false,
+         &SafetyController::inclinometerNotifySensorReportsIllegalFunction},
+        {&W::sensorReportsIllegalDataAddress, 0, InclinometerWarningTable::codeWord(8), false,
+         &SafetyController::inclinometerNotifySensorReportsIllegalDataAddress},
+};
+
+}  // namespace
+
+const Inclinometer::InclinometerWarningTable Inclinometer::ERROR_TABLE(errorEntries);
+
 Inclinometer::Inclinometer(SupportFPGAData* fpgaData, SafetyController* safetyController) {
     SPDLOG_DEBUG("Inclinometer: Inclinometer()");
 
@@ -45,6 +73,7 @@ Inclinometer::Inclinometer(SupportFPGAData* fpgaData, SafetyController* safetyCo
 
     _inclinometerData = M1M3SSPublisher::instance().getInclinometerData();
     _inclinometerWarning = M1M3SSPublisher::instance().getEventInclinometerSensorWarning();
+    _inclinometerWarningTracker = M1M3SSPublisher::instance().getEventInclinometerSensorWarningTracker();
 
     _lastSampleTimestamp = 0;
     _lastErrorTimestamp = 0;
@@ -52,6 +81,7 @@ Inclinometer::Inclinometer(SupportFPGAData* fpgaData, SafetyController* safetyCo
 
     memset(_inclinometerData, 0, sizeof(MTM1M3_inclinometerDataC));
     memset(_inclinometerWarning, 0, sizeof(MTM1M3_logevent_inclinometerSensorWarningC));
+    _inclinometerWarningTracker->mark();
 }
 
 void Inclinometer::processData() {
@@ -62,25 +92,10 @@ void Inclinometer::processData() {
         _lastErrorTimestamp = _fpgaData->InclinometerErrorTimestamp;
         _errorCleared = false;
         _inclinometerWarning->timestamp = Timestamp::fromFPGA(_fpgaData->InclinometerErrorTimestamp);
-        _inclinometerWarning->unknownAddress = _fpgaData->InclinometerErrorCode == 1;
-        _inclinometerWarning->unknownFunction = _fpgaData->InclinometerErrorCode == 2;
-        _inclinometerWarning->invalidLength = _fpgaData->InclinometerErrorCode == 3;
-        _inclinometerWarning->invalidCRC = _fpgaData->InclinometerErrorCode == 4;
-        _inclinometerWarning->unknownProblem = _fpgaData->InclinometerErrorCode == 5;
-        _inclinometerWarning->responseTimeout = _fpgaData->InclinometerErrorCode == 6;
-        _inclinometerWarning->sensorReportsIllegalFunction = _fpgaData->InclinometerErrorCode == 7;
-        _inclinometerWarning->sensorReportsIllegalDataAddress = _fpgaData->InclinometerErrorCode == 8;
+        uint32_t errorWord = InclinometerWarningTable::codeWord(_fpgaData->InclinometerErrorCode);
+        ERROR_TABLE.decode(&errorWord, _inclinometerWarning, _inclinometerWarningTracker, _safetyController);
+        _inclinometerWarningTracker->mark();
         M1M3SSPublisher::instance().tryLogInclinometerSensorWarning();
-        _safetyController->inclinometerNotifyUnknownAddress(_inclinometerWarning->unknownAddress);
-        _safetyController->inclinometerNotifyUnknownFunction(_inclinometerWarning->unknownFunction);
-        _safetyController->inclinometerNotifyInvalidLength(_inclinometerWarning->invalidLength);
-        _safetyController->inclinometerNotifyInvalidCRC(_inclinometerWarning->invalidCRC);
-        _safetyController->inclinometerNotifyUnknownProblem(_inclinometerWarning->unknownProblem);
-        _safetyController->inclinometerNotifyResponseTimeout(_inclinometerWarning->responseTimeout);
-        _safetyController->inclinometerNotifySensorReportsIllegalFunction(
-                _inclinometerWarning->sensorReportsIllegalFunction);
-        _safetyController->inclinometerNotifySensorReportsIllegalDataAddress(
-                _inclinometerWarning->sensorReportsIllegalDataAddress);
     }
     if (_fpgaData->InclinometerSampleTimestamp > _lastSampleTimestamp) {
         _lastSampleTimestamp = _fpgaData->InclinometerSampleTimestamp;
@@ -97,25 +112,9 @@ void Inclinometer::processData() {
             _fpgaData->InclinometerSampleTimestamp > _fpgaData->InclinometerErrorTimestamp) {
             _errorCleared = true;
             _inclinometerWarning->timestamp = Timestamp::fromFPGA(_fpgaData->InclinometerSampleTimestamp);
-            _inclinometerWarning->unknownAddress = false;
-            _inclinometerWarning->unknownFunction = false;
-            _inclinometerWarning->invalidLength = false;
-            _inclinometerWarning->invalidCRC = false;
-            _inclinometerWarning->unknownProblem = false;
-            _inclinometerWarning->responseTimeout = false;
-            _inclinometerWarning->sensorReportsIllegalFunction = false;
-            _inclinometerWarning->sensorReportsIllegalDataAddress = false;
+            ERROR_TABLE.clear(_inclinometerWarning, _inclinometerWarningTracker, _safetyController);
+            _inclinometerWarningTracker->mark();
             M1M3SSPublisher::instance().tryLogInclinometerSensorWarning();
-            _safetyController->inclinometerNotifyUnknownAddress(_inclinometerWarning->unknownAddress);
-            _safetyController->inclinometerNotifyUnknownFunction(_inclinometerWarning->unknownFunction);
-            _safetyController->inclinometerNotifyInvalidLength(_inclinometerWarning->invalidLength);
-            _safetyController->inclinometerNotifyInvalidCRC(_inclinometerWarning->invalidCRC);
-            _safetyController->inclinometerNotifyUnknownProblem(_inclinometerWarning->unknownProblem);
-            _safetyController->inclinometerNotifyResponseTimeout(_inclinometerWarning->responseTimeout);
-            _safetyController->inclinometerNotifySensorReportsIllegalFunction(
-                    _inclinometerWarning->sensorReportsIllegalFunction);
-            _safetyController->inclinometerNotifySensorReportsIllegalDataAddress(
-                    _inclinometerWarning->sensorReportsIllegalDataAddress);
         }
     }
 }
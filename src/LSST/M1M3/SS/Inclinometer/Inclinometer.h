@@ -24,9 +24,11 @@
 #ifndef INCLINOMETER_H_
 #define INCLINOMETER_H_
 
+#include <EventChangeTracker.h>
 #include <InclinometerSettings.h>
 #include <SafetyController.h>
 #include <SupportFPGAData.h>
+#include <WarningTable.h>
 #include <cRIO/DataTypes.h>
 
 struct MTM1M3_inclinometerDataC;
@@ -53,6 +55,12 @@ public:
      */
     void processData();
 
+    typedef WarningTable<MTM1M3_logevent_inclinometerSensorWarningC, SafetyController>
+            InclinometerWarningTable;
+
+    //* decodes error code, raises SafetyController faults
+    static const InclinometerWarningTable ERROR_TABLE;
+
 private:
     SupportFPGAData* _fpgaData;
     SafetyController* _safetyController;
@@ -60,6 +68,7 @@ private:
 
     MTM1M3_inclinometerDataC* _inclinometerData;
     MTM1M3_logevent_inclinometerSensorWarningC* _inclinometerWarning;
+    EventChangeTracker* _inclinometerWarningTracker;
 
     uint64_t _lastSampleTimestamp;
     uint64_t _lastErrorTimestamp;
@@ -34,7 +34,7 @@ namespace SS {
  * Parameters for PID calculations. Used in PID.
  */
 struct PIDParameters {
-    PIDParameters() { Timestep = P = I = D = N = NAN; }
+    PIDParameters() { Timestep = P = I = D = N = OutputLimit = NAN; }
 
     PIDParameters(const PIDParameters& pid) {
         Timestep = pid.Timestep;
@@ -42,14 +42,17 @@ struct PIDParameters {
         I = pid.I;
         D = pid.D;
         N = pid.N;
+        OutputLimit = pid.OutputLimit;
     }
 
-    PIDParameters(double _timestep, double _p, double _i, double _d, double _n) {
+    PIDParameters(double _timestep, double _p, double _i, double _d, double _n,
+                  double _outputLimit = NAN) {
         Timestep = _timestep;
         P = _p;
         I = _i;
         D = _d;
         N = _n;
+        OutputLimit = _outputLimit;
     }
 
     //* Length of step (seconds)
@@ -66,6 +69,13 @@ struct PIDParameters {
      * for details. Setting this to 0 will cancle Kd (derivative term).
      */
     double N;
+    /**
+     * Anti-windup output limit. Control output is clamped into ±OutputLimit,
+     * and the control history is shifted by the clipped value, so the integral
+     * term doesn't wind up while the output is saturated. 0 disables the
+     * limit, NAN keeps the currently used limit.
+     */
+    double OutputLimit;
 };
 
 }  // namespace SS
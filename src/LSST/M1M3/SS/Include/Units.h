@@ -34,6 +34,8 @@ const static double D2RAD = M_PI / 180.0;
 const static double RAD2D = 180.0 / M_PI;
 const static double M2MM = 1000.0;
 const static double MM2M = 1.0 / 1000.0;
+const static double M2UM = 1000000.0;
+const static double UM2M = 1.0 / 1000000.0;
 
 }  // namespace SS
 }  // namespace M1M3
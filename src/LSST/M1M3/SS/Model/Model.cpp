@@ -43,6 +43,8 @@
 #include <MirrorLowerController.h>
 #include <MirrorRaiseController.h>
 #include <Model.h>
+#include <OuterLoopPipeline.h>
+#include <OuterLoopSettings.h>
 #include <PositionController.h>
 #include <PowerController.h>
 #include <SSILCs.h>
@@ -103,6 +105,9 @@ void Model::loadSettings(const char* settingsToApply) {
 
     _settingReader.load();
 
+    OuterLoopPipeline::instance().setTimingReport(
+            std::chrono::seconds(OuterLoopSettings::instance().StageTimingReportInterval));
+
     HardpointActuatorApplicationSettings* hardpointActuatorApplicationSettings =
             _settingReader.getHardpointActuatorApplicationSettings();
     HardpointMonitorApplicationSettings* hardpointMonitorApplicationSettings =
@@ -189,7 +194,8 @@ void Model::publishStateChange(States::Type newState) {
     uint64_t state = (uint64_t)newState;
     double timestamp = M1M3SSPublisher::instance().getTimestamp();
     MTM1M3_logevent_summaryStateC* summaryStateData = M1M3SSPublisher::instance().getEventSummaryState();
-    summaryStateData->summaryState = (int32_t)((state & 0xFFFFFFFF00000000) >> 32);
+    M1M3SSPublisher::instance().getEventSummaryStateTracker()->set(
+            summaryStateData->summaryState, (int32_t)((state & 0xFFFFFFFF00000000) >> 32));
     M1M3SSPublisher::instance().logSummaryState();
     auto& detailed_state = DetailedState::instance();
     detailed_state.timestamp = timestamp;
@@ -241,6 +247,7 @@ void Model::_populateHardpointActuatorInfo(
         hardpointInfo->zPosition[row.Index] = row.ZPosition;
         hardpointInfo->referencePosition[i] = positionControllerSettings->referencePosition[i];
     }
+    M1M3SSPublisher::instance().getEventHardpointActuatorInfoTracker()->mark();
 }
 
 void Model::_populateHardpointMonitorInfo(
@@ -254,4 +261,5 @@ void Model::_populateHardpointMonitorInfo(
         hardpointMonitorInfo->modbusSubnet[row.Index] = row.Subnet;
         hardpointMonitorInfo->modbusAddress[row.Index] = row.Address;
     }
+    M1M3SSPublisher::instance().getEventHardpointMonitorInfoTracker()->mark();
 }
@@ -0,0 +1,142 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <cstring>
+
+#include <PIDBank.h>
+
+using namespace LSST::M1M3::SS;
+
+constexpr double THAW_STEP = 50;
+
+PIDBank::PIDBank() : _frozen(false) {
+    memset(_a, 0, sizeof(_a));
+    memset(_b, 0, sizeof(_b));
+    memset(_c, 0, sizeof(_c));
+    memset(_d, 0, sizeof(_d));
+    memset(_e, 0, sizeof(_e));
+    memset(_outputLimit, 0, sizeof(_outputLimit));
+    memset(_setpoint, 0, sizeof(_setpoint));
+    memset(_measurement, 0, sizeof(_measurement));
+    memset(_offset, 0, sizeof(_offset));
+    for (int id = 0; id < PID_COUNT; id++) {
+        resetPreviousValues(id);
+    }
+}
+
+void PIDBank::configure(int id, PIDParameters parameters) {
+    _outputLimit[id] = 0;
+    updateParameters(id, parameters);
+    _initialParameters[id] = _parameters[id];
+}
+
+void PIDBank::updateParameters(int id, PIDParameters parameters) {
+    if (std::isnan(parameters.OutputLimit)) {
+        parameters.OutputLimit = _outputLimit[id];
+    }
+    _parameters[id] = parameters;
+    _outputLimit[id] = parameters.OutputLimit;
+    _calculateIntermediateValues(id);
+}
+
+void PIDBank::restoreInitialParameters(int id) { updateParameters(id, _initialParameters[id]); }
+
+void PIDBank::resetPreviousValues(int id) {
+    _errorT2[id] = 0.0;
+    _errorT1[id] = 0.0;
+    _error[id] = 0.0;
+    _controlT2[id] = 0.0;
+    _controlT1[id] = 0.0;
+    _control[id] = 0.0;
+}
+
+void PIDBank::process(const double* setpoints, const double* measurements, double* outputs) {
+    for (int id = 0; id < PID_COUNT; id++) {
+        _setpoint[id] = setpoints[id];
+        _measurement[id] = measurements[id];
+        _errorT2[id] = _errorT1[id];
+        _errorT1[id] = _error[id];
+        _error[id] = _setpoint[id] - _measurement[id];
+        _controlT2[id] = _controlT1[id];
+        _controlT1[id] = _control[id];
+        double u = _d[id] * _controlT1[id] + _e[id] * _controlT2[id] + _a[id] * _error[id] +
+                   _b[id] * _errorT1[id] + _c[id] * _errorT2[id];
+        // anti-windup - shift control history by the clipped excess. As D + E
+        // = 1, the recursion continues from the limit, and the integral part
+        // doesn't accumulate past it
+        if (_outputLimit[id] > 0 && std::fabs(u) > _outputLimit[id]) {
+            double clipped = u > 0 ? _outputLimit[id] : -_outputLimit[id];
+            _controlT1[id] += clipped - u;
+            u = clipped;
+        }
+        _control[id] = u;
+    }
+
+    for (int id = 0; id < PID_COUNT; id++) {
+        _thawStep(id);
+        outputs[id] = _control[id] + _offset[id];
+    }
+}
+
+void PIDBank::freeze() {
+    for (int id = 0; id < PID_COUNT; id++) {
+        _offset[id] = _control[id];
+    }
+    _frozen = true;
+}
+
+bool PIDBank::getOffsets(double* offsets) {
+    bool changed = false;
+    for (int id = 0; id < PID_COUNT; id++) {
+        changed |= _thawStep(id);
+        offsets[id] = _offset[id];
+    }
+    return changed;
+}
+
+bool PIDBank::_thawStep(int id) {
+    if (_frozen || _offset[id] == 0) {
+        return false;
+    }
+    if (std::fabs(_offset[id]) < (THAW_STEP + 1)) {
+        _offset[id] = 0;
+    } else {
+        _offset[id] -= _offset[id] > 0 ? THAW_STEP : -THAW_STEP;
+    }
+    return true;
+}
+
+void PIDBank::_calculateIntermediateValues(int id) {
+    double Kp = _parameters[id].P;
+    double Ki = _parameters[id].I;
+    double Kd = _parameters[id].D;
+    double N = _parameters[id].N;
+    double Ts = _parameters[id].Timestep;
+    _a[id] = Kp + Kd * N;
+    _b[id] = -2.0 * Kp + Kp * N * Ts + Ki * Ts - 2.0 * Kd * N;
+    _c[id] = Kp - Kp * N * Ts - Ki * Ts + Ki * N * Ts * Ts + Kd * N;
+    _d[id] = 2.0 - N * Ts;
+    _e[id] = N * Ts - 1.0;
+    resetPreviousValues(id);
+}
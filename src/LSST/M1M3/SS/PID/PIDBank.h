@@ -0,0 +1,182 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PIDBANK_H_
+#define PIDBANK_H_
+
+#include <atomic>
+
+#include <PIDParameters.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Bank of six PID discrete time controllers, one for each of fx, fy, fz, mx,
+ * my and mz. Used for filtering forces measured from hardpoints for balance
+ * force component corrections to force actuators. All controllers are
+ * evaluated in a single pass.
+ *
+ * Controllers state is kept in the bank. It's copied into SAL/DDS pidData and
+ * pidInfo structures only when those are published, with copyData and
+ * copyInfo methods.
+ *
+ * See PID discussion at
+ * [Confluence](https://confluence.lsstcorp.org/pages/viewpage.action?pageId=34209829)
+ * for details. The [PID Implementation in
+ * Software](https://confluence.lsstcorp.org/pages/viewpage.action?pageId=34209829&preview=/34209829/135102468/PID%20Implementation%20in%20Software%20v_2.pdf)
+ * has details about the calculations.
+ *
+ * @see LSST::M1M3::SS::BalanceForceComponent
+ */
+class PIDBank {
+public:
+    static constexpr int PID_COUNT = 6;
+
+    PIDBank();
+
+    /**
+     * Sets initial (restored with restoreInitialParameters) and current PID
+     * parameters.
+     *
+     * @param id PID index (0-5 for fx, fy, fz, mx, my, mz)
+     * @param parameters PID parameters
+     */
+    void configure(int id, PIDParameters parameters);
+
+    /**
+     * Update PID parameters. Resets controller history. Doesn't allocate, so
+     * it can be used to switch gains during slews.
+     *
+     * @param id PID index
+     * @param parameters new parameters. Output limit is kept if
+     * parameters.OutputLimit is NAN
+     */
+    void updateParameters(int id, PIDParameters parameters);
+    void restoreInitialParameters(int id);
+    void resetPreviousValues(int id);
+
+    /**
+     * Run PID calculations for all controllers.
+     *
+     * @param setpoints PID_COUNT setpoints
+     * @param measurements PID_COUNT measured values
+     * @param outputs PID_COUNT calculated outputs, including freeze offsets
+     */
+    void process(const double* setpoints, const double* measurements, double* outputs);
+
+    /**
+     * Keep constant PID outputs. Used during slews.
+     */
+    void freeze();
+
+    /**
+     * Remove freeze flag. Frozen outputs are then walked to 0.
+     */
+    void thaw() { _frozen = false; }
+
+    /**
+     * Returns offsets stored by freeze, walking them to 0 when not frozen.
+     *
+     * @param offsets PID_COUNT offsets
+     *
+     * @return true if any offset was changed
+     */
+    bool getOffsets(double* offsets);
+
+    const PIDParameters& getParameters(int id) const { return _parameters[id]; }
+
+    /**
+     * Copies controllers state into pidData structure.
+     *
+     * @tparam T MTM1M3_pidDataC or compatible structure
+     */
+    template <typename T>
+    void copyData(T* data) const {
+        for (int id = 0; id < PID_COUNT; id++) {
+            data->setpoint[id] = _setpoint[id];
+            data->measuredPID[id] = _measurement[id];
+            data->error[id] = _error[id];
+            data->errorT1[id] = _errorT1[id];
+            data->errorT2[id] = _errorT2[id];
+            data->control[id] = _control[id];
+            data->controlT1[id] = _controlT1[id];
+            data->controlT2[id] = _controlT2[id];
+        }
+    }
+
+    /**
+     * Copies controllers parameters and calculated coefficients into pidInfo
+     * structure.
+     *
+     * @tparam T MTM1M3_logevent_pidInfoC or compatible structure
+     */
+    template <typename T>
+    void copyInfo(T* info) const {
+        for (int id = 0; id < PID_COUNT; id++) {
+            info->timestep[id] = _parameters[id].Timestep;
+            info->p[id] = _parameters[id].P;
+            info->i[id] = _parameters[id].I;
+            info->d[id] = _parameters[id].D;
+            info->n[id] = _parameters[id].N;
+            info->calculatedA[id] = _a[id];
+            info->calculatedB[id] = _b[id];
+            info->calculatedC[id] = _c[id];
+            info->calculatedD[id] = _d[id];
+            info->calculatedE[id] = _e[id];
+        }
+    }
+
+private:
+    void _calculateIntermediateValues(int id);
+    bool _thawStep(int id);
+
+    PIDParameters _initialParameters[PID_COUNT];
+    PIDParameters _parameters[PID_COUNT];
+
+    double _a[PID_COUNT];
+    double _b[PID_COUNT];
+    double _c[PID_COUNT];
+    double _d[PID_COUNT];
+    double _e[PID_COUNT];
+    double _outputLimit[PID_COUNT];
+
+    double _setpoint[PID_COUNT];
+    double _measurement[PID_COUNT];
+    double _error[PID_COUNT];
+    double _errorT1[PID_COUNT];
+    double _errorT2[PID_COUNT];
+    double _control[PID_COUNT];
+    double _controlT1[PID_COUNT];
+    double _controlT2[PID_COUNT];
+
+    std::atomic_bool _frozen;
+    double _offset[PID_COUNT];
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* PIDBANK_H_ */
@@ -0,0 +1,95 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSST_EVENTCHANGETRACKER_H
+#define LSST_EVENTCHANGETRACKER_H
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Tracks modifications of event fields. Code modifying fields used for
+ * change detection in M1M3SSPublisher::tryLog* methods updates them through
+ * set (or calls mark after direct modification), which flags the event as
+ * changed only if the new value differs. tryLog* methods return immediately
+ * if the event wasn't changed since the last check, and run the field by
+ * field comparison against the last published event only when it was.
+ *
+ * The tracker starts as changed, so the first tryLog* call always performs
+ * the comparison.
+ */
+class EventChangeTracker {
+public:
+    EventChangeTracker() : _changed(true) {}
+
+    /**
+     * Sets event field, marks event changed if the value differs.
+     *
+     * @param field event field
+     * @param value new value
+     *
+     * @return true if the field was modified
+     */
+    template <typename F, typename V>
+    bool set(F& field, const V& value) {
+        F new_value = static_cast<F>(value);
+        if (field != new_value) {
+            field = new_value;
+            _changed = true;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Marks event as changed. Shall be called after event fields were
+     * modified without set.
+     */
+    void mark() { _changed = true; }
+
+    /**
+     * Returns true if event was marked as changed since the last check.
+     */
+    bool changed() const { return _changed; }
+
+    /**
+     * Returns change flag and clears it.
+     *
+     * @return true if the event was marked changed since the last check
+     */
+    bool check() {
+        bool ret = _changed;
+        _changed = false;
+        return ret;
+    }
+
+private:
+    bool _changed;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // LSST_EVENTCHANGETRACKER_H
@@ -158,10 +158,15 @@ void M1M3SSPublisher::logAccelerometerWarning() {
     _previousEventAccelerometerWarning = _eventAccelerometerWarning;
 }
 
-void M1M3SSPublisher::tryLogAccelerometerWarning() {
+bool M1M3SSPublisher::tryLogAccelerometerWarning() {
+    if (_eventAccelerometerWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventAccelerometerWarning.responseTimeout != _previousEventAccelerometerWarning.responseTimeout) {
         logAccelerometerWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logAirSupplyWarning() {
@@ -171,13 +176,18 @@ void M1M3SSPublisher::logAirSupplyWarning() {
     _previousEventAirSupplyWarning = _eventAirSupplyWarning;
 }
 
-void M1M3SSPublisher::tryLogAirSupplyWarning() {
+bool M1M3SSPublisher::tryLogAirSupplyWarning() {
+    if (_eventAirSupplyWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventAirSupplyWarning.commandOutputMismatch !=
                 _previousEventAirSupplyWarning.commandOutputMismatch ||
         _eventAirSupplyWarning.commandSensorMismatch !=
                 _previousEventAirSupplyWarning.commandSensorMismatch) {
         logAirSupplyWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logAppliedAccelerationForces() {
@@ -273,12 +283,17 @@ void M1M3SSPublisher::logCellLightStatus() {
     _previousEventCellLightStatus = _eventCellLightStatus;
 }
 
-void M1M3SSPublisher::tryLogCellLightStatus() {
+bool M1M3SSPublisher::tryLogCellLightStatus() {
+    if (_eventCellLightStatusTracker.check() == false) {
+        return false;
+    }
     if (_eventCellLightStatus.cellLightsCommandedOn != _previousEventCellLightStatus.cellLightsCommandedOn ||
         _eventCellLightStatus.cellLightsOutputOn != _previousEventCellLightStatus.cellLightsOutputOn ||
         _eventCellLightStatus.cellLightsOn != _previousEventCellLightStatus.cellLightsOn) {
         logCellLightStatus();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logCellLightWarning() {
@@ -288,13 +303,18 @@ void M1M3SSPublisher::logCellLightWarning() {
     _previousEventCellLightWarning = _eventCellLightWarning;
 }
 
-void M1M3SSPublisher::tryLogCellLightWarning() {
+bool M1M3SSPublisher::tryLogCellLightWarning() {
+    if (_eventCellLightWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventCellLightWarning.cellLightsOutputMismatch !=
                 _previousEventCellLightWarning.cellLightsOutputMismatch ||
         _eventCellLightWarning.cellLightsSensorMismatch !=
                 _previousEventCellLightWarning.cellLightsSensorMismatch) {
         logCellLightWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logCommandRejectionWarning() {
@@ -328,7 +348,10 @@ void M1M3SSPublisher::logDisplacementSensorWarning() {
     _previousEventDisplacementSensorWarning = _eventDisplacementSensorWarning;
 }
 
-void M1M3SSPublisher::tryLogDisplacementSensorWarning() {
+bool M1M3SSPublisher::tryLogDisplacementSensorWarning() {
+    if (_eventDisplacementSensorWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventDisplacementSensorWarning.sensorReportsInvalidCommand !=
                 _previousEventDisplacementSensorWarning.sensorReportsInvalidCommand ||
         _eventDisplacementSensorWarning.sensorReportsCommunicationTimeoutError !=
@@ -358,7 +381,9 @@ void M1M3SSPublisher::tryLogDisplacementSensorWarning() {
         _eventDisplacementSensorWarning.unknownProblem !=
                 _previousEventDisplacementSensorWarning.unknownProblem) {
         logDisplacementSensorWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logErrorCode() {
@@ -366,10 +391,15 @@ void M1M3SSPublisher::logErrorCode() {
     _previousEventErrorCode = _eventErrorCode;
 }
 
-void M1M3SSPublisher::tryLogErrorCode() {
+bool M1M3SSPublisher::tryLogErrorCode() {
+    if (_eventErrorCodeTracker.check() == false) {
+        return false;
+    }
     if (_eventErrorCode.errorCode != _previousEventErrorCode.errorCode) {
         logErrorCode();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logForceActuatorBumpTestStatistics(int actuator_id, int test_type, int stage,
@@ -393,7 +423,10 @@ void M1M3SSPublisher::logForceActuatorState() {
     _previousEventForceActuatorState = _eventForceActuatorState;
 }
 
-void M1M3SSPublisher::tryLogForceActuatorState() {
+bool M1M3SSPublisher::tryLogForceActuatorState() {
+    if (_eventForceActuatorStateTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < FA_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected ||
@@ -401,7 +434,9 @@ void M1M3SSPublisher::tryLogForceActuatorState() {
     }
     if (changeDetected) {
         logForceActuatorState();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logForceSetpointWarning() {
@@ -473,7 +508,10 @@ void M1M3SSPublisher::logForceSetpointWarning() {
     _previousEventForceSetpointWarning = _eventForceSetpointWarning;
 }
 
-void M1M3SSPublisher::tryLogForceSetpointWarning() {
+bool M1M3SSPublisher::tryLogForceSetpointWarning() {
+    if (_eventForceSetpointWarningTracker.check() == false) {
+        return false;
+    }
     bool changeDetected =
             _eventForceSetpointWarning.xMomentWarning != _previousEventForceSetpointWarning.xMomentWarning ||
             _eventForceSetpointWarning.yMomentWarning != _previousEventForceSetpointWarning.yMomentWarning ||
@@ -513,7 +551,9 @@ void M1M3SSPublisher::tryLogForceSetpointWarning() {
     }
     if (changeDetected) {
         logForceSetpointWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logGyroWarning() {
@@ -548,7 +588,10 @@ void M1M3SSPublisher::logGyroWarning() {
     _previousEventGyroWarning = _eventGyroWarning;
 }
 
-void M1M3SSPublisher::tryLogGyroWarning() {
+bool M1M3SSPublisher::tryLogGyroWarning() {
+    if (_eventGyroWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventGyroWarning.gyroXStatusWarning != _previousEventGyroWarning.gyroXStatusWarning ||
         _eventGyroWarning.gyroYStatusWarning != _previousEventGyroWarning.gyroYStatusWarning ||
         _eventGyroWarning.gyroZStatusWarning != _previousEventGyroWarning.gyroZStatusWarning ||
@@ -607,7 +650,9 @@ void M1M3SSPublisher::tryLogGyroWarning() {
         _eventGyroWarning.mSYNCExternalTimingWarning !=
                 _previousEventGyroWarning.mSYNCExternalTimingWarning) {
         logGyroWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logHardpointActuatorInfo() {
@@ -615,7 +660,10 @@ void M1M3SSPublisher::logHardpointActuatorInfo() {
     _previousEventHardpointActuatorInfo = _eventHardpointActuatorInfo;
 }
 
-void M1M3SSPublisher::tryLogHardpointActuatorInfo() {
+bool M1M3SSPublisher::tryLogHardpointActuatorInfo() {
+    if (_eventHardpointActuatorInfoTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < HP_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected ||
@@ -664,7 +712,9 @@ void M1M3SSPublisher::tryLogHardpointActuatorInfo() {
     }
     if (changeDetected) {
         logHardpointActuatorInfo();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logHardpointActuatorState() {
@@ -672,7 +722,10 @@ void M1M3SSPublisher::logHardpointActuatorState() {
     _previousEventHardpointActuatorState = _eventHardpointActuatorState;
 }
 
-void M1M3SSPublisher::tryLogHardpointActuatorState() {
+bool M1M3SSPublisher::tryLogHardpointActuatorState() {
+    if (_eventHardpointActuatorStateTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < HP_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected ||
@@ -683,7 +736,9 @@ void M1M3SSPublisher::tryLogHardpointActuatorState() {
     }
     if (changeDetected) {
         logHardpointActuatorState();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logHardpointMonitorInfo() {
@@ -691,7 +746,10 @@ void M1M3SSPublisher::logHardpointMonitorInfo() {
     _previousEventHardpointMonitorInfo = _eventHardpointMonitorInfo;
 }
 
-void M1M3SSPublisher::tryLogHardpointMonitorInfo() {
+bool M1M3SSPublisher::tryLogHardpointMonitorInfo() {
+    if (_eventHardpointMonitorInfoTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < HP_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected ||
@@ -722,7 +780,9 @@ void M1M3SSPublisher::tryLogHardpointMonitorInfo() {
     }
     if (changeDetected) {
         logHardpointMonitorInfo();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logHardpointMonitorState() {
@@ -730,7 +790,10 @@ void M1M3SSPublisher::logHardpointMonitorState() {
     _previousEventHardpointMonitorState = _eventHardpointMonitorState;
 }
 
-void M1M3SSPublisher::tryLogHardpointMonitorState() {
+bool M1M3SSPublisher::tryLogHardpointMonitorState() {
+    if (_eventHardpointMonitorStateTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < HP_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected || _eventHardpointMonitorState.ilcState[i] !=
@@ -738,7 +801,9 @@ void M1M3SSPublisher::tryLogHardpointMonitorState() {
     }
     if (changeDetected) {
         logHardpointMonitorState();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logHardpointMonitorWarning() {
@@ -871,7 +936,10 @@ void M1M3SSPublisher::logHardpointMonitorWarning() {
     _previousEventHardpointMonitorWarning = _eventHardpointMonitorWarning;
 }
 
-void M1M3SSPublisher::tryLogHardpointMonitorWarning() {
+bool M1M3SSPublisher::tryLogHardpointMonitorWarning() {
+    if (_eventHardpointMonitorWarningTracker.check() == false) {
+        return false;
+    }
     bool changeDetected = false;
     for (int i = 0; i < HP_COUNT && !changeDetected; ++i) {
         changeDetected = changeDetected ||
@@ -932,7 +1000,9 @@ void M1M3SSPublisher::tryLogHardpointMonitorWarning() {
     }
     if (changeDetected) {
         logHardpointMonitorWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logInclinometerSensorWarning() {
@@ -946,7 +1016,10 @@ void M1M3SSPublisher::logInclinometerSensorWarning() {
     _previousEventInclinometerSensorWarning = _eventInclinometerSensorWarning;
 }
 
-void M1M3SSPublisher::tryLogInclinometerSensorWarning() {
+bool M1M3SSPublisher::tryLogInclinometerSensorWarning() {
+    if (_eventInclinometerSensorWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventInclinometerSensorWarning.sensorReportsIllegalFunction !=
                 _previousEventInclinometerSensorWarning.sensorReportsIllegalFunction ||
         _eventInclinometerSensorWarning.sensorReportsIllegalDataAddress !=
@@ -963,7 +1036,9 @@ void M1M3SSPublisher::tryLogInclinometerSensorWarning() {
         _eventInclinometerSensorWarning.unknownProblem !=
                 _previousEventInclinometerSensorWarning.unknownProblem) {
         logInclinometerSensorWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::newLogLevel(int newLevel) {
@@ -979,7 +1054,10 @@ void M1M3SSPublisher::logPowerStatus() {
     _previousEventPowerStatus = _eventPowerStatus;
 }
 
-void M1M3SSPublisher::tryLogPowerStatus() {
+bool M1M3SSPublisher::tryLogPowerStatus() {
+    if (_eventPowerStatusTracker.check() == false) {
+        return false;
+    }
     if (_eventPowerStatus.powerNetworkACommandedOn != _previousEventPowerStatus.powerNetworkACommandedOn ||
         _eventPowerStatus.powerNetworkAOutputOn != _previousEventPowerStatus.powerNetworkAOutputOn ||
         _eventPowerStatus.powerNetworkBCommandedOn != _previousEventPowerStatus.powerNetworkBCommandedOn ||
@@ -1001,7 +1079,9 @@ void M1M3SSPublisher::tryLogPowerStatus() {
                 _previousEventPowerStatus.auxPowerNetworkDCommandedOn ||
         _eventPowerStatus.auxPowerNetworkDOutputOn != _previousEventPowerStatus.auxPowerNetworkDOutputOn) {
         logPowerStatus();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logPowerWarning() {
@@ -1017,7 +1097,10 @@ void M1M3SSPublisher::logPowerWarning() {
     _previousEventPowerWarning = _eventPowerWarning;
 }
 
-void M1M3SSPublisher::tryLogPowerWarning() {
+bool M1M3SSPublisher::tryLogPowerWarning() {
+    if (_eventPowerWarningTracker.check() == false) {
+        return false;
+    }
     if (_eventPowerWarning.powerNetworkAOutputMismatch !=
                 _previousEventPowerWarning.powerNetworkAOutputMismatch ||
         _eventPowerWarning.powerNetworkBOutputMismatch !=
@@ -1035,7 +1118,9 @@ void M1M3SSPublisher::tryLogPowerWarning() {
         _eventPowerWarning.auxPowerNetworkDOutputMismatch !=
                 _previousEventPowerWarning.auxPowerNetworkDOutputMismatch) {
         logPowerWarning();
+        return true;
     }
+    return false;
 }
 
 void M1M3SSPublisher::logSoftwareVersions() {
@@ -1052,10 +1137,15 @@ void M1M3SSPublisher::logSummaryState() {
     _previousEventSummaryState = _eventSummaryState;
 }
 
-void M1M3SSPublisher::tryLogSummaryState() {
+bool M1M3SSPublisher::tryLogSummaryState() {
+    if (_eventSummaryStateTracker.check() == false) {
+        return false;
+    }
     if (_eventSummaryState.summaryState != _previousEventSummaryState.summaryState) {
         logSummaryState();
+        return true;
     }
+    return false;
 }
 
 // macro generating ackCommand method
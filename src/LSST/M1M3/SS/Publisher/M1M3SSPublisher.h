@@ -34,6 +34,7 @@
 #include <cRIO/Singleton.h>
 
 #include "EnabledForceActuators.h"
+#include "EventChangeTracker.h"
 #include "FABumpTestData.h"
 #include "ForceActuatorWarning.h"
 #include "PowerSupplyStatus.h"
@@ -142,6 +143,39 @@ public:
     }
     MTM1M3_logevent_summaryStateC* getEventSummaryState() { return &_eventSummaryState; }
 
+    /**
+     * Returns change trackers for events with tryLog* methods. Fields used
+     * for change detection shall be modified through the tracker.
+     *
+     * @see EventChangeTracker
+     */
+    EventChangeTracker* getEventAccelerometerWarningTracker() { return &_eventAccelerometerWarningTracker; }
+    EventChangeTracker* getEventAirSupplyWarningTracker() { return &_eventAirSupplyWarningTracker; }
+    EventChangeTracker* getEventCellLightStatusTracker() { return &_eventCellLightStatusTracker; }
+    EventChangeTracker* getEventCellLightWarningTracker() { return &_eventCellLightWarningTracker; }
+    EventChangeTracker* getEventDisplacementSensorWarningTracker() {
+        return &_eventDisplacementSensorWarningTracker;
+    }
+    EventChangeTracker* getEventErrorCodeTracker() { return &_eventErrorCodeTracker; }
+    EventChangeTracker* getEventForceActuatorStateTracker() { return &_eventForceActuatorStateTracker; }
+    EventChangeTracker* getEventForceSetpointWarningTracker() { return &_eventForceSetpointWarningTracker; }
+    EventChangeTracker* getEventGyroWarningTracker() { return &_eventGyroWarningTracker; }
+    EventChangeTracker* getEventHardpointActuatorInfoTracker() { return &_eventHardpointActuatorInfoTracker; }
+    EventChangeTracker* getEventHardpointActuatorStateTracker() {
+        return &_eventHardpointActuatorStateTracker;
+    }
+    EventChangeTracker* getEventHardpointMonitorInfoTracker() { return &_eventHardpointMonitorInfoTracker; }
+    EventChangeTracker* getEventHardpointMonitorStateTracker() { return &_eventHardpointMonitorStateTracker; }
+    EventChangeTracker* getEventHardpointMonitorWarningTracker() {
+        return &_eventHardpointMonitorWarningTracker;
+    }
+    EventChangeTracker* getEventInclinometerSensorWarningTracker() {
+        return &_eventInclinometerSensorWarningTracker;
+    }
+    EventChangeTracker* getEventPowerStatusTracker() { return &_eventPowerStatusTracker; }
+    EventChangeTracker* getEventPowerWarningTracker() { return &_eventPowerWarningTracker; }
+    EventChangeTracker* getEventSummaryStateTracker() { return &_eventSummaryStateTracker; }
+
     /**
      * Returns current timestamp.
      *
@@ -187,14 +221,18 @@ public:
      * @brief Sends AccelerometerWarning event if event data changed from last
      * successful (accepted in tryLogAccelerometerWarning) send.
      *
-     * Calls logAccelerometerWarning().
+     * Calls logAccelerometerWarning(). All tryLog* methods first check the
+     * event change tracker, and return immediately if no field was modified
+     * since the last call.
+     *
+     * @return true if the event was sent
      */
-    void tryLogAccelerometerWarning();
+    bool tryLogAccelerometerWarning();
     void logAirSupplyStatus(MTM1M3_logevent_airSupplyStatusC* data) {
         _m1m3SAL->logEvent_airSupplyStatus(data, 0);
     }
     void logAirSupplyWarning();
-    void tryLogAirSupplyWarning();
+    bool tryLogAirSupplyWarning();
     void logAppliedAccelerationForces();
     void logAppliedActiveOpticForces();
     void logAppliedAzimuthForces();
@@ -213,9 +251,9 @@ public:
         _m1m3SAL->logEvent_boosterValveStatus(data, 0);
     }
     void logCellLightStatus();
-    void tryLogCellLightStatus();
+    bool tryLogCellLightStatus();
     void logCellLightWarning();
-    void tryLogCellLightWarning();
+    bool tryLogCellLightWarning();
     void logCommandRejectionWarning();
     void logCommandRejectionWarning(std::string command, std::string reason);
     template <typename... Args>
@@ -232,9 +270,9 @@ public:
     void logEnabledForceActuators(MTM1M3_logevent_enabledForceActuatorsC* data) {
         _m1m3SAL->logEvent_enabledForceActuators(data, 0);
     }
-    void tryLogDisplacementSensorWarning();
+    bool tryLogDisplacementSensorWarning();
     void logErrorCode();
-    void tryLogErrorCode();
+    bool tryLogErrorCode();
     void logForceActuatorSettings(MTM1M3_logevent_forceActuatorSettingsC* data) {
         _m1m3SAL->logEvent_forceActuatorSettings(data, 0);
     }
@@ -255,7 +293,7 @@ public:
         _m1m3SAL->logEvent_forceActuatorInfo(data, 0);
     }
     void logForceActuatorState();
-    void tryLogForceActuatorState();
+    bool tryLogForceActuatorState();
     void logForceActuatorWarning(MTM1M3_logevent_forceActuatorWarningC* data) {}
     ///        _m1m3SAL->logEvent_forceActuatorWarning(data, 0);
     ///    }
@@ -264,26 +302,26 @@ public:
         _m1m3SAL->logEvent_forceControllerState(data, 0);
     }
     void logForceSetpointWarning();
-    void tryLogForceSetpointWarning();
+    bool tryLogForceSetpointWarning();
     void logGyroSettings(MTM1M3_logevent_gyroSettingsC* data) { _m1m3SAL->logEvent_gyroSettings(data, 0); }
     void logGyroWarning();
-    void tryLogGyroWarning();
+    bool tryLogGyroWarning();
     void logHardpointActuatorInfo();
-    void tryLogHardpointActuatorInfo();
+    bool tryLogHardpointActuatorInfo();
     void logHardpointActuatorSettings(MTM1M3_logevent_hardpointActuatorSettingsC* data) {
         _m1m3SAL->logEvent_hardpointActuatorSettings(data, 0);
     }
     void logHardpointActuatorState();
-    void tryLogHardpointActuatorState();
+    bool tryLogHardpointActuatorState();
     void logHardpointActuatorWarning(MTM1M3_logevent_hardpointActuatorWarningC* data) {
         _m1m3SAL->logEvent_hardpointActuatorWarning(data, 0);
     }
     void logHardpointMonitorInfo();
-    void tryLogHardpointMonitorInfo();
+    bool tryLogHardpointMonitorInfo();
     void logHardpointMonitorState();
-    void tryLogHardpointMonitorState();
+    bool tryLogHardpointMonitorState();
     void logHardpointMonitorWarning();
-    void tryLogHardpointMonitorWarning();
+    bool tryLogHardpointMonitorWarning();
     void logHardpointTestStatus(MTM1M3_logevent_hardpointTestStatusC* data) {
         _m1m3SAL->logEvent_hardpointTestStatus(data, 0);
     }
@@ -293,7 +331,7 @@ public:
         _m1m3SAL->logEvent_inclinometerSettings(data, 0);
     }
     void logInclinometerSensorWarning();
-    void tryLogInclinometerSensorWarning();
+    bool tryLogInclinometerSensorWarning();
     void logInterlockStatus(MTM1M3_logevent_interlockStatusC* data) {
         _m1m3SAL->logEvent_interlockStatus(data, 0);
     }
@@ -304,12 +342,12 @@ public:
     void logPIDInfo();
     void logPIDSettings(MTM1M3_logevent_pidSettingsC* data) { _m1m3SAL->logEvent_pidSettings(data, 0); }
     void logPowerStatus();
-    void tryLogPowerStatus();
+    bool tryLogPowerStatus();
     void logPowerSupplyStatus(MTM1M3_logevent_powerSupplyStatusC* data) {
         _m1m3SAL->logEvent_powerSupplyStatus(data, 0);
     }
     void logPowerWarning();
-    void tryLogPowerWarning();
+    bool tryLogPowerWarning();
     void logPreclippedAccelerationForces(MTM1M3_logevent_preclippedAccelerationForcesC* data) {
         _m1m3SAL->logEvent_preclippedAccelerationForces(data, 0);
     }
@@ -355,7 +393,7 @@ public:
     }
     void logSoftwareVersions();
     void logSummaryState();
-    void tryLogSummaryState();
+    bool tryLogSummaryState();
 
     void logRaisingLoweringInfo(MTM1M3_logevent_raisingLoweringInfoC* data) {
         _m1m3SAL->logEvent_raisingLoweringInfo(data, 0);
@@ -508,6 +546,25 @@ private:
     MTM1M3_logevent_powerSupplyStatusC _previousEventPowerSupplyStatus;
     MTM1M3_logevent_powerWarningC _previousEventPowerWarning;
     MTM1M3_logevent_summaryStateC _previousEventSummaryState;
+
+    EventChangeTracker _eventAccelerometerWarningTracker;
+    EventChangeTracker _eventAirSupplyWarningTracker;
+    EventChangeTracker _eventCellLightStatusTracker;
+    EventChangeTracker _eventCellLightWarningTracker;
+    EventChangeTracker _eventDisplacementSensorWarningTracker;
+    EventChangeTracker _eventErrorCodeTracker;
+    EventChangeTracker _eventForceActuatorStateTracker;
+    EventChangeTracker _eventForceSetpointWarningTracker;
+    EventChangeTracker _eventGyroWarningTracker;
+    EventChangeTracker _eventHardpointActuatorInfoTracker;
+    EventChangeTracker _eventHardpointActuatorStateTracker;
+    EventChangeTracker _eventHardpointMonitorInfoTracker;
+    EventChangeTracker _eventHardpointMonitorStateTracker;
+    EventChangeTracker _eventHardpointMonitorWarningTracker;
+    EventChangeTracker _eventInclinometerSensorWarningTracker;
+    EventChangeTracker _eventPowerStatusTracker;
+    EventChangeTracker _eventPowerWarningTracker;
+    EventChangeTracker _eventSummaryStateTracker;
 };
 
 } /* namespace SS */
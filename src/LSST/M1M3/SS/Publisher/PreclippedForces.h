@@ -77,6 +77,15 @@ public:
      */
     bool check_changes();
 
+    /**
+     * Returns true if changed data are waiting to be send out. When the data
+     * don't change, check_changes needs to be called only if this is true.
+     *
+     * @return True if the last check_changes call postponed sending changed
+     * data.
+     */
+    bool has_unsent_changes() const { return _unsent_changes; }
+
 protected:
     std::function<void(T*)> _send_function;
 
@@ -124,6 +133,15 @@ public:
      */
     bool check_changes();
 
+    /**
+     * Returns true if changed data are waiting to be send out. When the data
+     * don't change, check_changes needs to be called only if this is true.
+     *
+     * @return True if the last check_changes call postponed sending changed
+     * data.
+     */
+    bool has_unsent_changes() const { return _unsent_changes; }
+
 protected:
     std::function<void(T*)> _send_function;
 
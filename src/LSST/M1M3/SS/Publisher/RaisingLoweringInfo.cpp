@@ -23,7 +23,6 @@
 
 #include <spdlog/spdlog.h>
 
-#include <ForceActuatorSettings.h>
 #include <M1M3SSPublisher.h>
 #include <RaisingLoweringInfo.h>
 
@@ -43,18 +42,18 @@ void RaisingLoweringInfo::sendUpdates(bool force) {
     }
 }
 
-void RaisingLoweringInfo::incSupportPercentage() {
-    SPDLOG_TRACE("Incrementing support percentage");
-    weightSupportedPercent += ForceActuatorSettings::instance().raiseIncrementPercentage;
+void RaisingLoweringInfo::incSupportPercentage(double increment) {
+    SPDLOG_TRACE("Incrementing support percentage by {}", increment);
+    weightSupportedPercent += increment;
     if (supportPercentageFilled()) {
         weightSupportedPercent = 100.0;
     }
     _updated = true;
 }
 
-void RaisingLoweringInfo::decSupportPercentage() {
-    SPDLOG_TRACE("Decrementing support percentage");
-    weightSupportedPercent -= ForceActuatorSettings::instance().lowerDecrementPercentage;
+void RaisingLoweringInfo::decSupportPercentage(double decrement) {
+    SPDLOG_TRACE("Decrementing support percentage by {}", decrement);
+    weightSupportedPercent -= decrement;
     if (supportPercentageZeroed()) {
         weightSupportedPercent = 0.0;
     }
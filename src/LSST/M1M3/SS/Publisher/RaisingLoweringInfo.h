@@ -57,16 +57,20 @@ public:
     void setTimeTimeout(double new_timeTimeout);
 
     /**
-     * Increases mirrror support percentage by RaiseIncrementPercentage setting
-     * value.
+     * Increases mirrror support percentage.
+     *
+     * @param increment percentage increment, RaiseIncrementPercentage setting
+     * value or value calculated by RaiseLowerProfile
      */
-    void incSupportPercentage();
+    void incSupportPercentage(double increment);
 
     /**
-     * Decrements mirror support percentage by LowerDecrementPercentage setting
-     * value.
+     * Decrements mirror support percentage.
+     *
+     * @param decrement percentage decrement, LowerDecrementPercentage setting
+     * value or value calculated by RaiseLowerProfile
      */
-    void decSupportPercentage();
+    void decSupportPercentage(double decrement);
 
     /**
      * Sets support percentage to 0%.
@@ -39,7 +39,13 @@ using namespace LSST::M1M3::SS;
 
 ForceActuatorNeighbors::ForceActuatorNeighbors() {}
 
-ForceActuatorSettings::ForceActuatorSettings(token) { measuredWarningPercentage = 90; }
+ForceActuatorSettings::ForceActuatorSettings(token) : _version(0) {
+    measuredWarningPercentage = 90;
+    mirrorCenterOfGravityX = 0;
+    mirrorCenterOfGravityY = 0;
+    mirrorCenterOfGravityZ = 0;
+    _calculateMomentArms();
+}
 
 void load_bump_test_limits(YAML::Node node, float& warning, float& error) {
     warning = node["Warning"].as<float>();
@@ -141,6 +147,18 @@ void ForceActuatorSettings::load(YAML::Node doc) {
     TableLoader::loadLimitTable(1, &CylinderLimitSecondaryTable,
                                 doc["CylinderLimitSecondaryTablePath"].as<std::string>());
 
+    AccelerationLimits.set(AccelerationLimitXTable, AccelerationLimitYTable, AccelerationLimitZTable);
+    ActiveOpticLimits.set(ActiveOpticLimitZTable);
+    AzimuthLimits.set(AzimuthLimitXTable, AzimuthLimitYTable, AzimuthLimitZTable);
+    BalanceLimits.set(BalanceLimitXTable, BalanceLimitYTable, BalanceLimitZTable);
+    ElevationLimits.set(ElevationLimitXTable, ElevationLimitYTable, ElevationLimitZTable);
+    OffsetLimits.set(OffsetLimitXTable, OffsetLimitYTable, OffsetLimitZTable);
+    StaticLimits.set(StaticLimitXTable, StaticLimitYTable, StaticLimitZTable);
+    ThermalLimits.set(ThermalLimitXTable, ThermalLimitYTable, ThermalLimitZTable);
+    VelocityLimits.set(VelocityLimitXTable, VelocityLimitYTable, VelocityLimitZTable);
+    CylinderPrimaryLimits.set(CylinderLimitPrimaryTable);
+    CylinderSecondaryLimits.set(CylinderLimitSecondaryTable);
+
     measuredWarningPercentage = doc["MeasuredWarningPercentage"].as<float>();
 
     TableLoader::loadForceLimitTable(1, measuredZForceLowLimit, measuredZForceHighLimit,
@@ -174,6 +192,8 @@ void ForceActuatorSettings::load(YAML::Node doc) {
     mirrorCenterOfGravityY = doc["MirrorCenterOfGravityY"].as<float>();
     mirrorCenterOfGravityZ = doc["MirrorCenterOfGravityZ"].as<float>();
 
+    _calculateMomentArms();
+
     raiseIncrementPercentage = doc["RaiseIncrementPercentage"].as<double>();
     lowerDecrementPercentage = doc["LowerDecrementPercentage"].as<double>();
     raiseLowerFollowingErrorLimit = doc["RaiseLowerFollowingErrorLimit"].as<float>();
@@ -201,6 +221,8 @@ void ForceActuatorSettings::load(YAML::Node doc) {
     bumpTestSettleTime = bumpTest["SettleTime"].as<float>(3.0);
     bumpTestMeasurements = bumpTest["Measurements"].as<int>(10);
     bumpTestMinimalDistance = bumpTest["MinimalDistance"].as<float>();
+    bumpTestExpectedStageTime = bumpTest["ExpectedStageTime"].as<float>(bumpTestSettleTime);
+    bumpTestRetries = bumpTest["Retries"].as<int>(1);
 
     enableStaticForcesSupportedPercentage = doc["EnableStaticForcesSupportedPercentage"].as<float>();
     if (enableStaticForcesSupportedPercentage < 20 || enableStaticForcesSupportedPercentage >= 70) {
@@ -217,6 +239,8 @@ void ForceActuatorSettings::load(YAML::Node doc) {
                             bumpTestMinimalDistance));
     }
 
+    _version++;
+
     log();
 }
 
@@ -232,26 +256,16 @@ ForcesAndMoments ForceActuatorSettings::calculateForcesAndMoments(const std::vec
     fm.Mz = 0;
     fm.ForceMagnitude = 0;
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
     for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
-        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
-        float rx = faa_settings.Table[zIndex].XPosition - mirrorCenterOfGravityX;
-        float ry = faa_settings.Table[zIndex].YPosition - mirrorCenterOfGravityY;
-        float rz = faa_settings.Table[zIndex].ZPosition - mirrorCenterOfGravityZ;
-        float fx = 0;
-        float fy = 0;
+        int xIndex = _xIndex[zIndex];
+        int yIndex = _yIndex[zIndex];
+        float rx = _momentArmX[zIndex];
+        float ry = _momentArmY[zIndex];
+        float rz = _momentArmZ[zIndex];
+        float fx = xIndex != -1 ? xForces[xIndex] : 0;
+        float fy = yIndex != -1 ? yForces[yIndex] : 0;
         float fz = zForces[zIndex];
 
-        if (xIndex != -1) {
-            fx = xForces[xIndex];
-        }
-
-        if (yIndex != -1) {
-            fy = yForces[yIndex];
-        }
-
         fm.Fx += fx;
         fm.Fy += fy;
         fm.Fz += fz;
@@ -273,19 +287,12 @@ ForcesAndMoments ForceActuatorSettings::calculateForcesAndMoments(const std::vec
     fm.Mz = 0;
     fm.ForceMagnitude = 0;
 
-    auto& faa_settings = ForceActuatorApplicationSettings::instance();
-
     for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
-        float rx = faa_settings.Table[zIndex].XPosition - mirrorCenterOfGravityX;
-        float ry = faa_settings.Table[zIndex].YPosition - mirrorCenterOfGravityY;
-        float rz = faa_settings.Table[zIndex].ZPosition - mirrorCenterOfGravityZ;
-        float fx = 0;
-        float fy = 0;
         float fz = zForces[zIndex];
 
         fm.Fz += fz;
-        fm.Mx += (fz * ry) - (fy * rz);
-        fm.My += (fx * rz) - (fz * rx);
+        fm.Mx += fz * _momentArmY[zIndex];
+        fm.My -= fz * _momentArmX[zIndex];
     }
     return fm;
 }
@@ -628,3 +635,15 @@ void ForceActuatorSettings::_loadFollowingErrorTables(const std::string& primary
         throw std::runtime_error(fmt::format("Cannot read {}: {}", secondaryFilename, er.what()));
     }
 }
+
+void ForceActuatorSettings::_calculateMomentArms() {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    for (int zIndex = 0; zIndex < FA_COUNT; ++zIndex) {
+        _momentArmX[zIndex] = faa_settings.Table[zIndex].XPosition - mirrorCenterOfGravityX;
+        _momentArmY[zIndex] = faa_settings.Table[zIndex].YPosition - mirrorCenterOfGravityY;
+        _momentArmZ[zIndex] = faa_settings.Table[zIndex].ZPosition - mirrorCenterOfGravityZ;
+        _xIndex[zIndex] = faa_settings.ZIndexToXIndex[zIndex];
+        _yIndex[zIndex] = faa_settings.ZIndexToYIndex[zIndex];
+    }
+}
@@ -33,6 +33,7 @@
 
 #include <cRIO/Singleton.h>
 
+#include <ClippingLimits.h>
 #include <DistributedForces.h>
 #include <ForceComponentSettings.h>
 #include <ForcesAndMoments.h>
@@ -68,6 +69,15 @@ public:
      */
     bool isActuatorDisabled(int32_t actIndex) { return enabledActuators[actIndex] == false; }
 
+    /**
+     * Calculates mirror forces and moments. Uses moment arms precomputed from
+     * actuator positions and mirror center of gravity during settings load.
+     * Use ForcesAndMomentsCache for repeated calculation on the same data.
+     *
+     * @param xForces
+     * @param yForces
+     * @param zForces
+     */
     ForcesAndMoments calculateForcesAndMoments(const std::vector<float>& xForces,
                                                const std::vector<float>& yForces,
                                                const std::vector<float>& zForces);
@@ -78,6 +88,14 @@ public:
      * @param zForces
      */
     ForcesAndMoments calculateForcesAndMoments(const std::vector<float>& zForces);
+
+    /**
+     * Returns settings version. Incremented every time settings are loaded,
+     * so values derived from limit tables or actuator geometry can be
+     * invalidated.
+     */
+    uint32_t getVersion() const { return _version; }
+
     DistributedForces calculateForceFromAngularAcceleration(float angularAccelerationX,
                                                             float angularAccelerationY,
                                                             float angularAccelerationZ);
@@ -157,6 +175,20 @@ public:
     std::vector<Limit> CylinderLimitPrimaryTable;
     std::vector<Limit> CylinderLimitSecondaryTable;
 
+    /// LowFault and HighFault columns of the limit tables, used for force components clipping
+    ForceClippingLimits AccelerationLimits;
+    ClippingLimits<FA_Z_COUNT> ActiveOpticLimits;
+    ForceClippingLimits AzimuthLimits;
+    ForceClippingLimits BalanceLimits;
+    ForceClippingLimits ElevationLimits;
+    ForceClippingLimits OffsetLimits;
+    ForceClippingLimits StaticLimits;
+    ForceClippingLimits ThermalLimits;
+    ForceClippingLimits VelocityLimits;
+    /// LowFault and HighFault columns of cylinder limit tables, used for cylinder setpoints clipping
+    ClippingLimits<FA_COUNT, int> CylinderPrimaryLimits;
+    ClippingLimits<FA_S_COUNT, int> CylinderSecondaryLimits;
+
     ForceActuatorNeighbors Neighbors[FA_COUNT];
 
     ForceComponentSettings AberrationComponentSettings;
@@ -175,12 +207,28 @@ public:
     float preclippedMaxDelay;
     float enableStaticForcesSupportedPercentage;
 
+    /// expected duration of a single bump test stage (s), used to plan mirror bump tests
+    float bumpTestExpectedStageTime;
+    /// how many times failed test is retried during mirror bump tests
+    int bumpTestRetries;
+
 private:
     void _loadNearNeighborZTable(const std::string& filename);
     void _loadNeighborsTable(const std::string& filename);
     void _loadFollowingErrorTables(const std::string& primaryFilename, const std::string& secondaryFilename);
+    void _calculateMomentArms();
 
     float _measuredForceWarningRatio;
+
+    // actuator position relative to mirror center of gravity, Z index order
+    float _momentArmX[FA_COUNT];
+    float _momentArmY[FA_COUNT];
+    float _momentArmZ[FA_COUNT];
+    // X and Y force index for Z index, -1 if actuator doesn't have X or Y axis
+    int32_t _xIndex[FA_COUNT];
+    int32_t _yIndex[FA_COUNT];
+
+    uint32_t _version;
 };
 
 }  // namespace SS
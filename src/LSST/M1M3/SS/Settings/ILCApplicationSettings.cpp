@@ -68,4 +68,26 @@ void ILCApplicationSettings::load(YAML::Node doc) {
     ReportLVDT = doc["ReportLVDT"].as<uint32_t>();
 
     WarningGracePeriod = doc["WarningGracePeriod"].as<float>();
+
+    auto rates = doc["RequestRates"];
+    auto rate = [rates](const char* name) {
+        uint32_t divisor = rates[name].as<uint32_t>();
+        if (divisor < 1) {
+            throw std::runtime_error(
+                    fmt::format("RequestRates {} shall be at least 1, is: {}", name, divisor));
+        }
+        return divisor;
+    };
+
+    ForceActuatorStatusRate = rate("ForceActuatorStatus");
+    ForceActuatorServerStatusRate = rate("ForceActuatorServerStatus");
+    HardpointStatusRate = rate("HardpointStatus");
+    HardpointServerStatusRate = rate("HardpointServerStatus");
+    HardpointMonitorPressureRate = rate("HardpointMonitorPressure");
+    HardpointMonitorStatusRate = rate("HardpointMonitorStatus");
+    HardpointMonitorServerStatusRate = rate("HardpointMonitorServerStatus");
+    HardpointMonitorLVDTRate = rate("HardpointMonitorLVDT");
+    HardpointStepMotorRate = rate("HardpointStepMotor");
+
+    SubnetByteBudget = doc["SubnetByteBudget"].as<uint32_t>();
 }
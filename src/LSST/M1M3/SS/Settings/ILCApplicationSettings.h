@@ -66,6 +66,27 @@ struct ILCApplicationSettings : public cRIO::Singleton<ILCApplicationSettings> {
     uint32_t ReportLVDT;
 
     float WarningGracePeriod;
+
+    /**
+     * Rate divisors of requests in Raised and Active bus lists. Request is
+     * sent every divisor cycle, 1 means every cycle.
+     */
+    uint32_t ForceActuatorStatusRate;
+    uint32_t ForceActuatorServerStatusRate;
+    uint32_t HardpointStatusRate;
+    uint32_t HardpointServerStatusRate;
+    uint32_t HardpointMonitorPressureRate;
+    uint32_t HardpointMonitorStatusRate;
+    uint32_t HardpointMonitorServerStatusRate;
+    uint32_t HardpointMonitorLVDTRate;
+    uint32_t HardpointStepMotorRate;
+
+    /**
+     * Maximal number of bytes (requests and responses) transferred on a
+     * subnet in a cycle. Requests exceeding the budget are postponed. 0 for
+     * unlimited.
+     */
+    uint32_t SubnetByteBudget;
 };
 
 } /* namespace SS */
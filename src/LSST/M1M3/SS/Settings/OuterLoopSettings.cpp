@@ -0,0 +1,41 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <OuterLoopSettings.h>
+
+using namespace LSST::M1M3::SS;
+
+OuterLoopSettings::OuterLoopSettings(token) : StageTimingReportInterval(0) {}
+
+void OuterLoopSettings::load(YAML::Node doc) {
+    SPDLOG_INFO("Loading OuterLoopSettings");
+    StageTimingReportInterval = doc["StageTimingReportInterval"].as<int>(0);
+    if (StageTimingReportInterval < 0) {
+        throw std::runtime_error(fmt::format("Invalid StageTimingReportInterval: {}, must be >= 0",
+                                             StageTimingReportInterval));
+    }
+}
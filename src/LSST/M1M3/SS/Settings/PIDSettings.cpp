@@ -21,6 +21,8 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <stdexcept>
+
 #include <spdlog/spdlog.h>
 #include <yaml-cpp/yaml.h>
 
@@ -47,7 +49,7 @@ void PIDSettings::load(YAML::Node doc, const char* kind) {
 }
 
 PIDParameters PIDSettings::getParameters(int index) {
-    return PIDParameters(timestep[index], p[index], i[index], d[index], n[index]);
+    return PIDParameters(timestep[index], p[index], i[index], d[index], n[index], outputLimit[index]);
 }
 
 void PIDSettings::_parsePID(const YAML::Node& node, int index) {
@@ -56,4 +58,10 @@ void PIDSettings::_parsePID(const YAML::Node& node, int index) {
     i[index] = node["I"].as<double>();
     d[index] = node["D"].as<double>();
     n[index] = node["N"].as<double>();
+    outputLimit[index] = node["OutputLimit"].as<double>(0);
+    if (outputLimit[index] < 0) {
+        throw std::runtime_error(
+                fmt::format("{} PID {} OutputLimit must be positive or 0, is {}", settingName, index,
+                            outputLimit[index]));
+    }
 }
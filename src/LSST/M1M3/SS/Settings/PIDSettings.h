@@ -42,6 +42,9 @@ struct PIDSettings : public MTM1M3_logevent_pidSettingsC {
 
     PIDParameters getParameters(int index);
 
+    //* Anti-windup output limits, 0 when not used. Not part of the SAL event.
+    double outputLimit[6];
+
 private:
     void _parsePID(const YAML::Node& node, int index);
 };
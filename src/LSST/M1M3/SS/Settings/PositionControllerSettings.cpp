@@ -25,6 +25,7 @@
 #include <yaml-cpp/yaml.h>
 
 #include <PositionControllerSettings.h>
+#include <RaiseLowerProfile.h>
 
 using namespace LSST::M1M3::SS;
 
@@ -50,6 +51,22 @@ void PositionControllerSettings::load(YAML::Node doc) {
     lowerTimeout = lower["Timeout"].as<int>();
     lowerPositionOffset = lower["PositionOffset"].as<float>();
 
+    raiseLowerProfileEnabled = false;
+    raiseLowerProfileMaxFactor = 1;
+    raiseLowerProfileLowUtilization = 0.3;
+    raiseLowerProfileHighUtilization = 0.8;
+
+    if (doc["RaiseLowerProfile"]) {
+        auto profile = doc["RaiseLowerProfile"];
+
+        raiseLowerProfileEnabled = profile["Enabled"].as<bool>();
+        raiseLowerProfileMaxFactor = profile["MaxIncrementFactor"].as<float>();
+        raiseLowerProfileLowUtilization = profile["LowUtilization"].as<float>();
+        raiseLowerProfileHighUtilization = profile["HighUtilization"].as<float>();
+    }
+    RaiseLowerProfile::validate(raiseLowerProfileMaxFactor, raiseLowerProfileLowUtilization,
+                                raiseLowerProfileHighUtilization);
+
     referencePosition = doc["ReferencePosition"].as<std::vector<int32_t>>();
     if (referencePosition.size() != HP_COUNT) {
         throw std::runtime_error(fmt::format("Expecting {} encoder's ReferencePosition, got {}", HP_COUNT,
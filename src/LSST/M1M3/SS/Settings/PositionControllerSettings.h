@@ -51,6 +51,15 @@ public:
     void load(YAML::Node doc);
 
     void log() { M1M3SSPublisher::instance().logPositionControllerSettings(this); }
+
+    //* adapt raise/lower support increment to measured load
+    bool raiseLowerProfileEnabled;
+    //* maximal support increment, as multiple of the fixed increment
+    float raiseLowerProfileMaxFactor;
+    //* load ratio below which maximal increment is used
+    float raiseLowerProfileLowUtilization;
+    //* load ratio above which fixed increment is used
+    float raiseLowerProfileHighUtilization;
 };
 
 } /* namespace SS */
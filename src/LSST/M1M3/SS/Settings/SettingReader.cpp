@@ -38,6 +38,7 @@
 #include "HardpointActuatorSettings.h"
 #include "ILCApplicationSettings.h"
 #include "InclinometerSettings.h"
+#include "OuterLoopSettings.h"
 #include "PositionControllerSettings.h"
 #include "SettingReader.h"
 
@@ -128,6 +129,7 @@ void SettingReader::load() {
         _trackingPID.load(settings["PIDSettings"], "Tracking");
 
         InclinometerSettings::instance().load(settings["InclinometerSettings"]);
+        OuterLoopSettings::instance().load(settings["OuterLoopSettings"]);
 
 #ifdef SIMULATOR
         SimulatorSettings::instance().load(settings["simulator"]);
@@ -96,3 +96,12 @@ State* StaticStateFactory::create(States::Type state) {
             return 0;
     }
 }
+
+bool StaticStateFactory::isLegalTransition(States::Type from, States::Type to) {
+    for (auto& transition : LEGAL_TRANSITIONS) {
+        if (transition.from == from && transition.to == to) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -47,14 +47,96 @@ namespace LSST {
 namespace M1M3 {
 namespace SS {
 
+/**
+ * Allowed change of the current state.
+ */
+struct StateTransition {
+    States::Type from;
+    States::Type to;
+};
+
+/**
+ * Holds single instance of every state. Context caches pointer returned from
+ * create, so the lookup is done only on state transitions.
+ */
 class StaticStateFactory {
 public:
     StaticStateFactory();
 
     static StaticStateFactory& get();
 
+    /**
+     * Returns state object for the given state type.
+     *
+     * @param state state type
+     *
+     * @return pointer to state object, nullptr for unknown state
+     */
     State* create(States::Type state);
 
+    /**
+     * All state transitions the state objects can request. Any state, which
+     * calls SafetyController::checkSafety, can transition into
+     * LoweringFaultState.
+     */
+    static constexpr StateTransition LEGAL_TRANSITIONS[] = {
+            {States::OfflineState, States::StandbyState},
+            {States::StandbyState, States::OfflineState},
+            {States::StandbyState, States::DisabledState},
+            {States::StandbyState, States::LoweringFaultState},
+            {States::DisabledState, States::StandbyState},
+            {States::DisabledState, States::ParkedState},
+            {States::DisabledState, States::LoweringFaultState},
+            {States::ParkedState, States::DisabledState},
+            {States::ParkedState, States::RaisingState},
+            {States::ParkedState, States::ParkedEngineeringState},
+            {States::ParkedState, States::LoweringFaultState},
+            {States::RaisingState, States::ActiveState},
+            {States::RaisingState, States::LoweringState},
+            {States::RaisingState, States::PausedRaisingState},
+            {States::RaisingState, States::LoweringFaultState},
+            {States::PausedRaisingState, States::RaisingState},
+            {States::PausedRaisingState, States::LoweringFaultState},
+            {States::ActiveState, States::LoweringState},
+            {States::ActiveState, States::ActiveEngineeringState},
+            {States::ActiveState, States::LoweringFaultState},
+            {States::LoweringState, States::ParkedState},
+            {States::LoweringState, States::PausedLoweringState},
+            {States::LoweringState, States::LoweringFaultState},
+            {States::PausedLoweringState, States::LoweringState},
+            {States::PausedLoweringState, States::LoweringFaultState},
+            {States::ParkedEngineeringState, States::DisabledState},
+            {States::ParkedEngineeringState, States::ParkedState},
+            {States::ParkedEngineeringState, States::RaisingEngineeringState},
+            {States::ParkedEngineeringState, States::LoweringFaultState},
+            {States::RaisingEngineeringState, States::ActiveEngineeringState},
+            {States::RaisingEngineeringState, States::LoweringEngineeringState},
+            {States::RaisingEngineeringState, States::PausedRaisingEngineeringState},
+            {States::RaisingEngineeringState, States::LoweringFaultState},
+            {States::PausedRaisingEngineeringState, States::RaisingState},
+            {States::PausedRaisingEngineeringState, States::LoweringFaultState},
+            {States::ActiveEngineeringState, States::ActiveState},
+            {States::ActiveEngineeringState, States::LoweringEngineeringState},
+            {States::ActiveEngineeringState, States::ProfileHardpointCorrectionState},
+            {States::ActiveEngineeringState, States::LoweringFaultState},
+            {States::ProfileHardpointCorrectionState, States::ActiveEngineeringState},
+            {States::ProfileHardpointCorrectionState, States::LoweringFaultState},
+            {States::LoweringEngineeringState, States::ParkedEngineeringState},
+            {States::LoweringEngineeringState, States::PausedLoweringEngineeringState},
+            {States::LoweringEngineeringState, States::LoweringFaultState},
+            {States::PausedLoweringEngineeringState, States::LoweringState},
+            {States::PausedLoweringEngineeringState, States::LoweringFaultState},
+            {States::LoweringFaultState, States::FaultState},
+            {States::FaultState, States::StandbyState}};
+
+    /**
+     * Returns true if transition is listed in LEGAL_TRANSITIONS.
+     *
+     * @param from current state
+     * @param to new state
+     */
+    static bool isLegalTransition(States::Type from, States::Type to);
+
 private:
     StaticStateFactory& operator=(const StaticStateFactory&) = delete;
     StaticStateFactory(const StaticStateFactory&) = delete;
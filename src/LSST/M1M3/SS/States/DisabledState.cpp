@@ -21,25 +21,16 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Accelerometer.h>
 #include <DigitalInputOutput.h>
 #include <DisabledState.h>
-#include <Displacement.h>
-#include <FPGA.h>
-#include <ForceActuatorData.h>
 #include <ForceController.h>
-#include <Gyro.h>
-#include <HardpointActuatorWarning.h>
-#include <Heartbeat.h>
-#include <Inclinometer.h>
 #include <M1M3SSPublisher.h>
 #include <Model.h>
 #include <ModelPublisher.h>
+#include <OuterLoopPipeline.h>
 #include <PowerController.h>
 #include <SafetyController.h>
-#include <chrono>
 #include <spdlog/spdlog.h>
-#include <thread>
 
 namespace LSST {
 namespace M1M3 {
@@ -50,31 +41,7 @@ DisabledState::DisabledState() : State("DisabledState") {}
 States::Type DisabledState::update(UpdateCommand* command) {
     ModelPublisher publishIt{};
     SPDLOG_TRACE("DisabledState::update()");
-    auto ilc = Model::instance().getILC();
-    ilc->writeFreezeSensorListBuffer();
-    ilc->triggerModbus();
-    Heartbeat::instance().tryToggle();
-    std::this_thread::sleep_for(1ms);
-    IFPGA::get().pullTelemetry();
-    Model::instance().getAccelerometer()->processData();
-    DigitalInputOutput::instance().processData();
-    Model::instance().getDisplacement()->processData();
-    Model::instance().getGyro()->processData();
-    Model::instance().getInclinometer()->processData();
-    Model::instance().getPowerController()->processData();
-    ilc->waitForAllSubnets(false);
-    ilc->readAll();
-    ilc->calculateHPPostion();
-    ilc->calculateHPMirrorForces();
-    ilc->calculateFAMirrorForces();
-    ilc->verifyResponses();
-    ilc->publishForceActuatorStatus();
-    ForceActuatorData::instance().send();
-    ilc->publishHardpointStatus();
-    ilc->publishHardpointData();
-    ilc->publishHardpointMonitorStatus();
-    ilc->publishHardpointMonitorData();
-    HardpointActuatorWarning::instance().send();
+    OuterLoopPipeline::instance().run(OuterLoopPipeline::DISABLED);
     return Model::instance().getSafetyController()->checkSafety(States::NoStateTransition);
 }
 
@@ -21,23 +21,16 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <chrono>
-#include <thread>
-
 #include <spdlog/spdlog.h>
 
 #include <SAL_MTM1M3C.h>
 
-#include <Accelerometer.h>
-#include <BoosterValveController.h>
 #include <DigitalInputOutput.h>
 #include <EnabledState.h>
-#include <ForceActuatorData.h>
-#include <HardpointActuatorWarning.h>
-#include <Heartbeat.h>
 #include <M1M3SSPublisher.h>
 #include <Model.h>
 #include <ModelPublisher.h>
+#include <OuterLoopPipeline.h>
 #include <TMA.h>
 #include <TMAAzimuthSampleCommand.h>
 #include <TMAElevationSampleCommand.h>
@@ -63,37 +56,7 @@ States::Type EnabledState::storeTMAElevationSample(TMAElevationSampleCommand* co
 void EnabledState::runLoop() {
     SPDLOG_TRACE("EnabledState: runLoop()");
     DigitalInputOutput::instance().toggleSystemOperationalHB(0, true);
-    IFPGA::get().pullTelemetry();
-    Model::instance().getAccelerometer()->processData();
-    DigitalInputOutput::instance().processData();
-    Model::instance().getDisplacement()->processData();
-    Model::instance().getGyro()->processData();
-    Model::instance().getInclinometer()->processData();
-    Model::instance().getPowerController()->processData();
-
-    Heartbeat::instance().tryToggle();
-
-    auto ilc = Model::instance().getILC();
-    Model::instance().getForceController()->updateAppliedForces();
-    Model::instance().getForceController()->processAppliedForces();
-    ilc->writeControlListBuffer();
-    ilc->triggerModbus();
-    std::this_thread::sleep_for(1ms);
-    ilc->waitForAllSubnets(true);
-    ilc->readAll();
-    ilc->calculateHPPostion();
-    ilc->calculateHPMirrorForces();
-    ilc->calculateFAMirrorForces();
-    ilc->verifyResponses();
-    ilc->publishForceActuatorStatus();
-    ForceActuatorData::instance().send();
-    ilc->publishHardpointStatus();
-    ilc->publishHardpointData();
-    ilc->publishHardpointMonitorStatus();
-    ilc->publishHardpointMonitorData();
-    BoosterValveController::instance().checkTriggers();
-    HardpointActuatorWarning::instance().send();
-    M1M3SSPublisher::instance().getEnabledForceActuators()->log();
+    OuterLoopPipeline::instance().run(OuterLoopPipeline::ENABLED);
     DigitalInputOutput::instance().toggleSystemOperationalHB(1, true);
 }
 
@@ -21,17 +21,15 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <thread>
 #include <unistd.h>
 
 #include <spdlog/spdlog.h>
 
 #include <DigitalInputOutput.h>
 #include <FaultState.h>
-#include <ForceActuatorData.h>
-#include <Heartbeat.h>
 #include <Model.h>
 #include <ModelPublisher.h>
+#include <OuterLoopPipeline.h>
 #include <RaisingLoweringInfo.h>
 
 using namespace LSST::M1M3::SS;
@@ -44,30 +42,7 @@ States::Type FaultState::update(UpdateCommand* command) {
     DigitalInputOutput::instance().toggleSystemOperationalHB(0, false);
     ModelPublisher publishIt{};
     SPDLOG_TRACE("FaultState: update()");
-    auto ilc = Model::instance().getILC();
-    ilc->writeFreezeSensorListBuffer();
-    ilc->triggerModbus();
-    Heartbeat::instance().tryToggle();
-    std::this_thread::sleep_for(1ms);
-    IFPGA::get().pullTelemetry();
-    Model::instance().getAccelerometer()->processData();
-    DigitalInputOutput::instance().processData();
-    Model::instance().getDisplacement()->processData();
-    Model::instance().getGyro()->processData();
-    Model::instance().getInclinometer()->processData();
-    Model::instance().getPowerController()->processData();
-    ilc->waitForAllSubnets(false);
-    ilc->readAll();
-    ilc->calculateHPPostion();
-    ilc->calculateHPMirrorForces();
-    ilc->calculateFAMirrorForces();
-    ilc->verifyResponses();
-    ilc->publishForceActuatorStatus();
-    ForceActuatorData::instance().send();
-    ilc->publishHardpointStatus();
-    ilc->publishHardpointData();
-    ilc->publishHardpointMonitorStatus();
-    ilc->publishHardpointMonitorData();
+    OuterLoopPipeline::instance().run(OuterLoopPipeline::FAULT);
     DigitalInputOutput::instance().toggleMirrorRaisedHB(1, false);
     DigitalInputOutput::instance().toggleSystemOperationalHB(1, false);
     return States::NoStateTransition;
@@ -0,0 +1,158 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <spdlog/spdlog.h>
+
+#include <Accelerometer.h>
+#include <BoosterValveController.h>
+#include <DigitalInputOutput.h>
+#include <Displacement.h>
+#include <ForceActuatorData.h>
+#include <ForceController.h>
+#include <Gyro.h>
+#include <HardpointActuatorWarning.h>
+#include <Heartbeat.h>
+#include <IFPGA.h>
+#include <Inclinometer.h>
+#include <M1M3SSPublisher.h>
+#include <Model.h>
+#include <OuterLoopPipeline.h>
+#include <PowerController.h>
+#include <SSILCs.h>
+
+using namespace std::chrono_literals;
+using namespace LSST::M1M3::SS;
+
+namespace {
+
+void freezeSensors() {
+    auto ilc = Model::instance().getILC();
+    ilc->writeFreezeSensorListBuffer();
+    ilc->triggerModbus();
+}
+
+void controlList() {
+    auto ilc = Model::instance().getILC();
+    ilc->writeControlListBuffer();
+    ilc->triggerModbus();
+}
+
+void applyForces() {
+    Model::instance().getForceController()->updateAppliedForces();
+    Model::instance().getForceController()->processAppliedForces();
+}
+
+void waitRealtime() {
+    std::this_thread::sleep_for(1ms);
+    Model::instance().getILC()->waitForAllSubnets(true);
+}
+
+void waitConfiguration() {
+    std::this_thread::sleep_for(1ms);
+    Model::instance().getILC()->waitForAllSubnets(false);
+}
+
+void ilcRead() {
+    auto ilc = Model::instance().getILC();
+    ilc->readAll();
+    ilc->calculateHPPostion();
+    ilc->calculateHPMirrorForces();
+    ilc->calculateFAMirrorForces();
+    ilc->verifyResponses();
+}
+
+void forceActuatorData() {
+    Model::instance().getILC()->publishForceActuatorStatus();
+    ForceActuatorData::instance().send();
+}
+
+void hardpointData() {
+    auto ilc = Model::instance().getILC();
+    ilc->publishHardpointStatus();
+    ilc->publishHardpointData();
+    ilc->publishHardpointMonitorStatus();
+    ilc->publishHardpointMonitorData();
+}
+
+const StagePipeline::Stage outerLoopStages[] = {
+        {"FreezeSensors", &freezeSensors},
+        {"PullTelemetry", [] { IFPGA::get().pullTelemetry(); }},
+        {"Accelerometer", [] { Model::instance().getAccelerometer()->processData(); }},
+        {"DigitalIO", [] { DigitalInputOutput::instance().processData(); }},
+        {"Displacement", [] { Model::instance().getDisplacement()->processData(); }},
+        {"Gyro", [] { Model::instance().getGyro()->processData(); }},
+        {"Inclinometer", [] { Model::instance().getInclinometer()->processData(); }},
+        {"PowerController", [] { Model::instance().getPowerController()->processData(); }},
+        {"Heartbeat", [] { Heartbeat::instance().tryToggle(); }},
+        {"ApplyForces", &applyForces},
+        {"ControlList", &controlList},
+        {"WaitRealtime", &waitRealtime},
+        {"WaitConfiguration", &waitConfiguration},
+        {"ILCRead", &ilcRead},
+        {"ForceActuatorData", &forceActuatorData},
+        {"HardpointData", &hardpointData},
+        {"BoosterValves", [] { BoosterValveController::instance().checkTriggers(); }},
+        {"HardpointWarning", [] { HardpointActuatorWarning::instance().send(); }},
+        {"EnabledForceActuators", [] { M1M3SSPublisher::instance().getEnabledForceActuators()->log(); }},
+};
+
+static_assert(sizeof(outerLoopStages) / sizeof(outerLoopStages[0]) == OuterLoopPipeline::STAGE_COUNT,
+              "Outer loop stage table doesn't match OuterLoopPipeline::Stages");
+
+}  // namespace
+
+OuterLoopPipeline::OuterLoopPipeline(token) : StagePipeline(outerLoopStages), _reportInterval(0) {}
+
+void OuterLoopPipeline::setTimingReport(std::chrono::seconds interval) {
+    _reportInterval = interval;
+    _nextReport = std::chrono::steady_clock::now() + interval;
+    setTiming(interval.count() > 0);
+}
+
+void OuterLoopPipeline::run(uint32_t mask) {
+    StagePipeline::run(mask);
+    if (getTiming() == false) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (now >= _nextReport) {
+        _reportTiming();
+        resetTiming();
+        _nextReport = now + _reportInterval;
+    }
+}
+
+void OuterLoopPipeline::_reportTiming() {
+    using ms = std::chrono::duration<double, std::milli>;
+    for (size_t stage = 0; stage < size(); stage++) {
+        const Timing& timing = getTiming(stage);
+        if (timing.runs == 0) {
+            continue;
+        }
+        SPDLOG_INFO("Outer loop stage {}: {} runs, average {:.3f} ms, maximum {:.3f} ms", getName(stage),
+                    timing.runs, ms(timing.total).count() / timing.runs, ms(timing.max).count());
+    }
+}
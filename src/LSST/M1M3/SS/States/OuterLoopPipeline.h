@@ -0,0 +1,124 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef OUTERLOOPPIPELINE_H_
+#define OUTERLOOPPIPELINE_H_
+
+#include <chrono>
+
+#include <cRIO/Singleton.h>
+
+#include <StagePipeline.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Outer loop cycle - telemetry acquisition, sensor processing, ILC
+ * transaction and data publishing - described as an ordered set of stages.
+ * States run the pipeline with their stage mask, so the stages run in every
+ * state can be seen (and trimmed) in a single place.
+ *
+ * Timing of individual stages is enabled with OuterLoopSettings
+ * StageTimingReportInterval. Stage timing statistics are then logged in that
+ * interval.
+ */
+class OuterLoopPipeline : public StagePipeline, public cRIO::Singleton<OuterLoopPipeline> {
+public:
+    OuterLoopPipeline(token);
+
+    /**
+     * Enables or disables stages timing.
+     *
+     * @param interval interval between timing reports. Zero disables stages
+     * timing
+     */
+    void setTimingReport(std::chrono::seconds interval);
+
+    /**
+     * Runs enabled stages. Logs and resets stages timing statistics when
+     * timing report is due.
+     *
+     * @param mask enabled stages, stage index bits
+     */
+    void run(uint32_t mask);
+
+    /**
+     * Stages, in execution order.
+     */
+    enum Stages {
+        FREEZE_SENSORS = 0,  // write freeze sensor ILC list, trigger Modbus
+        PULL_TELEMETRY,
+        ACCELEROMETER,
+        DIGITAL_IO,
+        DISPLACEMENT,
+        GYRO,
+        INCLINOMETER,
+        POWER_CONTROLLER,
+        HEARTBEAT,
+        APPLY_FORCES,         // calculate and process applied forces
+        CONTROL_LIST,         // write control ILC list, trigger Modbus
+        WAIT_REALTIME,        // wait for Modbus with realtime timeouts
+        WAIT_CONFIGURATION,   // wait for Modbus with configuration timeouts
+        ILC_READ,             // read ILC responses, calculate mirror forces and positions
+        FORCE_ACTUATOR_DATA,  // publish force actuator status and data
+        HARDPOINT_DATA,       // publish hardpoint and hardpoint monitor status and data
+        BOOSTER_VALVES,
+        HARDPOINT_WARNING,
+        ENABLED_FORCE_ACTUATORS,
+        STAGE_COUNT
+    };
+
+    //* sensor processing common to all states
+    static constexpr uint32_t SENSORS = bit(PULL_TELEMETRY) | bit(ACCELEROMETER) | bit(DIGITAL_IO) |
+                                        bit(DISPLACEMENT) | bit(GYRO) | bit(INCLINOMETER) |
+                                        bit(POWER_CONTROLLER) | bit(HEARTBEAT);
+
+    //* ILC response processing and telemetry common to all states
+    static constexpr uint32_t TELEMETRY = bit(ILC_READ) | bit(FORCE_ACTUATOR_DATA) | bit(HARDPOINT_DATA);
+
+    //* stages run in DisabledState
+    static constexpr uint32_t DISABLED = bit(FREEZE_SENSORS) | SENSORS | bit(WAIT_CONFIGURATION) |
+                                         TELEMETRY | bit(HARDPOINT_WARNING);
+
+    //* stages run in FaultState
+    static constexpr uint32_t FAULT = bit(FREEZE_SENSORS) | SENSORS | bit(WAIT_CONFIGURATION) | TELEMETRY;
+
+    //* stages run in all enabled sub-states
+    static constexpr uint32_t ENABLED = SENSORS | bit(APPLY_FORCES) | bit(CONTROL_LIST) |
+                                        bit(WAIT_REALTIME) | TELEMETRY | bit(BOOSTER_VALVES) |
+                                        bit(HARDPOINT_WARNING) | bit(ENABLED_FORCE_ACTUATORS);
+
+private:
+    void _reportTiming();
+
+    std::chrono::seconds _reportInterval;
+    std::chrono::steady_clock::time_point _nextReport;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !OUTERLOOPPIPELINE_H_
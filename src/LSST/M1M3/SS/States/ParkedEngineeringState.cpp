@@ -101,6 +101,16 @@ States::Type ParkedEngineeringState::disable(DisableCommand* command) {
 States::Type ParkedEngineeringState::forceActuatorBumpTest(ForceActuatorBumpTestCommand* command) {
     SPDLOG_INFO("ParkedEngineeringState: forceActuatorBumpTest({}, {}, {})", command->getData()->actuatorId,
                 command->getData()->testPrimary, command->getData()->testSecondary);
+    if (command->mirror) {
+        auto bump_test_controller = Model::instance().getBumpTestController();
+        float duration = bump_test_controller->planMirrorBumpTest(command->getData()->testPrimary,
+                                                                  command->getData()->testSecondary);
+        auto& scheduler = bump_test_controller->getScheduler();
+        auto description = fmt::format("Planned {} tests, up to {} in parallel, expected duration {:.0f}s",
+                                       scheduler.get_plan().size(), scheduler.max_concurrency(), duration);
+        command->ackInProgress(description.c_str(), duration);
+        return Model::instance().getSafetyController()->checkSafety(States::NoStateTransition);
+    }
     Model::instance().getBumpTestController()->setBumpTestActuator(
             command->getData()->actuatorId, command->cylinders, command->getData()->testPrimary,
             command->getData()->testSecondary);
@@ -98,6 +98,8 @@ public:
     State(std::string name);
     virtual ~State();
 
+    const std::string& getName() const { return name; }
+
     /**
      * @brief Executes EnterControlCommand.
      *
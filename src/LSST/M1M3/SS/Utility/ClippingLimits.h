@@ -0,0 +1,142 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CLIPPINGLIMITS_H_
+#define CLIPPINGLIMITS_H_
+
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <spdlog/fmt/fmt.h>
+
+#include <cRIO/DataTypes.h>
+
+#include <Limit.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Fault limits stored as aligned low and high arrays, so values can be
+ * clipped in a single (vectorizable) pass. Clipping results are identical to
+ * Range::InRangeAndCoerce called for every value. Out of range values are
+ * reported as a bitmask.
+ *
+ * @tparam N number of values
+ * @tparam T value type
+ */
+template <size_t N, typename T = float>
+class ClippingLimits {
+public:
+    /**
+     * Constructs limits that don't clip any value.
+     */
+    ClippingLimits() {
+        for (size_t i = 0; i < N; i++) {
+            _low[i] = std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                           : std::numeric_limits<T>::lowest();
+            _high[i] = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                            : std::numeric_limits<T>::max();
+        }
+    }
+
+    /**
+     * Sets limits from limit table. Uses LowFault and HighFault columns,
+     * converted to T.
+     *
+     * @param table limit table
+     *
+     * @throw std::runtime_error if table has less than N rows
+     */
+    void set(const std::vector<Limit>& table) {
+        if (table.size() < N) {
+            throw std::runtime_error(
+                    fmt::format("Limit table has {} rows, at least {} expected", table.size(), N));
+        }
+        for (size_t i = 0; i < N; i++) {
+            _low[i] = static_cast<T>(table[i].LowFault);
+            _high[i] = static_cast<T>(table[i].HighFault);
+        }
+    }
+
+    T low(size_t index) const { return _low[index]; }
+    T high(size_t index) const { return _high[index]; }
+
+    /**
+     * Clips values into limits.
+     *
+     * @param values N values to clip
+     * @param output N clipped values. Cannot overlap with values
+     *
+     * @return mask of values out of limits (NaNs are out of limits)
+     */
+    std::bitset<N> clip(const T* values, T* output) const {
+        uint8_t outOfRange[N];
+        uint8_t any = 0;
+        for (size_t i = 0; i < N; i++) {
+            T value = values[i];
+            outOfRange[i] = !(value >= _low[i] && value <= _high[i]);
+            output[i] = (value < _low[i]) ? _low[i] : (value > _high[i]) ? _high[i] : value;
+            any |= outOfRange[i];
+        }
+
+        std::bitset<N> ret;
+        if (any) {
+            for (size_t i = 0; i < N; i++) {
+                ret[i] = outOfRange[i];
+            }
+        }
+        return ret;
+    }
+
+private:
+    alignas(64) T _low[N];
+    alignas(64) T _high[N];
+};
+
+/**
+ * Clipping limits of force actuator X, Y and Z forces.
+ */
+struct ForceClippingLimits {
+    ClippingLimits<FA_X_COUNT> x;
+    ClippingLimits<FA_Y_COUNT> y;
+    ClippingLimits<FA_Z_COUNT> z;
+
+    void set(const std::vector<Limit>& xTable, const std::vector<Limit>& yTable,
+             const std::vector<Limit>& zTable) {
+        x.set(xTable);
+        y.set(yTable);
+        z.set(zTable);
+    }
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* CLIPPINGLIMITS_H_ */
@@ -21,9 +21,11 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <thread>
 
 #include <SAL_MTM1M3.h>
 
@@ -39,48 +41,44 @@ using namespace LSST::M1M3::SS;
 
 BumpTestStatistics::BumpTestStatistics() { min = max = average = error_rms = NAN; }
 
-FABumpTestStatistics::FABumpTestStatistics() {}
+FABumpTestData::FABumpTestData(size_t capacity)
+        : _capacity(capacity),
+          _forces(CHANNEL_COUNT * capacity, 0),
+          _min_queue(CHANNEL_COUNT * capacity, 0),
+          _max_queue(CHANNEL_COUNT * capacity, 0),
+          _size(0),
+          _sequence(0) {
+    for (int fa = 0; fa < FA_COUNT; fa++) {
+        for (int t = 0; t < TEST_TYPE_COUNT; t++) {
+            _statistics_sequence[fa][t] = UINT64_MAX;
+        }
+    }
+    clear();
+}
 
-void FABumpTestStatistics::clear() { statistics.clear(); }
+FABumpTestData::~FABumpTestData() {}
 
-FABumpTestData::FABumpTestData(size_t capacity) {
-    _head = 0;
-    _filled = false;
-    _capacity = capacity;
-
-    for (size_t c = 0; c < FA_COUNT; c++) {
-        if (c < FA_X_COUNT) {
-            _x_forces[c] = new float[_capacity];
-        }
-        if (c < FA_Y_COUNT) {
-            _y_forces[c] = new float[_capacity];
-        }
-        _z_forces[c] = new float[_capacity];
+void FABumpTestData::_begin_write() {
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
 
-        _primary_forces[c] = new float[_capacity];
-        _primary_states[c] = new int[_capacity];
-        if (c < FA_S_COUNT) {
-            _secondary_forces[c] = new float[_capacity];
-            _secondary_states[c] = new int[_capacity];
-        }
-    }
+void FABumpTestData::_end_write() {
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
 }
 
-FABumpTestData::~FABumpTestData() {
-    for (size_t c = 0; c < FA_COUNT; c++) {
-        if (c < FA_X_COUNT) {
-            delete[] _x_forces[c];
-        }
-        if (c < FA_Y_COUNT) {
-            delete[] _y_forces[c];
+template <typename R>
+auto FABumpTestData::_read(R reader) -> decltype(reader(uint64_t(0))) {
+    while (true) {
+        uint64_t sequence = _sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            std::this_thread::yield();
+            continue;
         }
-        delete[] _z_forces[c];
-
-        delete[] _primary_forces[c];
-        delete[] _primary_states[c];
-        if (c < FA_S_COUNT) {
-            delete[] _secondary_forces[c];
-            delete[] _secondary_states[c];
+        auto ret = reader(sequence);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_sequence.load(std::memory_order_relaxed) == sequence) {
+            return ret;
         }
     }
 }
@@ -90,46 +88,85 @@ void FABumpTestData::add_data(const float_v& x_forces, const float_v& y_forces,
                               const int_v& primary_states, const int_v& secondary_states) {
     std::lock_guard<std::mutex> lock(_g_mutex);
 
-    for (size_t c = 0; c < FA_COUNT; c++) {
+    _begin_write();
+
+    for (int c = 0; c < FA_COUNT; c++) {
         if (c < FA_X_COUNT) {
-            _x_forces[c][_head] = x_forces[c];
+            _push(X_CHANNEL + c, x_forces[c]);
         }
         if (c < FA_Y_COUNT) {
-            _y_forces[c][_head] = y_forces[c];
+            _push(Y_CHANNEL + c, y_forces[c]);
         }
-        _z_forces[c][_head] = z_forces[c];
-
-        _primary_forces[c][_head] = primary_forces[c];
-        _primary_states[c][_head] = primary_states[c];
+        _push(Z_CHANNEL + c, z_forces[c]);
+        _push(PRIMARY_CHANNEL + c, primary_forces[c]);
         if (c < FA_S_COUNT) {
-            _secondary_forces[c][_head] = secondary_forces[c];
-            _secondary_states[c][_head] = secondary_states[c];
+            _push(SECONDARY_CHANNEL + c, secondary_forces[c]);
         }
-        fa_statistics[c].clear();
     }
+
+    for (int c = 0; c < FA_COUNT + FA_S_COUNT; c++) {
+        int state = c < FA_COUNT ? primary_states[c] : secondary_states[c - FA_COUNT];
+        size_t run = _state_run[c].load(std::memory_order_relaxed);
+        if (run > 0 && _last_state[c].load(std::memory_order_relaxed) == state) {
+            if (run < _capacity) {
+                _state_run[c].store(run + 1, std::memory_order_relaxed);
+            }
+        } else {
+            _last_state[c].store(state, std::memory_order_relaxed);
+            _state_run[c].store(1, std::memory_order_relaxed);
+        }
+    }
+
+    _samples++;
     _head = (_head + 1) % _capacity;
     if (_head == 0) {
         _filled = true;
     }
+    _size.store(_filled ? _capacity : _head, std::memory_order_relaxed);
+
+    // remove rounding errors of sums of one channel, so all channels are
+    // rebased once per CHANNEL_COUNT samples
+    _rebase(_samples % CHANNEL_COUNT);
+
+    _end_write();
 }
 
 void FABumpTestData::clear() {
+    std::lock_guard<std::mutex> lock(_g_mutex);
+
+    _begin_write();
+
+    _samples = 0;
     _head = 0;
     _filled = false;
-    for (int i = 0; i < FA_COUNT; i++) {
-        fa_statistics[i].clear();
+    _size.store(0, std::memory_order_relaxed);
+    for (int c = 0; c < CHANNEL_COUNT; c++) {
+        _channels[c] = ChannelQueues{0, 0, 0, 0};
+        _summary[c].min.store(NAN, std::memory_order_relaxed);
+        _summary[c].max.store(NAN, std::memory_order_relaxed);
+        _summary[c].sum.store(0, std::memory_order_relaxed);
+        _summary[c].sum_sq.store(0, std::memory_order_relaxed);
     }
-}
-
-size_t FABumpTestData::size() const {
-    if (_filled) {
-        return _capacity;
+    for (int c = 0; c < FA_COUNT + FA_S_COUNT; c++) {
+        _last_state[c].store(0, std::memory_order_relaxed);
+        _state_run[c].store(0, std::memory_order_relaxed);
     }
-    return _head;
+
+    _end_write();
 }
 
+size_t FABumpTestData::size() const { return _size.load(std::memory_order_acquire); }
+
 BumpTestStatus FABumpTestData::test_actuator(int z_index, int test_type) {
-    if (size() != _capacity) {
+    std::lock_guard<std::mutex> lock(_reader_mutex);
+
+    return _read([this, z_index, test_type](uint64_t sequence) {
+        return _test_actuator(sequence, z_index, test_type);
+    });
+}
+
+BumpTestStatus FABumpTestData::_test_actuator(uint64_t sequence, int z_index, int test_type) {
+    if (_size.load(std::memory_order_relaxed) != _capacity) {
         return BumpTestStatus::NO_DATA;
     }
 
@@ -139,19 +176,11 @@ BumpTestStatus FABumpTestData::test_actuator(int z_index, int test_type) {
     auto s_index = faa_settings.ZIndexToSecondaryCylinderIndex[z_index];
 
     // make sure the actuator state remain the same throughout testing period
-    auto p_states = _primary_states[z_index][0];
-    for (size_t i = 0; i < _capacity; i++) {
-        if (_primary_states[z_index][i] != p_states) {
-            return BumpTestStatus::WRONG_STATE_HISTORY;
-        }
+    if (_state_run[z_index].load(std::memory_order_relaxed) < _capacity) {
+        return BumpTestStatus::WRONG_STATE_HISTORY;
     }
-    if (s_index != -1) {
-        auto s_states = _secondary_states[s_index][0];
-        for (size_t i = 0; i < _capacity; i++) {
-            if (_secondary_states[s_index][i] != s_states) {
-                return BumpTestStatus::WRONG_STATE_HISTORY;
-            }
-        }
+    if (s_index != -1 && _state_run[FA_COUNT + s_index].load(std::memory_order_relaxed) < _capacity) {
+        return BumpTestStatus::WRONG_STATE_HISTORY;
     }
 
     auto& fa_settings = ForceActuatorSettings::instance();
@@ -160,13 +189,14 @@ BumpTestStatus FABumpTestData::test_actuator(int z_index, int test_type) {
     float warning = fa_settings.bumpTestTestedWarning;
 
     // use NonTested if FA is not being tested
-    if (_primary_states[z_index][_head] == MTM1M3::MTM1M3_shared_BumpTest_NotTested &&
-        (s_index == -1 || _secondary_states[s_index][_head] == MTM1M3::MTM1M3_shared_BumpTest_NotTested)) {
+    if (_last_state[z_index].load(std::memory_order_relaxed) == MTM1M3::MTM1M3_shared_BumpTest_NotTested &&
+        (s_index == -1 || _last_state[FA_COUNT + s_index].load(std::memory_order_relaxed) ==
+                                  MTM1M3::MTM1M3_shared_BumpTest_NotTested)) {
         error = fa_settings.bumpTestNonTestedError;
         warning = fa_settings.bumpTestNonTestedWarning;
     }
 
-    return _test_rms(x_index, y_index, z_index, s_index, test_type, error, warning);
+    return _test_rms(sequence, x_index, y_index, z_index, s_index, test_type, error, warning);
     // return _test_min_max(x_index, y_index, z_index, s_index, kind, error, warning);
 }
 
@@ -177,76 +207,40 @@ void FABumpTestData::test_mirror(int test_type, BumpTestStatus (&results)[FA_COU
 }
 
 float* FABumpTestData::get_data(int axis_index, int test_type) {
-    switch (test_type) {
-        case MTM1M3::MTM1M3_shared_BumpTestType_X:
-            return _x_forces[axis_index];
-        case MTM1M3::MTM1M3_shared_BumpTestType_Y:
-            return _y_forces[axis_index];
-        case MTM1M3::MTM1M3_shared_BumpTestType_Z:
-            return _z_forces[axis_index];
-        case MTM1M3::MTM1M3_shared_BumpTestType_Primary:
-            return _primary_forces[axis_index];
-        case MTM1M3::MTM1M3_shared_BumpTestType_Secondary:
-            return _secondary_forces[axis_index];
-        default:
-            throw std::runtime_error(fmt::format("Invalid test type {}", test_type));
-    };
+    return _forces.data() + _channel(axis_index, test_type) * _capacity;
 }
 
 BumpTestStatistics FABumpTestData::statistics(int fa_index, int axis_index, int test_type,
                                               float rms_baseline) {
-    auto it = fa_statistics[fa_index].statistics.find(test_type);
-    if (it != fa_statistics[fa_index].statistics.end()) {
-        return it->second;
-    }
-
-    BumpTestStatistics stat;
-
-    float* data = get_data(axis_index, test_type);
-
-    if (empty() == true) {
-        throw std::runtime_error("Cannot compute statistics of empty data.");
-    }
-
-    if (isnan(rms_baseline)) {
-        rms_baseline = get_expected_force(axis_index, test_type);
-    }
-
-    size_t end = _filled ? _capacity : _head;
-
-    size_t i = 0;
-
-    stat.min = stat.max = stat.average = data[i];
-
-    float v_b = data[i] - rms_baseline;
-    stat.error_rms = v_b * v_b;
-
-    for (i = 1; i < end; i++) {
-        float v = data[i];
-        if (v < stat.min) {
-            stat.min = v;
-        }
-        if (v > stat.max) {
-            stat.max = v;
+    std::lock_guard<std::mutex> lock(_reader_mutex);
+
+    // throw only after read is validated, so data cleared during the read don't cause spurious failure
+    bool no_data = false;
+    BumpTestStatistics stat = _read([&](uint64_t sequence) {
+        no_data = _size.load(std::memory_order_relaxed) == 0;
+        if (no_data) {
+            return BumpTestStatistics();
         }
-        stat.average += v;
-
-        v_b = (v - rms_baseline);
-        stat.error_rms += v_b * v_b;
+        return _statistics(sequence, fa_index, axis_index, test_type, rms_baseline);
+    });
+    if (no_data) {
+        throw std::runtime_error("Cannot compute statistics of empty data.");
     }
-
-    stat.average /= i;
-
-    stat.error_rms = sqrt(stat.error_rms / i);
-    stat.rms_baseline = rms_baseline;
-
-    fa_statistics[fa_index].statistics[test_type] = stat;
-
     return stat;
 }
 
 BumpTestStatistics FABumpTestData::cached_statistics(int fa_index, int test_type) {
-    return fa_statistics[fa_index].statistics.at(test_type);
+    std::lock_guard<std::mutex> lock(_reader_mutex);
+    int slot = _test_type_slot(test_type);
+    uint64_t sequence;
+    while ((sequence = _sequence.load(std::memory_order_acquire)) & 1) {
+        std::this_thread::yield();
+    }
+    if (_statistics_sequence[fa_index][slot] != sequence) {
+        throw std::out_of_range(
+                fmt::format("Statistics for FA index {} test type {} aren't cached", fa_index, test_type));
+    }
+    return _statistics_cache[fa_index][slot];
 }
 
 BumpTestStatus in_range(float force, float expected_force, float error, float warning) {
@@ -292,8 +286,8 @@ float FABumpTestData::get_expected_force(int axis_index, int test_type) {
     return 0;
 }
 
-BumpTestStatus FABumpTestData::_test_rms(int x_index, int y_index, int z_index, int s_index, int test_type,
-                                         float error, float warning) {
+BumpTestStatus FABumpTestData::_test_rms(uint64_t sequence, int x_index, int y_index, int z_index,
+                                         int s_index, int test_type, float error, float warning) {
     BumpTestStatistics stat;
 
     BumpTestStatus* p_state = _primary_results + z_index;
@@ -307,31 +301,31 @@ BumpTestStatus FABumpTestData::_test_rms(int x_index, int y_index, int z_index,
 
     switch (test_type) {
         case MTM1M3::MTM1M3_shared_BumpTestType_Primary:
-            stat = statistics(z_index, z_index, MTM1M3::MTM1M3_shared_BumpTestType_Primary);
+            stat = _statistics(sequence, z_index, z_index, MTM1M3::MTM1M3_shared_BumpTestType_Primary);
             *p_state = in_rms(stat.error_rms, error, warning);
         case MTM1M3::MTM1M3_shared_BumpTestType_Z:
-            stat = statistics(z_index, z_index, MTM1M3::MTM1M3_shared_BumpTestType_Z);
+            stat = _statistics(sequence, z_index, z_index, MTM1M3::MTM1M3_shared_BumpTestType_Z);
             *p_state = in_rms(stat.error_rms, error, warning);
             break;
         case MTM1M3::MTM1M3_shared_BumpTestType_Secondary:
             if (s_index == -1) {
                 return BumpTestStatus::INVALID_ACTUATOR;
             }
-            stat = statistics(z_index, s_index, MTM1M3::MTM1M3_shared_BumpTestType_Secondary);
+            stat = _statistics(sequence, z_index, s_index, MTM1M3::MTM1M3_shared_BumpTestType_Secondary);
             *s_state = in_rms(stat.error_rms, error, warning);
             break;
         case MTM1M3::MTM1M3_shared_BumpTestType_X:
             if (x_index == -1) {
                 return BumpTestStatus::INVALID_ACTUATOR;
             }
-            stat = statistics(z_index, x_index, MTM1M3::MTM1M3_shared_BumpTestType_X);
+            stat = _statistics(sequence, z_index, x_index, MTM1M3::MTM1M3_shared_BumpTestType_X);
             *s_state = in_rms(stat.error_rms, error, warning);
             break;
         case MTM1M3::MTM1M3_shared_BumpTestType_Y:
             if (y_index == -1) {
                 return BumpTestStatus::INVALID_ACTUATOR;
             }
-            stat = statistics(z_index, y_index, MTM1M3::MTM1M3_shared_BumpTestType_Y);
+            stat = _statistics(sequence, z_index, y_index, MTM1M3::MTM1M3_shared_BumpTestType_Y);
             *s_state = in_rms(stat.error_rms, error, warning);
             break;
         default:
@@ -359,47 +353,54 @@ BumpTestStatus FABumpTestData::_test_min_max(int x_index, int y_index, int z_ind
         *s_state = BumpTestStatus::PASSED;
     }
 
+    const float* x_forces = x_index == -1 ? NULL : get_data(x_index, MTM1M3::MTM1M3_shared_BumpTestType_X);
+    const float* y_forces = y_index == -1 ? NULL : get_data(y_index, MTM1M3::MTM1M3_shared_BumpTestType_Y);
+    const float* z_forces = get_data(z_index, MTM1M3::MTM1M3_shared_BumpTestType_Z);
+    const float* primary_forces = get_data(z_index, MTM1M3::MTM1M3_shared_BumpTestType_Primary);
+    const float* secondary_forces =
+            s_index == -1 ? NULL : get_data(s_index, MTM1M3::MTM1M3_shared_BumpTestType_Secondary);
+
     for (size_t i = 0; i < _capacity; i++) {
         switch (test_type) {
             case MTM1M3::MTM1M3_shared_BumpTestType_Primary:
-                *p_state = in_range(_primary_forces[z_index][i], get_expected_force(z_index, test_type),
+                *p_state = in_range(primary_forces[i], get_expected_force(z_index, test_type),
                                     error, warning);
                 if (s_state != NULL) {
-                    *s_state = in_range(_secondary_forces[z_index][i], 0, error, warning);
+                    *s_state = in_range(secondary_forces[i], 0, error, warning);
                 }
                 break;
             case MTM1M3::MTM1M3_shared_BumpTestType_Secondary:
                 if (s_index == -1) {
                     return BumpTestStatus::INVALID_ACTUATOR;
                 }
-                *p_state = in_range(_primary_forces[z_index][i], 0, error, warning);
-                *s_state = in_range(_secondary_forces[s_index][i], get_expected_force(s_index, test_type),
+                *p_state = in_range(primary_forces[i], 0, error, warning);
+                *s_state = in_range(secondary_forces[i], get_expected_force(s_index, test_type),
                                     error, warning);
                 break;
             case MTM1M3::MTM1M3_shared_BumpTestType_X:
                 if (x_index == -1) {
                     return BumpTestStatus::INVALID_ACTUATOR;
                 }
-                *s_state = in_range(_x_forces[x_index][i], get_expected_force(x_index, test_type), error,
+                *s_state = in_range(x_forces[i], get_expected_force(x_index, test_type), error,
                                     warning);
-                *p_state = in_range(_z_forces[z_index][i], 0, error, warning);
+                *p_state = in_range(z_forces[i], 0, error, warning);
                 break;
             case MTM1M3::MTM1M3_shared_BumpTestType_Y:
                 if (y_index == -1) {
                     return BumpTestStatus::INVALID_ACTUATOR;
                 }
-                *s_state = in_range(_y_forces[y_index][i], get_expected_force(y_index, test_type), error,
+                *s_state = in_range(y_forces[i], get_expected_force(y_index, test_type), error,
                                     warning);
-                *p_state = in_range(_z_forces[z_index][i], 0, error, warning);
+                *p_state = in_range(z_forces[i], 0, error, warning);
                 break;
             case MTM1M3::MTM1M3_shared_BumpTestType_Z:
-                *p_state = in_range(_z_forces[z_index][i], get_expected_force(z_index, test_type), error,
+                *p_state = in_range(z_forces[i], get_expected_force(z_index, test_type), error,
                                     warning);
 
                 if (x_index != -1) {
-                    *s_state = in_range(_x_forces[x_index][i], 0, error, warning);
+                    *s_state = in_range(x_forces[i], 0, error, warning);
                 } else if (y_index != -1) {
-                    *s_state = in_range(_y_forces[y_index][i], 0, error, warning);
+                    *s_state = in_range(y_forces[i], 0, error, warning);
                 }
                 break;
             default:
@@ -415,3 +416,141 @@ BumpTestStatus FABumpTestData::_test_min_max(int x_index, int y_index, int z_ind
 
     return BumpTestStatus::PASSED;
 }
+
+BumpTestStatistics FABumpTestData::_statistics(uint64_t sequence, int fa_index, int axis_index,
+                                               int test_type, float rms_baseline) {
+    int slot = _test_type_slot(test_type);
+    int channel = _channel(axis_index, test_type);
+
+    if (_statistics_sequence[fa_index][slot] == sequence) {
+        return _statistics_cache[fa_index][slot];
+    }
+
+    if (isnan(rms_baseline)) {
+        rms_baseline = get_expected_force(axis_index, test_type);
+    }
+
+    const ChannelSummary& summary = _summary[channel];
+    double n = _size.load(std::memory_order_relaxed);
+    double sum = summary.sum.load(std::memory_order_relaxed);
+    double sum_sq = summary.sum_sq.load(std::memory_order_relaxed);
+
+    BumpTestStatistics stat;
+
+    stat.min = summary.min.load(std::memory_order_relaxed);
+    stat.max = summary.max.load(std::memory_order_relaxed);
+    double average = sum / n;
+    stat.average = average;
+
+    // mean of (v - baseline)^2 expanded into running sums
+    double error_sq = sum_sq / n - 2.0 * rms_baseline * average + double(rms_baseline) * rms_baseline;
+    stat.error_rms = sqrt(std::max(error_sq, 0.0));
+    stat.rms_baseline = rms_baseline;
+
+    _statistics_cache[fa_index][slot] = stat;
+    _statistics_sequence[fa_index][slot] = sequence;
+
+    return stat;
+}
+
+int FABumpTestData::_channel(int axis_index, int test_type) {
+    switch (test_type) {
+        case MTM1M3::MTM1M3_shared_BumpTestType_X:
+            return X_CHANNEL + axis_index;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Y:
+            return Y_CHANNEL + axis_index;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Z:
+            return Z_CHANNEL + axis_index;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Primary:
+            return PRIMARY_CHANNEL + axis_index;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Secondary:
+            return SECONDARY_CHANNEL + axis_index;
+        default:
+            throw std::runtime_error(fmt::format("Invalid test type {}", test_type));
+    };
+}
+
+int FABumpTestData::_test_type_slot(int test_type) {
+    switch (test_type) {
+        case MTM1M3::MTM1M3_shared_BumpTestType_Primary:
+            return 0;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Secondary:
+            return 1;
+        case MTM1M3::MTM1M3_shared_BumpTestType_X:
+            return 2;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Y:
+            return 3;
+        case MTM1M3::MTM1M3_shared_BumpTestType_Z:
+            return 4;
+        default:
+            throw std::runtime_error(fmt::format("Invalid test type {}", test_type));
+    };
+}
+
+void FABumpTestData::_push(int channel, float value) {
+    float* data = _forces.data() + channel * _capacity;
+    size_t* min_queue = _min_queue.data() + channel * _capacity;
+    size_t* max_queue = _max_queue.data() + channel * _capacity;
+    ChannelQueues& ch = _channels[channel];
+    ChannelSummary& summary = _summary[channel];
+
+    double sum = summary.sum.load(std::memory_order_relaxed);
+    double sum_sq = summary.sum_sq.load(std::memory_order_relaxed);
+    if (_samples >= _capacity) {
+        double old = data[_head];
+        sum -= old;
+        sum_sq -= old * old;
+    }
+    sum += value;
+    sum_sq += double(value) * value;
+    summary.sum.store(sum, std::memory_order_relaxed);
+    summary.sum_sq.store(sum_sq, std::memory_order_relaxed);
+
+    data[_head] = value;
+
+    // drop sample leaving the window from queues heads
+    if (_samples >= _capacity) {
+        size_t expired = _samples - _capacity;
+        if (ch.min_count > 0 && min_queue[ch.min_first] == expired) {
+            ch.min_first = (ch.min_first + 1) % _capacity;
+            ch.min_count--;
+        }
+        if (ch.max_count > 0 && max_queue[ch.max_first] == expired) {
+            ch.max_first = (ch.max_first + 1) % _capacity;
+            ch.max_count--;
+        }
+    }
+
+    // queues are kept monotonic - minimum increasing, maximum decreasing
+    while (ch.min_count > 0 &&
+           data[min_queue[(ch.min_first + ch.min_count - 1) % _capacity] % _capacity] >= value) {
+        ch.min_count--;
+    }
+    min_queue[(ch.min_first + ch.min_count) % _capacity] = _samples;
+    ch.min_count++;
+
+    while (ch.max_count > 0 &&
+           data[max_queue[(ch.max_first + ch.max_count - 1) % _capacity] % _capacity] <= value) {
+        ch.max_count--;
+    }
+    max_queue[(ch.max_first + ch.max_count) % _capacity] = _samples;
+    ch.max_count++;
+
+    summary.min.store(data[min_queue[ch.min_first] % _capacity], std::memory_order_relaxed);
+    summary.max.store(data[max_queue[ch.max_first] % _capacity], std::memory_order_relaxed);
+}
+
+void FABumpTestData::_rebase(int channel) {
+    const float* data = _forces.data() + channel * _capacity;
+    size_t end = _size.load(std::memory_order_relaxed);
+
+    double sum = 0;
+    double sum_sq = 0;
+    for (size_t i = 0; i < end; i++) {
+        sum += data[i];
+        sum_sq += double(data[i]) * data[i];
+    }
+
+    _summary[channel].sum.store(sum, std::memory_order_relaxed);
+    _summary[channel].sum_sq.store(sum_sq, std::memory_order_relaxed);
+}
@@ -24,12 +24,15 @@
 #ifndef FABUMPTESTDATA_H_
 #define FABUMPTESTDATA_H_
 
-#include <map>
+#include <atomic>
 #include <math.h>
 #include <mutex>
+#include <vector>
 
 #include <SAL_MTM1M3.h>
 
+#include <cRIO/DataTypes.h>
+
 namespace LSST {
 namespace M1M3 {
 namespace SS {
@@ -75,21 +78,6 @@ struct BumpTestStatistics {
     float rms_baseline;
 };
 
-/**
- * Collection of statistics entries. Organized as map of BumpTestStatistics,
- * where index is FA index (z_index).
- */
-struct FABumpTestStatistics {
-    FABumpTestStatistics();
-
-    std::map<int, BumpTestStatistics> statistics;
-
-    /**
-     * Clear all cached statistics.
-     */
-    void clear();
-};
-
 /**
  * Keep track of forces measured during force actuators bump tests. Provides
  * functions to check that force actuator tested fine. Data cache is organized
@@ -97,12 +85,25 @@ struct FABumpTestStatistics {
  * (where new data will be written) and _filled signals if the buffer is full
  * (so all values are valid values).
  *
+ * For every channel (X, Y, Z, primary and secondary force), monotonic queues
+ * holding window minimum and maximum, and running sum and sum of squares, are
+ * maintained as data are added, so statistics are available in O(1). Running
+ * sums are kept in double. To prevent rounding errors accumulating as samples
+ * leave the window, add_data recomputes sums of one channel from its buffer,
+ * so every channel is rebased once per CHANNEL_COUNT samples.
+ *
  * Apart from recording measures forces, also keep tracks of the force actuator
  * test state. This is needed for tests looking if the FA bunmp test state is
- * the same throughout the test period.
+ * the same throughout the test period. Only the last state and the number of
+ * consecutive samples with that state are needed for that.
  *
  * The two most important methods are add_data (to add new data) and statistics
- * (to compute/retrieve data statistics).
+ * (to compute/retrieve data statistics). Channel summaries (minimum, maximum
+ * and sums), states and size are published by writers (add_data and clear)
+ * under a sequence lock. Readers (statistics, test_actuator, test_mirror)
+ * never block writers - they retry if data were modified while being read.
+ * Readers are serialized among themselves, as they share statistics cache.
+ * get_data returns pointer into the raw buffer without any synchronization.
  */
 class FABumpTestData {
 public:
@@ -136,7 +137,7 @@ public:
      *
      * @return true if no data were entered into array.
      */
-    bool empty() const { return _head == 0 && _filled == false; }
+    bool empty() const { return size() == 0; }
 
     /**
      * Returns size of archived data points.
@@ -163,6 +164,16 @@ public:
      */
     void test_mirror(int test_type, BumpTestStatus (&results)[FA_COUNT]);
 
+    /**
+     * Returns pointer to circular buffer with the channel data. Buffer has
+     * capacity elements, and is indexed in the same way as the whole cache
+     * (so _head points to the oldest data once buffer is filled).
+     *
+     * @param axis_index Axis index (X, Y, Z, primary or secondary index).
+     * @param test_type Test type (see MTM1M3_shared_BumpTestType_*).
+     *
+     * @return pointer to the channel data
+     */
     float* get_data(int axis_index, int test_type);
 
     static bool is_primary(int test_type) {
@@ -199,36 +210,132 @@ public:
      */
     BumpTestStatistics cached_statistics(int fa_index, int test_type);
 
-    FABumpTestStatistics fa_statistics[FA_COUNT];
-
 private:
-    BumpTestStatus _test_rms(int x_index, int y_index, int z_index, int s_index, int test_type, float error,
-                             float warning);
+    BumpTestStatus _test_rms(uint64_t sequence, int x_index, int y_index, int z_index, int s_index,
+                             int test_type, float error, float warning);
     BumpTestStatus _test_min_max(int x_index, int y_index, int z_index, int s_index, int test_type,
                                  float error, float warning);
 
-    float* _x_forces[FA_X_COUNT];
-    float* _y_forces[FA_Y_COUNT];
-    float* _z_forces[FA_Z_COUNT];
+    // offsets of the axis data in channel storage
+    static constexpr int X_CHANNEL = 0;
+    static constexpr int Y_CHANNEL = X_CHANNEL + FA_X_COUNT;
+    static constexpr int Z_CHANNEL = Y_CHANNEL + FA_Y_COUNT;
+    static constexpr int PRIMARY_CHANNEL = Z_CHANNEL + FA_Z_COUNT;
+    static constexpr int SECONDARY_CHANNEL = PRIMARY_CHANNEL + FA_COUNT;
+    static constexpr int CHANNEL_COUNT = SECONDARY_CHANNEL + FA_S_COUNT;
+
+    // number of test types - Primary, Secondary, X, Y and Z
+    static constexpr int TEST_TYPE_COUNT = 5;
+
+    /**
+     * Positions of min/max queues for a single channel.
+     */
+    struct ChannelQueues {
+        // first element and number of elements in minimum and maximum monotonic queues
+        size_t min_first;
+        size_t min_count;
+        size_t max_first;
+        size_t max_count;
+    };
+
+    /**
+     * Channel summary published to readers.
+     */
+    struct ChannelSummary {
+        std::atomic<float> min;
+        std::atomic<float> max;
+        std::atomic<double> sum;
+        std::atomic<double> sum_sq;
+    };
+
+    /**
+     * Returns channel index for given axis index and test type. Throws
+     * std::runtime_error on invalid test type.
+     */
+    static int _channel(int axis_index, int test_type);
+
+    /**
+     * Returns index of the test type into statistics cache.
+     */
+    static int _test_type_slot(int test_type);
+
+    /**
+     * Starts data modification. Caller must hold _g_mutex.
+     */
+    void _begin_write();
+
+    /**
+     * Publishes modified data.
+     */
+    void _end_write();
+
+    /**
+     * Calls reader until it reads data which weren't modified during the
+     * call.
+     *
+     * @param reader called with sequence number of the data
+     *
+     * @return value returned by the reader
+     */
+    template <typename R>
+    auto _read(R reader) -> decltype(reader(uint64_t(0)));
+
+    /**
+     * Computes statistics or retrieves them from cache. Caller must hold
+     * _reader_mutex, and validate sequence after the call.
+     */
+    BumpTestStatistics _statistics(uint64_t sequence, int fa_index, int axis_index, int test_type,
+                                   float rms_baseline = NAN);
 
-    float* _primary_forces[FA_COUNT];
-    float* _secondary_forces[FA_S_COUNT];
+    BumpTestStatus _test_actuator(uint64_t sequence, int z_index, int test_type);
 
-    int* _primary_states[FA_COUNT];
-    int* _secondary_states[FA_S_COUNT];
+    void _push(int channel, float value);
 
+    /**
+     * Recomputes channel running sums from the channel buffer.
+     */
+    void _rebase(int channel);
+
+    size_t _capacity;
+
+    // channels circular buffers, CHANNEL_COUNT * _capacity
+    std::vector<float> _forces;
+    ChannelQueues _channels[CHANNEL_COUNT];
+    // monotonic queues with sample sequence numbers, CHANNEL_COUNT * _capacity
+    std::vector<size_t> _min_queue;
+    std::vector<size_t> _max_queue;
+    ChannelSummary _summary[CHANNEL_COUNT];
+
+    // last states, indexed by z_index, followed by secondary states
+    std::atomic<int> _last_state[FA_COUNT + FA_S_COUNT];
+    // number of consecutive samples with the last state, capped at _capacity
+    std::atomic<size_t> _state_run[FA_COUNT + FA_S_COUNT];
+
+    // number of samples added since clear
+    size_t _samples;
     // circular buffer indice
     size_t _head;
     // when true, the buffer is full. New members are added to _head position,
     // all elements contains valid data
     bool _filled;
-    size_t _capacity;
+    // number of valid samples, published to readers
+    std::atomic<size_t> _size;
+
+    // statistics cache. Entry is valid when its sequence matches _sequence
+    BumpTestStatistics _statistics_cache[FA_COUNT][TEST_TYPE_COUNT];
+    uint64_t _statistics_sequence[FA_COUNT][TEST_TYPE_COUNT];
 
     // current test result
     BumpTestStatus _primary_results[FA_COUNT];
     BumpTestStatus _secondary_results[FA_S_COUNT];
 
+    // sequence lock. Odd while data are being modified, incremented by 2 on every modification
+    std::atomic<uint64_t> _sequence;
+
+    // serializes writers
     std::mutex _g_mutex;
+    // serializes readers - protects statistics cache and test results
+    std::mutex _reader_mutex;
 };
 
 }  // namespace SS
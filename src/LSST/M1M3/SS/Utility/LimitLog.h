@@ -25,57 +25,59 @@
 #define LIMITLOG_H_
 
 #include <chrono>
-#include <vector>
+
+// Time guarded log macros. Each macro keeps (static) time when the message
+// can be logged again - the steady clock epoch, used for initialization, is
+// always in the past. Checking a throttled message costs a clock read and a
+// single comparison, and the log arguments are evaluated and formatted only
+// when the message is logged. No memory is allocated.
+
+#define TG_LOG_IMPL(tg, next_allowed, log)              \
+    {                                                   \
+        auto tg_now = std::chrono::steady_clock::now(); \
+        if (tg_now >= next_allowed) {                   \
+            log;                                        \
+            next_allowed = tg_now + tg;                 \
+        }                                               \
+    }
 
 /**
- * Defines time guard error log with counter. Log error every tg seconds.
+ * Defines time guard error log. Log error every tg seconds.
  *
  * @param tg time guard, chrono literal how often logging shall be done
  * @param ... __VA_ARGS__ passed to SPDLOG_ERROR
  */
-#define TG_LOG_ERROR(tg, ...)                                                                                \
-    {                                                                                                        \
-        static auto last_executed =                                                                          \
-                std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::seconds>(tg * 2); \
-        if ((std::chrono::steady_clock::now() - last_executed) > tg) {                                       \
-            SPDLOG_ERROR(__VA_ARGS__);                                                                       \
-            last_executed = std::chrono::steady_clock::now();                                                \
-        }                                                                                                    \
+#define TG_LOG_ERROR(tg, ...)                                      \
+    {                                                              \
+        static std::chrono::steady_clock::time_point next_allowed; \
+        TG_LOG_IMPL(tg, next_allowed, SPDLOG_ERROR(__VA_ARGS__));  \
     }
 
 /**
- * Defines time guard warning log with counter. Log warning every tg seconds.
+ * Defines time guard warning log. Log warning every tg seconds.
  *
  * @param tg time guard, chrono literal how often logging shall be done
- * @param ... __VA_ARGS__ passed to SPDLOG_ERROR
+ * @param ... __VA_ARGS__ passed to SPDLOG_WARN
  */
-#define TG_LOG_WARN(tg, ...)                                                                                 \
-    {                                                                                                        \
-        static auto last_executed =                                                                          \
-                std::chrono::steady_clock::now() - std::chrono::duration_cast<std::chrono::seconds>(tg * 2); \
-        if ((std::chrono::steady_clock::now() - last_executed) > tg) {                                       \
-            SPDLOG_WARN(__VA_ARGS__);                                                                        \
-            last_executed = std::chrono::steady_clock::now();                                                \
-        }                                                                                                    \
+#define TG_LOG_WARN(tg, ...)                                       \
+    {                                                              \
+        static std::chrono::steady_clock::time_point next_allowed; \
+        TG_LOG_IMPL(tg, next_allowed, SPDLOG_WARN(__VA_ARGS__));   \
     }
 
 /**
- * Defines time guard warning log with counter. Log warning every tg seconds.
+ * Defines time guard warning log for indexed items (actuators,..). Log
+ * warning for each index every tg seconds.
  *
  * @param tg time guard, chrono literal how often logging shall be done
- * @param index
- * @param size
- * @param ... __VA_ARGS__ passed to SPDLOG_ERROR
+ * @param index item index, 0 to size - 1
+ * @param size number of items, must be constant expression
+ * @param ... __VA_ARGS__ passed to SPDLOG_WARN
  */
-#define TG_INDEX_LOG_WARN(tg, index, size, ...)                                               \
-    {                                                                                         \
-        static std::vector<std::chrono::time_point<std::chrono::steady_clock>> last_executed( \
-                size, std::chrono::steady_clock::now() -                                      \
-                              std::chrono::duration_cast<std::chrono::seconds>(tg * 2));      \
-        if ((std::chrono::steady_clock::now() - last_executed[index]) > tg) {                 \
-            SPDLOG_WARN(__VA_ARGS__);                                                         \
-            last_executed[index] = std::chrono::steady_clock::now();                          \
-        }                                                                                     \
+#define TG_INDEX_LOG_WARN(tg, index, size, ...)                          \
+    {                                                                    \
+        static std::chrono::steady_clock::time_point next_allowed[size]; \
+        TG_LOG_IMPL(tg, next_allowed[index], SPDLOG_WARN(__VA_ARGS__));  \
     }
 
 #endif  // !LIMITLOG_H_
@@ -23,32 +23,45 @@
 #ifndef LIMITTRIGGER_H_
 #define LIMITTRIGGER_H_
 
+#include <cstdint>
+
 namespace LSST {
 namespace M1M3 {
 namespace SS {
 
 /**
- * Abstract interface class for limiting some action to predefined execution.
- * This class shall be used when a large number of messages (violation of some
- * criteria) can be send. The class can limit number of occurrences it will
- * actually run the execute code.
+ * Base class for limiting some action to predefined execution. This class
+ * shall be used when a large number of messages (violation of some criteria)
+ * can be send. The class can limit number of occurrences it will actually
+ * run the execute code.
+ *
+ * Uses curiously recurring template pattern - the derived class provides
+ * non-virtual trigger, execute and reset methods, so check calls are
+ * resolved at compile time and can be inlined. Reset shall be public and
+ * called after conditions are back inside bounds. Arguments are passed
+ * unformatted, and shall be formatted only in execute.
  *
+ * @tparam TDerived derived class, providing trigger, execute and reset
  * @tparam TcheckArgs arguments passed to check and execute methods
  *
  * Example:
  *
  * @code{.cpp}
  *
- * class MyLimitTrigger: public LimitTrigger<const char*> {
+ * class MyLimitTrigger: public LimitTrigger<MyLimitTrigger, const char*> {
  * public:
  *     MyLimitTrigger(int minOccurence) {
  *         reset();
  *         _minOccurence = minOccurence;
  *     }
  *
- *     bool trigger() override { return ++_counter >= _minOccurence; }
- *     void execute(const char *msg) override { std::cout << "Executed with
- * message " << msg << std::endl; } void reset() override { _counter = 0; }
+ *     void reset() { _counter = 0; }
+ *
+ * protected:
+ *     friend LimitTrigger;
+ *
+ *     bool trigger() { return ++_counter >= _minOccurence; }
+ *     void execute(const char *msg) { std::cout << "Executed with message " << msg << std::endl; }
  *
  * private:
  *     int _counter;
@@ -59,16 +72,14 @@ namespace SS {
  *     MyLimitTrigger limitTrigger(10);
  *
  *     ....
- *     limitTrigger.check();
+ *     limitTrigger.check("message");
  *     ....
  *
  * @endcode
  */
-template <typename... TcheckArgs>
+template <class TDerived, typename... TcheckArgs>
 class LimitTrigger {
 public:
-    LimitTrigger() {}
-
     /**
      * Should be called from code when out of bounds conditions for triggering is
      * detected.
@@ -77,35 +88,61 @@ public:
      * triggering conditions are met.
      */
     void check(TcheckArgs... args) {
-        if (trigger()) {
-            execute(args...);
+        TDerived* derived = static_cast<TDerived*>(this);
+        if (derived->trigger()) {
+            derived->execute(args...);
         }
     }
 
-    /**
-     * Pure virtual placeholder to reset any internal variables. Shall be
-     * called after conditions are back inside bounds and no future triggering
-     * is expected in the current system state.
-     */
-    virtual void reset() = 0;
-
 protected:
+    LimitTrigger() {}
+};
+
+/**
+ * Counts consecutive occurrences of a problem. Reports (next returns true)
+ * on the 1st, 200th and 500th occurrence, and then on every PERIOD
+ * occurrence. The next reported occurrence is precomputed, so a
+ * not-reported occurrence costs a single comparison.
+ *
+ * @tparam PERIOD occurrences period after the 500th occurrence
+ */
+template <uint32_t PERIOD>
+class OccurrenceCounter {
+public:
+    static_assert(PERIOD > 500, "Period shall be above the last fixed level (500)");
+
+    OccurrenceCounter() : _counter(0), _next(1) {}
+
     /**
-     * Pure virtual placeholder for check if triggering criteria are met.
+     * Count new occurrence.
      *
-     * @return true if execute method shall be executed
+     * @return true if the occurrence shall be reported
      */
-    virtual bool trigger() = 0;
+    bool next() {
+        if (++_counter != _next) {
+            return false;
+        }
+        _next = _next == 1 ? 200 : (_next == 200 ? 500 : (_next == 500 ? PERIOD : _next + PERIOD));
+        return true;
+    }
 
     /**
-     * Pure virtual placeholder for executing limited action. Child subclasses
-     * shall override this method and put the action (sending log message, ..)
-     * which should be executed.
+     * Restart counting, so the next occurrence is reported as the first.
      *
-     * @param args arguments passed to check
-     * @see check
+     * @return number of occurrences counted before restart
      */
-    virtual void execute(TcheckArgs... args) = 0;
+    uint32_t restart() {
+        uint32_t ret = _counter;
+        _counter = 0;
+        _next = 1;
+        return ret;
+    }
+
+    uint32_t count() const { return _counter; }
+
+private:
+    uint32_t _counter;
+    uint32_t _next;
 };
 
 }  // namespace SS
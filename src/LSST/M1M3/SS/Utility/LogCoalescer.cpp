@@ -0,0 +1,93 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <spdlog/fmt/fmt.h>
+
+#include <LogCoalescer.h>
+
+using namespace LSST::M1M3::SS;
+
+LogCoalescer::LogCoalescer(std::chrono::steady_clock::duration window) : _window(window), _coalesced(0) {
+    for (auto& slot : _slots) {
+        slot.used = false;
+        slot.repeated = 0;
+    }
+}
+
+void LogCoalescer::add(const LogEntry& entry, std::chrono::steady_clock::time_point now,
+                       std::vector<LogEntry>& out) {
+    Slot* free = nullptr;
+    Slot* oldest = nullptr;
+    for (auto& slot : _slots) {
+        if (slot.used == false) {
+            if (free == nullptr) {
+                free = &slot;
+            }
+            continue;
+        }
+        if (slot.entry.level == entry.level && slot.entry.message == entry.message) {
+            if (now - slot.start < _window) {
+                slot.repeated++;
+                _coalesced++;
+                return;
+            }
+            // window expired, start a new one in the same slot
+            free = &slot;
+            break;
+        }
+        if (oldest == nullptr || slot.start < oldest->start) {
+            oldest = &slot;
+        }
+    }
+
+    if (free == nullptr) {
+        free = oldest;
+    }
+    _summary(*free, out);
+
+    out.push_back(entry);
+    free->used = true;
+    free->entry = entry;
+    free->start = now;
+}
+
+void LogCoalescer::expire(std::chrono::steady_clock::time_point now, std::vector<LogEntry>& out,
+                          bool force) {
+    for (auto& slot : _slots) {
+        if (slot.used == false || (force == false && now - slot.start < _window)) {
+            continue;
+        }
+        _summary(slot, out);
+        slot.used = false;
+    }
+}
+
+void LogCoalescer::_summary(Slot& slot, std::vector<LogEntry>& out) {
+    if (slot.repeated == 0) {
+        return;
+    }
+    LogEntry summary = slot.entry;
+    summary.message = fmt::format("{} (repeated {} more times)", slot.entry.message, slot.repeated);
+    out.push_back(summary);
+    slot.repeated = 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGCOALESCER_H_
+#define LOGCOALESCER_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+//* log message forwarded to a slow sink
+struct LogEntry {
+    int level;
+    std::string message;
+    std::string filePath;
+    std::string functionName;
+    int lineNumber;
+};
+
+/**
+ * Coalesces repeated log messages. The first occurrence of a message is
+ * passed through, identical (same level and text) messages within the window
+ * are only counted, even if other messages arrive in between. Single summary
+ * message with the repeat count is produced when the window expires.
+ *
+ * Messages are tracked in a small fixed-size table. When the table is full,
+ * the oldest message is evicted (and its summary produced) to make space for
+ * a new one.
+ *
+ * Used to protect slow sinks (SAL logMessage) from bursts of identical
+ * warnings during faults.
+ */
+class LogCoalescer {
+public:
+    /**
+     * @param window time after the first occurrence during which identical
+     * messages are coalesced
+     */
+    LogCoalescer(std::chrono::steady_clock::duration window);
+
+    /**
+     * Process new entry.
+     *
+     * @param entry new log entry
+     * @param now current time
+     * @param out entries to be published are appended here - summary of the
+     * expired or evicted message first, then entry if it shall be published
+     */
+    void add(const LogEntry& entry, std::chrono::steady_clock::time_point now, std::vector<LogEntry>& out);
+
+    /**
+     * Append pending summaries of messages with expired window to out.
+     *
+     * @param now current time
+     * @param out entries to be published
+     * @param force append all pending summaries even if window didn't expire
+     */
+    void expire(std::chrono::steady_clock::time_point now, std::vector<LogEntry>& out, bool force = false);
+
+    //* number of messages coalesced (not published) so far
+    uint64_t getCoalesced() const { return _coalesced; }
+
+    //* number of distinct messages tracked at once
+    static constexpr size_t TABLE_SIZE = 8;
+
+private:
+    struct Slot {
+        bool used;
+        LogEntry entry;
+        std::chrono::steady_clock::time_point start;
+        uint64_t repeated;
+    };
+
+    void _summary(Slot& slot, std::vector<LogEntry>& out);
+
+    std::chrono::steady_clock::duration _window;
+
+    std::array<Slot, TABLE_SIZE> _slots;
+
+    uint64_t _coalesced;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // LOGCOALESCER_H_
@@ -102,19 +102,37 @@ std::vector<uint8_t> ModbusBuffer::getReadData(int32_t length) {
     return data;
 }
 
-uint16_t ModbusBuffer::calculateCRC(std::vector<uint8_t> data) {
-    uint16_t crc = 0xFFFF;
-    for (std::vector<uint8_t>::iterator i = data.begin(); i < data.end(); i++) {
-        crc = crc ^ static_cast<uint16_t>(*i);
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = crc >> 1;
-                crc = crc ^ 0xA001;
-            } else {
-                crc = crc >> 1;
+// Modbus CRC16 (polynomial 0xA001) lookup table
+struct CRCTable {
+    constexpr CRCTable() : values() {
+        for (int i = 0; i < 256; i++) {
+            uint16_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                if (crc & 0x0001) {
+                    crc = crc >> 1;
+                    crc = crc ^ 0xA001;
+                } else {
+                    crc = crc >> 1;
+                }
             }
+            values[i] = crc;
         }
     }
+
+    uint16_t values[256];
+};
+
+constexpr static CRCTable crcTable;
+
+uint16_t ModbusBuffer::updateCRC(uint16_t crc, uint8_t data) {
+    return (crc >> 8) ^ crcTable.values[(crc ^ data) & 0xFF];
+}
+
+uint16_t ModbusBuffer::calculateCRC(const std::vector<uint8_t>& data) {
+    uint16_t crc = 0xFFFF;
+    for (auto d : data) {
+        crc = updateCRC(crc, d);
+    }
     return crc;
 }
 
@@ -124,7 +142,11 @@ uint16_t ModbusBuffer::calculateCRC(int32_t length) {
     LSST::cRIO::CliApp::printHexBuffer(_buffer + _index - length, length);
     std::cout << std::endl;
 #endif
-    return calculateCRC(getReadData(length));
+    uint16_t crc = 0xFFFF;
+    for (int i = _index - length; i < _index; i++) {
+        crc = updateCRC(crc, readInstructionByte(_buffer[i]));
+    }
+    return crc;
 }
 
 uint16_t ModbusBuffer::readLength() { return _buffer[_index++]; }
@@ -76,7 +76,17 @@ public:
      *
      * @return calculated Modbus CRC16
      */
-    static uint16_t calculateCRC(std::vector<uint8_t> data);
+    static uint16_t calculateCRC(const std::vector<uint8_t>& data);
+
+    /**
+     * Updates Modbus CRC16 with a byte.
+     *
+     * @param crc current CRC16 value (0xFFFF for the first byte)
+     * @param data next byte
+     *
+     * @return updated CRC16
+     */
+    static uint16_t updateCRC(uint16_t crc, uint8_t data);
 
     /**
      * Calculate Modbus from written data
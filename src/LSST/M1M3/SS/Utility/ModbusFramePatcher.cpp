@@ -0,0 +1,94 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <ModbusFramePatcher.h>
+
+using namespace LSST::M1M3::SS;
+
+ModbusFramePatcher::ModbusFramePatcher()
+        : _buffer(nullptr), _frame(nullptr), _index(0), _length(0), _crc(0), _changed(false) {}
+
+void ModbusFramePatcher::attach(ModbusBuffer* buffer, int32_t index, int32_t length) {
+    _buffer = buffer;
+    _index = index;
+    _length = length;
+    _changed = false;
+
+    _frame = _buffer->getBuffer() + _index;
+    _crc = static_cast<uint16_t>(ModbusBuffer::readInstructionByte(_frame[_length])) |
+           static_cast<uint16_t>(ModbusBuffer::readInstructionByte(_frame[_length + 1])) << 8;
+
+    // CRC of a single bit followed by zero bytes, calculated with zero
+    // initial value, is the CRC change caused by flipping the bit. Changes
+    // for all values of low and high nibble are stored for each byte
+    _nibbleCRC.assign(_length * 32, 0);
+    for (int bit = 0; bit < 8; bit++) {
+        uint16_t crc = ModbusBuffer::updateCRC(0, 1 << bit);
+        for (int offset = _length - 1; offset >= 0; offset--) {
+            uint16_t* nibbleCRC = _nibbleCRC.data() + offset * 32 + (bit < 4 ? 0 : 16);
+            int nibbleBit = 1 << (bit % 4);
+            for (int n = 0; n < 16; n++) {
+                if (n & nibbleBit) {
+                    nibbleCRC[n] ^= crc;
+                }
+            }
+            crc = ModbusBuffer::updateCRC(crc, 0);
+        }
+    }
+}
+
+void ModbusFramePatcher::patchU8(int32_t offset, uint8_t data) {
+    uint16_t* word = _frame + offset;
+    uint8_t change = ModbusBuffer::readInstructionByte(*word) ^ data;
+    if (change == 0) {
+        return;
+    }
+    _patch(offset, change);
+    *word = ModbusBuffer::writeByteInstruction(data);
+}
+
+void ModbusFramePatcher::_patchI24(int32_t offset, int32_t data, uint32_t change) {
+    for (int i = 0; i < 3; i++) {
+        uint8_t byteChange = change >> (16 - 8 * i);
+        if (byteChange != 0) {
+            _patch(offset + i, byteChange);
+            _frame[offset + i] = ModbusBuffer::writeByteInstruction((uint8_t)(data >> (16 - 8 * i)));
+        }
+    }
+}
+
+void ModbusFramePatcher::_patch(int32_t offset, uint8_t change) {
+    const uint16_t* nibbleCRC = _nibbleCRC.data() + offset * 32;
+    _crc ^= nibbleCRC[change & 0x0F] ^ nibbleCRC[16 + (change >> 4)];
+    _changed = true;
+}
+
+void ModbusFramePatcher::writeCRC() {
+    if (_changed == false) {
+        return;
+    }
+
+    _frame[_length] = ModbusBuffer::writeByteInstruction((uint8_t)_crc);
+    _frame[_length + 1] = ModbusBuffer::writeByteInstruction((uint8_t)(_crc >> 8));
+    _changed = false;
+}
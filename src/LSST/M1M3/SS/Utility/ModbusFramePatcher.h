@@ -0,0 +1,124 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MODBUSFRAMEPATCHER_H_
+#define MODBUSFRAMEPATCHER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <ModbusBuffer.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Patches data of a Modbus frame already written into ModbusBuffer. Only
+ * bytes with changed value are rewritten. As Modbus CRC16 is linear, change
+ * of a bit changes CRC by a value dependent only on the bit position in the
+ * frame. Those values are precalculated when the patcher is attached to a
+ * frame, so CRC is updated without processing unchanged bytes.
+ *
+ * Patching doesn't allocate memory, and produces exactly the same buffer
+ * content as rewriting the frame.
+ */
+class ModbusFramePatcher {
+public:
+    ModbusFramePatcher();
+
+    /**
+     * Attaches patcher to a frame. The frame data and its CRC must be
+     * already written into the buffer.
+     *
+     * @param buffer buffer containing the frame
+     * @param index index of the first frame byte in the buffer
+     * @param length number of bytes covered by the frame CRC
+     */
+    void attach(ModbusBuffer* buffer, int32_t index, int32_t length);
+
+    /**
+     * Returns true if patcher is attached to a frame.
+     */
+    bool attached() { return _buffer != nullptr; }
+
+    /**
+     * Writes byte into the frame.
+     *
+     * @param offset byte offset from the frame start
+     * @param data new byte value
+     */
+    void patchU8(int32_t offset, uint8_t data);
+
+    /**
+     * Writes 24 bits signed integer into the frame, big endian.
+     *
+     * @param offset offset of the first byte from the frame start
+     * @param data new value
+     */
+    void patchI24(int32_t offset, int32_t data) {
+        uint16_t* words = _frame + offset;
+        uint32_t change = ((uint32_t)ModbusBuffer::readInstructionByte(words[0]) << 16 |
+                           (uint32_t)ModbusBuffer::readInstructionByte(words[1]) << 8 |
+                           (uint32_t)ModbusBuffer::readInstructionByte(words[2])) ^
+                          ((uint32_t)data & 0xFFFFFF);
+        if (change != 0) {
+            _patchI24(offset, data, change);
+        }
+    }
+
+    /**
+     * Writes updated CRC into the buffer. Shall be called after all bytes
+     * are patched.
+     */
+    void writeCRC();
+
+private:
+    /**
+     * Updates CRC for changed bits.
+     *
+     * @param offset byte offset from the frame start
+     * @param change changed bits (XOR of the old and new byte value)
+     */
+    void _patch(int32_t offset, uint8_t change);
+
+    void _patchI24(int32_t offset, int32_t data, uint32_t change);
+
+    ModbusBuffer* _buffer;
+    // first frame word in the buffer
+    uint16_t* _frame;
+    int32_t _index;
+    int32_t _length;
+    uint16_t _crc;
+    bool _changed;
+
+    // CRC change caused by a change of low (first 16 values) and high (next
+    // 16 values) nibble, 32 values for each frame byte
+    std::vector<uint16_t> _nibbleCRC;
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* MODBUSFRAMEPATCHER_H_ */
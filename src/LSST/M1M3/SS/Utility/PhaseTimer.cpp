@@ -0,0 +1,84 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <PhaseTimer.h>
+
+using namespace LSST::M1M3::SS;
+
+PhaseTimer::PhaseTimer(const char* operation, const char* const* names, size_t count)
+        : _operation(operation), _names(names), _count(count) {
+    if (_count > MAX_PHASES) {
+        throw std::runtime_error(
+                fmt::format("{}: cannot time {} phases, maximum is {}", operation, count, MAX_PHASES));
+    }
+    reset();
+}
+
+void PhaseTimer::enter(size_t phase, double timestamp) {
+    if (phase == _current) {
+        return;
+    }
+    if (_current == NONE) {
+        reset();
+        _started = timestamp;
+    } else {
+        _close(timestamp);
+    }
+    _current = phase;
+    _entered = timestamp;
+}
+
+void PhaseTimer::finish(double timestamp) {
+    if (_current == NONE) {
+        return;
+    }
+    _close(timestamp);
+    _current = NONE;
+    _total = timestamp - _started;
+
+    std::string summary;
+    for (size_t i = 0; i < _count; i++) {
+        summary += fmt::format(" {} {:.3f} s", _names[i], _durations[i]);
+    }
+    SPDLOG_INFO("{} finished in {:.3f} s:{}", _operation, _total, summary);
+}
+
+void PhaseTimer::reset() {
+    _current = NONE;
+    _started = 0;
+    _entered = 0;
+    _total = 0;
+    for (size_t i = 0; i < MAX_PHASES; i++) {
+        _durations[i] = 0;
+    }
+}
+
+void PhaseTimer::_close(double timestamp) {
+    double elapsed = timestamp - _entered;
+    _durations[_current] += elapsed;
+    SPDLOG_INFO("{} {} took {:.3f} s", _operation, _names[_current], elapsed);
+}
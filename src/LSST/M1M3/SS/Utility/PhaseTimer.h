@@ -0,0 +1,132 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PHASETIMER_H_
+#define PHASETIMER_H_
+
+#include <cstddef>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Measures time spent in phases of a long running operation (raising,
+ * lowering). The operation owner reports phase it is in with enter; phase
+ * durations are logged on every phase change, and the summary when the
+ * operation finishes. Phases can be re-entered, their durations are summed.
+ *
+ * Example:
+ *
+ * @code{.cpp}
+ * const char* names[] = {"Wait", "Move"};
+ * PhaseTimer timer("Moving", names);
+ *
+ * timer.enter(0, now());
+ * ...
+ * timer.enter(1, now());
+ * ...
+ * timer.finish(now());
+ * @endcode
+ */
+class PhaseTimer {
+public:
+    //* maximal number of phases
+    static constexpr size_t MAX_PHASES = 8;
+
+    //* current phase value when timer is not running
+    static constexpr size_t NONE = MAX_PHASES;
+
+    /**
+     * Construct phase timer.
+     *
+     * @param operation operation name, used in log messages
+     * @param names phase names. Must remain valid for the timer lifetime
+     * @param count number of phases
+     *
+     * @throw std::runtime_error if count is above MAX_PHASES
+     */
+    PhaseTimer(const char* operation, const char* const* names, size_t count);
+
+    template <size_t C>
+    PhaseTimer(const char* operation, const char* const (&names)[C]) : PhaseTimer(operation, names, C) {}
+
+    /**
+     * Enters phase. Starts the timer, clearing previous durations, if it
+     * isn't running. Does nothing if already in the phase.
+     *
+     * @param phase phase index
+     * @param timestamp current time (seconds)
+     */
+    void enter(size_t phase, double timestamp);
+
+    /**
+     * Stops the timer, logs durations of all phases.
+     *
+     * @param timestamp current time (seconds)
+     */
+    void finish(double timestamp);
+
+    /**
+     * Stops the timer and clears durations, without logging.
+     */
+    void reset();
+
+    bool running() const { return _current != NONE; }
+
+    size_t getCurrent() const { return _current; }
+
+    size_t size() const { return _count; }
+
+    const char* getName(size_t phase) const { return _names[phase]; }
+
+    /**
+     * Returns total time spent in phase. Doesn't include time of currently
+     * running phase.
+     */
+    double getDuration(size_t phase) const { return _durations[phase]; }
+
+    /**
+     * Returns time from the first enter call to finish call.
+     */
+    double getTotal() const { return _total; }
+
+private:
+    void _close(double timestamp);
+
+    const char* _operation;
+    const char* const* _names;
+    size_t _count;
+
+    size_t _current;
+    double _started;
+    double _entered;
+    double _total;
+    double _durations[MAX_PHASES];
+};
+
+} /* namespace SS */
+} /* namespace M1M3 */
+} /* namespace LSST */
+
+#endif /* PHASETIMER_H_ */
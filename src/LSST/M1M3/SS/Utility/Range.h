@@ -74,6 +74,7 @@ public:
      * aren't met. Reset LimitTrigger if conditions returned back to normal.
      *
      * @tparam T test value type
+     * @tparam TTrigger LimitTrigger subclass
      * @tparam TArgs variadic arguments for LimitTrigger
      * @param min range minimal value
      * @param max range maximal value
@@ -83,13 +84,14 @@ public:
      *
      * @return true if value >= min and value <= max
      */
-    template <typename T, typename... TArgs>
-    static bool InRangeTrigger(T min, T max, T value, LimitTrigger<TArgs...>& limitTrigger, TArgs... lArgs) {
+    template <typename T, class TTrigger, typename... TArgs>
+    static bool InRangeTrigger(T min, T max, T value, LimitTrigger<TTrigger, TArgs...>& limitTrigger,
+                               TArgs... lArgs) {
         bool inRange = InRange(min, max, value);
         if (inRange == false) {
             limitTrigger.check(lArgs...);
         } else {
-            limitTrigger.reset();
+            static_cast<TTrigger&>(limitTrigger).reset();
         }
         return inRange;
     }
@@ -0,0 +1,146 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unistd.h>
+
+#include <SALSink.h>
+
+using namespace LSST::M1M3::SS;
+
+// identical messages within this time are published only once
+constexpr auto COALESCE_WINDOW = std::chrono::seconds(1);
+
+// minimal interval between statistics messages
+constexpr auto STATISTICS_INTERVAL = std::chrono::seconds(10);
+
+SALSink::SALSink(std::shared_ptr<SAL_MTM1M3> m1m3SAL,
+                 std::shared_ptr<spdlog::details::thread_pool> threadPool)
+        : _m1m3SAL(m1m3SAL),
+          _threadPool(threadPool),
+          _keepRunning(true),
+          _dropped(0),
+          _coalesced(0),
+          _publishedDropped(0),
+          _publishedCoalesced(0),
+          _publishedOverrun(0) {
+    _m1m3SAL->salEventPub((char*)"MTM1M3_logevent_logMessage");
+    _queue.reserve(QUEUE_SIZE);
+    _thread = std::thread(&SALSink::_run, this);
+}
+
+SALSink::~SALSink() {
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        _keepRunning = false;
+    }
+    _queueCondition.notify_one();
+    _thread.join();
+}
+
+void SALSink::sink_it_(const spdlog::details::log_msg& msg) {
+    {
+        std::lock_guard<std::mutex> lock(_queueMutex);
+        if (_queue.size() >= QUEUE_SIZE) {
+            _dropped++;
+            return;
+        }
+        _queue.push_back(LogEntry{msg.level * 10, fmt::to_string(msg.payload),
+                                  msg.source.filename == nullptr ? "" : msg.source.filename,
+                                  msg.source.funcname == nullptr ? "" : msg.source.funcname,
+                                  msg.source.line});
+    }
+    _queueCondition.notify_one();
+}
+
+void SALSink::_run() {
+    LogCoalescer coalescer(COALESCE_WINDOW);
+    std::vector<LogEntry> received;
+    std::vector<LogEntry> toPublish;
+    received.reserve(QUEUE_SIZE);
+
+    auto nextStatistics = std::chrono::steady_clock::now();
+    bool keepRunning = true;
+
+    while (keepRunning) {
+        {
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _queueCondition.wait_for(lock, COALESCE_WINDOW,
+                                     [this] { return !_queue.empty() || !_keepRunning; });
+            received.swap(_queue);
+            keepRunning = _keepRunning;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        for (auto& entry : received) {
+            coalescer.add(entry, now, toPublish);
+        }
+        received.clear();
+        coalescer.expire(now, toPublish, !keepRunning);
+        _coalesced = coalescer.getCoalesced();
+
+        for (auto& entry : toPublish) {
+            _publish(entry);
+        }
+        toPublish.clear();
+
+        if (now >= nextStatistics || !keepRunning) {
+            _publishStatistics();
+            nextStatistics = now + STATISTICS_INTERVAL;
+        }
+    }
+}
+
+void SALSink::_publish(const LogEntry& entry) {
+    MTM1M3_logevent_logMessageC message;
+    message.name = "MTM1M3";
+    message.level = entry.level;
+    message.message = entry.message;
+    message.traceback = "";
+    message.filePath = entry.filePath;
+    message.functionName = entry.functionName;
+    message.lineNumber = entry.lineNumber;
+    message.process = getpid();
+
+    _m1m3SAL->logEvent_logMessage(&message, 0);
+}
+
+void SALSink::_publishStatistics() {
+    uint64_t dropped = _dropped;
+    uint64_t coalesced = _coalesced;
+    auto threadPool = _threadPool.lock();
+    size_t overrun = threadPool == nullptr ? 0 : threadPool->overrun_counter();
+
+    if (dropped == _publishedDropped && coalesced == _publishedCoalesced && overrun == _publishedOverrun) {
+        return;
+    }
+
+    _publish(LogEntry{spdlog::level::warn * 10,
+                      fmt::format("Log messages dropped: {} (SAL queue), {} (async logger queue overrun); "
+                                  "coalesced: {}",
+                                  dropped, overrun, coalesced),
+                      __FILE__, __func__, __LINE__});
+
+    _publishedDropped = dropped;
+    _publishedCoalesced = coalesced;
+    _publishedOverrun = overrun;
+}
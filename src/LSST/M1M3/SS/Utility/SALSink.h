@@ -24,11 +24,19 @@
 #ifndef SALSINK_H_
 #define SALSINK_H_
 
-#include "spdlog/sinks/base_sink.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/base_sink.h>
 
 #include <SAL_MTM1M3.h>
 
-#include <memory>
+#include <LogCoalescer.h>
 
 namespace LSST {
 namespace M1M3 {
@@ -37,44 +45,65 @@ namespace SS {
 /**
  * Sink to send all M1M3 spdlog messages to SAL using logMessage event.
  *
+ * SAL publishing is slow, so it's isolated from other sinks. sink_it_ only
+ * copies the message into a bounded queue (dropping it if the queue is
+ * full), and messages are published from the sink's own thread. Repeated
+ * identical messages are coalesced before publishing. Number of dropped and
+ * coalesced messages (and messages overrun in the async logger queue, if
+ * its thread pool is set) is published as logMessage once a while when it
+ * changes.
+ *
  * @see https://github.com/gabime/spdlog/wiki/4.-Sinks
+ * @see LogCoalescer
  */
-template <typename Mutex>
-class SALSink : public spdlog::sinks::base_sink<Mutex> {
+class SALSink : public spdlog::sinks::base_sink<std::mutex> {
 public:
-    SALSink(std::shared_ptr<SAL_MTM1M3> m1m3SAL) {
-        _m1m3SAL = m1m3SAL;
-        _m1m3SAL->salEventPub((char*)"MTM1M3_logevent_logMessage");
-    }
+    //* maximal number of messages waiting for publishing
+    static constexpr size_t QUEUE_SIZE = 1024;
 
-protected:
-    void sink_it_(const spdlog::details::log_msg& msg) override {
-        spdlog::memory_buf_t formatted;
-        spdlog::sinks::base_sink<Mutex>::formatter_->format(msg, formatted);
-
-        MTM1M3_logevent_logMessageC message;
-        message.name = "MTM1M3";
-        message.level = msg.level * 10;
-        message.message = fmt::to_string(msg.payload);
-        message.traceback = "";
-        message.filePath = msg.source.filename;
-        message.functionName = msg.source.funcname;
-        message.lineNumber = msg.source.line;
-        message.process = getpid();
-
-        _m1m3SAL->logEvent_logMessage(&message, 0);
-    }
+    /**
+     * Constructs the sink and starts its publishing thread.
+     *
+     * @param m1m3SAL SAL used to publish logMessage events
+     * @param threadPool async logger thread pool, which overrun counter is
+     * published together with the sink statistics. Only weak reference is
+     * kept, as the pool queue can hold the logger (and so this sink).
+     */
+    SALSink(std::shared_ptr<SAL_MTM1M3> m1m3SAL,
+            std::shared_ptr<spdlog::details::thread_pool> threadPool = nullptr);
+    virtual ~SALSink();
+
+    uint64_t getDropped() const { return _dropped; }
+    uint64_t getCoalesced() const { return _coalesced; }
 
+protected:
+    void sink_it_(const spdlog::details::log_msg& msg) override;
     void flush_() override {}
 
 private:
+    void _run();
+    void _publish(const LogEntry& entry);
+    void _publishStatistics();
+
     std::shared_ptr<SAL_MTM1M3> _m1m3SAL;
+    std::weak_ptr<spdlog::details::thread_pool> _threadPool;
+
+    std::mutex _queueMutex;
+    std::condition_variable _queueCondition;
+    std::vector<LogEntry> _queue;
+    bool _keepRunning;
+
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _coalesced;
+
+    uint64_t _publishedDropped;
+    uint64_t _publishedCoalesced;
+    size_t _publishedOverrun;
+
+    std::thread _thread;
 };
 
-#include "spdlog/details/null_mutex.h"
-#include <mutex>
-using SALSink_mt = SALSink<std::mutex>;
-using SALSink_st = SALSink<spdlog::details::null_mutex>;
+using SALSink_mt = SALSink;
 
 }  // namespace SS
 }  // namespace M1M3
@@ -0,0 +1,74 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include <StagePipeline.h>
+
+using namespace LSST::M1M3::SS;
+
+StagePipeline::StagePipeline(const Stage* stages, size_t count)
+        : _stages(stages), _count(count), _timing(false) {
+    if (count > MAX_STAGES) {
+        throw std::runtime_error(
+                fmt::format("Too many pipeline stages: {}, maximum is {}", count, MAX_STAGES));
+    }
+    _all = count == MAX_STAGES ? UINT32_MAX : bit(count) - 1;
+    resetTiming();
+}
+
+void StagePipeline::run(uint32_t mask) {
+    mask &= _all;
+    while (mask != 0) {
+        int stage = __builtin_ctz(mask);
+        mask &= mask - 1;
+        if (_timing == false) {
+            _stages[stage].run();
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        _stages[stage].run();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Timing& t = _timings[stage];
+        t.runs++;
+        t.last = elapsed;
+        t.total += elapsed;
+        if (elapsed > t.max) {
+            t.max = elapsed;
+        }
+    }
+}
+
+void StagePipeline::setTiming(bool timing) {
+    resetTiming();
+    _timing = timing;
+}
+
+void StagePipeline::resetTiming() {
+    for (size_t i = 0; i < MAX_STAGES; i++) {
+        _timings[i] = Timing{0, std::chrono::nanoseconds(0), std::chrono::nanoseconds(0),
+                             std::chrono::nanoseconds(0)};
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef STAGEPIPELINE_H_
+#define STAGEPIPELINE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Ordered set of processing stages. Stages are run in table order, only
+ * stages enabled in the mask passed to run are executed - disabled stages
+ * cost only a bit scan. Stage names and (optionally measured) execution times
+ * can be queried.
+ *
+ * Example:
+ *
+ * @code{.cpp}
+ * const StagePipeline::Stage stages[] = {{"Read", &read}, {"Process", &process}, {"Publish", &publish}};
+ *
+ * StagePipeline pipeline(stages);
+ *
+ * pipeline.run(StagePipeline::bit(0) | StagePipeline::bit(2));
+ * @endcode
+ */
+class StagePipeline {
+public:
+    //* maximal number of stages
+    static constexpr size_t MAX_STAGES = 32;
+
+    struct Stage {
+        //* stage name, for introspection
+        const char* name;
+        //* stage action
+        void (*run)();
+    };
+
+    struct Timing {
+        //* number of timed executions
+        uint64_t runs;
+        //* last execution time
+        std::chrono::nanoseconds last;
+        //* maximal execution time
+        std::chrono::nanoseconds max;
+        //* total execution time
+        std::chrono::nanoseconds total;
+    };
+
+    /**
+     * Construct pipeline.
+     *
+     * @param stages stages, in execution order. Must remain valid for the
+     * pipeline lifetime
+     * @param count number of stages
+     *
+     * @throw std::runtime_error if count is above MAX_STAGES
+     */
+    StagePipeline(const Stage* stages, size_t count);
+
+    template <size_t C>
+    StagePipeline(const Stage (&stages)[C]) : StagePipeline(stages, C) {}
+
+    /**
+     * Runs enabled stages.
+     *
+     * @param mask enabled stages, stage index bits
+     */
+    void run(uint32_t mask);
+
+    static constexpr uint32_t bit(size_t stage) { return 1u << stage; }
+
+    size_t size() const { return _count; }
+
+    const char* getName(size_t stage) const { return _stages[stage].name; }
+
+    /**
+     * Enables or disables stages timing. Timing statistics are reset.
+     */
+    void setTiming(bool timing);
+
+    bool getTiming() const { return _timing; }
+
+    const Timing& getTiming(size_t stage) const { return _timings[stage]; }
+
+    void resetTiming();
+
+private:
+    const Stage* _stages;
+    size_t _count;
+    uint32_t _all;
+
+    bool _timing;
+    Timing _timings[MAX_STAGES];
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !STAGEPIPELINE_H_
@@ -0,0 +1,171 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef WARNINGTABLE_H_
+#define WARNINGTABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <EventChangeTracker.h>
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+/**
+ * Declarative decoding of sensor warning words into warning event fields.
+ * Each table entry maps bits in a status word to an event field and
+ * (optionally) a notifier method (SafetyController::*Notify*) raising the
+ * matching fault. Decoding is a single table walk. Event fields are updated
+ * through EventChangeTracker. Notifiers are called for every active field on
+ * each decode, as a persisting error shall raise its fault again after fault
+ * recovery, and for fields which were cleared. Callers decoding a new error
+ * timestamp shall mark the tracker, so the warning event is republished.
+ *
+ * Sensors reporting an error code (a single error at a time) are decoded as
+ * one-hot bitfields - see codeWord.
+ *
+ * @tparam W warning event structure
+ * @tparam N notifier class (usually SafetyController)
+ *
+ * Example:
+ *
+ * @code{.cpp}
+ * typedef WarningTable<MTM1M3_logevent_inclinometerSensorWarningC, SafetyController> Table;
+ *
+ * const Table::Entry entries[] = {
+ *     {&MTM1M3_logevent_inclinometerSensorWarningC::unknownAddress, 0, Table::codeWord(1), false,
+ *      &SafetyController::inclinometerNotifyUnknownAddress},
+ *     ...
+ * };
+ *
+ * const Table table(entries);
+ *
+ * uint32_t word = Table::codeWord(errorCode);
+ * table.decode(&word, warning, tracker, safetyController);
+ * @endcode
+ */
+template <typename W, typename N>
+class WarningTable {
+public:
+    /**
+     * Maps status bits to warning field.
+     */
+    struct Entry {
+        //* warning field
+        bool W::*field;
+        //* index of status word
+        uint8_t word;
+        //* status word bits. Field is set if any of the bits is set
+        uint32_t mask;
+        //* if true, field is set when all mask bits are cleared
+        bool activeLow;
+        //* notifier called with the new field value, can be nullptr
+        void (N::*notify)(bool);
+    };
+
+    /**
+     * Construct table.
+     *
+     * @param entries table entries. Must remain valid for table lifetime
+     * @param count number of entries
+     */
+    constexpr WarningTable(const Entry* entries, size_t count) : _entries(entries), _count(count) {}
+
+    template <size_t C>
+    constexpr WarningTable(const Entry (&entries)[C]) : WarningTable(entries, C) {}
+
+    /**
+     * Decodes status words into warning event fields.
+     *
+     * @param words status words
+     * @param warning warning event
+     * @param tracker warning event change tracker
+     * @param notifier notifier for active and cleared fields, can be nullptr
+     *
+     * @return number of changed fields
+     */
+    int decode(const uint32_t* words, W* warning, EventChangeTracker* tracker, N* notifier) const {
+        int changed = 0;
+        for (size_t i = 0; i < _count; i++) {
+            const Entry& e = _entries[i];
+            bool value = ((words[e.word] & e.mask) != 0) != e.activeLow;
+            bool fieldChanged = tracker->set(warning->*e.field, value);
+            if (fieldChanged) {
+                changed++;
+            }
+            if ((value || fieldChanged) && e.notify != nullptr && notifier != nullptr) {
+                (notifier->*e.notify)(value);
+            }
+        }
+        return changed;
+    }
+
+    /**
+     * Clears all table fields. Equivalent to decoding all words equal to 0
+     * for tables without active low entries.
+     *
+     * @return number of changed fields
+     */
+    int clear(W* warning, EventChangeTracker* tracker, N* notifier) const {
+        int changed = 0;
+        for (size_t i = 0; i < _count; i++) {
+            const Entry& e = _entries[i];
+            if (tracker->set(warning->*e.field, false)) {
+                changed++;
+                if (e.notify != nullptr && notifier != nullptr) {
+                    (notifier->*e.notify)(false);
+                }
+            }
+        }
+        return changed;
+    }
+
+    size_t size() const { return _count; }
+
+    const Entry& operator[](size_t index) const { return _entries[index]; }
+
+    /**
+     * Converts error code into one-hot word. Code 0 (no error) is converted
+     * to 0, codes above 31 to bit 31.
+     */
+    static constexpr uint32_t codeWord(unsigned int code) {
+        return code == 0 ? 0 : (code < 31 ? 1u << code : 1u << 31);
+    }
+
+    /**
+     * Mask matching any non-zero error code.
+     */
+    static constexpr uint32_t ANY_CODE = ~1u;
+
+private:
+    const Entry* _entries;
+    size_t _count;
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+#endif  // !WARNINGTABLE_H_
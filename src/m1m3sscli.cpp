@@ -20,10 +20,15 @@
  * this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <cmath>
 #include <csignal>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
 
 #include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -54,8 +59,26 @@ using namespace std::chrono_literals;
 
 #define MAX_FORCE 250
 
+// timeout (in ms) for a single ILC command set
+#define ILC_TIMEOUT 500
+
 std::ofstream* _test_output = nullptr;
 
+// number of retries of ILCs failing to respond during audit
+#define AUDIT_RETRIES 3
+
+/**
+ * Values collected from ILCs during bulk readout. When set, ILC responses
+ * are stored here instead of being printed.
+ */
+struct ILCAudit {
+    std::vector<std::string> columns;
+    // values keyed by bus (1-5) and ILC address
+    std::map<std::pair<int, int>, std::vector<float>> values;
+};
+
+ILCAudit* _audit = nullptr;
+
 class M1M3SScli : public FPGACliApp {
 public:
     M1M3SScli(const char* name, const char* description);
@@ -75,6 +98,13 @@ public:
 
     int dumpAccelerometer(command_vec cmds);
 
+    int runScript(command_vec cmds);
+    int repeatCommand(command_vec cmds);
+    int setTiming(command_vec cmds);
+    int beginBatch(command_vec cmds);
+    int commitBatch(command_vec cmds);
+    int auditILCs(command_vec cmds);
+
 protected:
     virtual LSST::cRIO::FPGA* newFPGA(const char* dir, bool& fpga_singleton) override;
     virtual ILCUnits getILCs(command_vec cmds) override;
@@ -83,6 +113,49 @@ private:
     void _printSupportData();
     void _report_pressure_forces(ILCUnits& ilcs);
 
+    /**
+     * Runs command, printing its duration if timing is enabled.
+     *
+     * @param cmds command and its arguments
+     *
+     * @return command return value
+     */
+    int _runTimed(command_vec cmds);
+
+    // ILC and FPGA command FIFO commands are executed immediately, or
+    // collected until @commit when a batch is active. Batched ILC commands
+    // are sent as a single Modbus program.
+    void _clearILCs();
+    void _runILCCommands();
+    void _writeCommandFIFO(uint16_t* data, size_t length);
+    bool _rejectInBatch(const char* command);
+
+    /**
+     * Discards queued commands and ends the active batch.
+     *
+     * @param reason reason printed with the number of discarded commands
+     */
+    void _abortBatch(const char* reason);
+
+    /**
+     * Binds command, aborting the active batch if the command throws an
+     * exception.
+     *
+     * @param command command to bind
+     *
+     * @return command action
+     */
+    std::function<int(command_vec)> _guardBatch(int (M1M3SScli::*command)(command_vec));
+
+    int _diffAudit(const ILCAudit& audit, const std::string& reference);
+
+    bool _timing;
+    bool _batch;
+    // true between _clearILCs and _runILCCommands of a command queueing into the batch
+    bool _batchILCCommand;
+    int _batchedILCCommands;
+    std::vector<uint16_t> _batchedFPGACommands;
+
     std::chrono::milliseconds _test_duration;
     std::chrono::milliseconds _test_pause_force;
     std::chrono::milliseconds _test_pause_pressure;
@@ -130,18 +203,20 @@ M1M3SScli::M1M3SScli(const char* name, const char* description)
         : FPGACliApp(name, description),
           _test_duration(std::chrono::milliseconds(3000)),
           _test_pause_force(std::chrono::milliseconds(20)),
-          _test_pause_pressure(std::chrono::milliseconds(20)) {
-    addCommand("power", std::bind(&M1M3SScli::setPower, this, std::placeholders::_1), "i", NEED_FPGA, "<0|1>",
-               "Power off/on ILC bus");
+          _test_pause_pressure(std::chrono::milliseconds(20)),
+          _timing(false),
+          _batch(false),
+          _batchILCCommand(false),
+          _batchedILCCommands(0) {
+    addCommand("power", _guardBatch(&M1M3SScli::setPower), "i", NEED_FPGA, "<0|1>", "Power off/on ILC bus");
 
-    addCommand("air", std::bind(&M1M3SScli::setAir, this, std::placeholders::_1), "b", NEED_FPGA, "<0|1>",
-               "Turns air valve off/on");
+    addCommand("air", _guardBatch(&M1M3SScli::setAir), "b", NEED_FPGA, "<0|1>", "Turns air valve off/on");
 
-    addCommand("accelerometer", std::bind(&M1M3SScli::dumpAccelerometer, this, std::placeholders::_1), "",
-               NEED_FPGA, NULL, "Dumps raw accelerometer data");
+    addCommand("accelerometer", _guardBatch(&M1M3SScli::dumpAccelerometer), "", NEED_FPGA, NULL,
+               "Dumps raw accelerometer data");
 
-    addCommand("lights", std::bind(&M1M3SScli::setLights, this, std::placeholders::_1), "b", NEED_FPGA,
-               "<0|1>", "Turns lights off/on");
+    addCommand("lights", _guardBatch(&M1M3SScli::setLights), "b", NEED_FPGA, "<0|1>",
+               "Turns lights off/on");
 
     addILCCommand(
             "calibration",
@@ -187,29 +262,48 @@ M1M3SScli::M1M3SScli(const char* name, const char* description)
             },
             "Read LVDT info");
 
-    addCommand("set-dca-gain", std::bind(&M1M3SScli::setDCAGain, this, std::placeholders::_1), "DDs?",
-               NEED_FPGA, "<axial gain> <lateral gain> <ILC..>", "Set DCA gain");
+    addCommand("set-dca-gain", _guardBatch(&M1M3SScli::setDCAGain), "DDs?", NEED_FPGA,
+               "<axial gain> <lateral gain> <ILC..>", "Set DCA gain");
 
-    addCommand("@test-output", std::bind(&M1M3SScli::testOutput, this, std::placeholders::_1), "S", 0,
-               "<filename>", "Set filename to record progress of actuators tests.");
-    addCommand("@test-settings", std::bind(&M1M3SScli::testSettings, this, std::placeholders::_1), "III", 0,
+    addCommand("@test-output", _guardBatch(&M1M3SScli::testOutput), "S", 0, "<filename>",
+               "Set filename to record progress of actuators tests.");
+    addCommand("@test-settings", _guardBatch(&M1M3SScli::testSettings), "III", 0,
                "<duration> <force-pause> <pressure-pause>",
                "Sets test parameters. Duration specifies for how long will data "
                "be recorded, -pause tells "
                "CLI delays to take after force or pressure telemetry.");
 
-    addCommand("saa-offset", std::bind(&M1M3SScli::setSAAOffset, this, std::placeholders::_1), "Ds?",
-               NEED_FPGA, "<primary> <ILC..>", "Set ILC primary force offset");
-    addCommand("saa-test", std::bind(&M1M3SScli::testSAA, this, std::placeholders::_1), "Ds?", NEED_FPGA,
+    addCommand("saa-offset", _guardBatch(&M1M3SScli::setSAAOffset), "Ds?", NEED_FPGA, "<primary> <ILC..>",
+               "Set ILC primary force offset");
+    addCommand("saa-test", _guardBatch(&M1M3SScli::testSAA), "Ds?", NEED_FPGA,
                "<primary> <ILC..>", "Set force, readout force and pressure for 3 seconds");
 
-    addCommand("daa-offset", std::bind(&M1M3SScli::setDAAOffset, this, std::placeholders::_1), "DDs?",
-               NEED_FPGA, "<primary> <secondary> <ILC..>", "Set ILC primary and secondary force offsets");
-    addCommand("daa-test", std::bind(&M1M3SScli::testDAA, this, std::placeholders::_1), "DDs?", NEED_FPGA,
+    addCommand("daa-offset", _guardBatch(&M1M3SScli::setDAAOffset), "DDs?", NEED_FPGA,
+               "<primary> <secondary> <ILC..>", "Set ILC primary and secondary force offsets");
+    addCommand("daa-test", _guardBatch(&M1M3SScli::testDAA), "DDs?", NEED_FPGA,
                "<primary> <secondary> <ILC..>", "Set force, readout force and pressure for 3 seconds");
 
-    addCommand("set-calibration", std::bind(&M1M3SScli::setCalibration, this, std::placeholders::_1), "IDDS",
-               NEED_FPGA, "<channel> <offset> <sensitivity> <ILC>", "Write calibration data");
+    addCommand("set-calibration", _guardBatch(&M1M3SScli::setCalibration), "IDDS", NEED_FPGA,
+               "<channel> <offset> <sensitivity> <ILC>", "Write calibration data");
+
+    addCommand("@script", _guardBatch(&M1M3SScli::runScript), "Si", 0, "<filename> [repeat]",
+               "Runs commands from file, one command per line. Empty lines and lines starting with # are "
+               "ignored. Stops on the first failed command.");
+    addCommand("@repeat", _guardBatch(&M1M3SScli::repeatCommand), "Is?", 0,
+               "<count> <command> [arguments..]", "Repeats command count times");
+    addCommand("@timing", _guardBatch(&M1M3SScli::setTiming), "b", 0, "<0|1>",
+               "Prints duration of script and repeated commands");
+    addCommand("@begin", _guardBatch(&M1M3SScli::beginBatch), "", 0, NULL,
+               "Starts batch. ILC and FPGA commands are queued until @commit. Commands which cannot be "
+               "queued and failed commands abort the batch");
+    addCommand("@commit", _guardBatch(&M1M3SScli::commitBatch), "", NEED_FPGA, NULL,
+               "Sends queued FPGA commands and runs queued ILC commands as a single Modbus program");
+
+    addCommand("audit", _guardBatch(&M1M3SScli::auditILCs), "Sss", NEED_FPGA,
+               "<calibration|dca-gain|pressure> [output.csv] [reference.csv]",
+               "Reads calibration, DCA gains or mezzanine pressures from all force actuator ILCs. Requests "
+               "for all subnets are sent in a single run, ILCs which didn't respond are retried. Prints or "
+               "saves CSV table, optionally compared with previously saved table.");
 
     addILC(std::make_shared<PrintElectromechanical>(1));
     addILC(std::make_shared<PrintElectromechanical>(2));
@@ -247,7 +341,7 @@ int M1M3SScli::setPower(command_vec cmds) {
                        FPGAAddresses::DCAuxPowerNetworkCOn, aux, FPGAAddresses::DCAuxPowerNetworkDOn, aux,
                        FPGAAddresses::DCPowerNetworkAOn,    net, FPGAAddresses::DCPowerNetworkBOn,    net,
                        FPGAAddresses::DCPowerNetworkCOn,    net, FPGAAddresses::DCPowerNetworkDOn,    net};
-    getFPGA()->writeCommandFIFO(pa, 16, 0);
+    _writeCommandFIFO(pa, 16);
 
     _printSupportData();
     return 0;
@@ -257,7 +351,7 @@ int M1M3SScli::setAir(command_vec cmds) {
     if (cmds.size() == 1) {
         uint16_t on = CliApp::onOff(cmds[0]);
         uint16_t aa[2] = {FPGAAddresses::AirSupplyValveControl, on};
-        getFPGA()->writeCommandFIFO(aa, 2, 0);
+        _writeCommandFIFO(aa, 2);
     }
 
     _printSupportData();
@@ -268,7 +362,7 @@ int M1M3SScli::setLights(command_vec cmds) {
     if (cmds.size() == 1) {
         uint16_t on = CliApp::onOff(cmds[0]);
         uint16_t aa[2] = {FPGAAddresses::MirrorCellLightControl, on};
-        getFPGA()->writeCommandFIFO(aa, 2, 0);
+        _writeCommandFIFO(aa, 2);
     }
 
     _printSupportData();
@@ -281,12 +375,12 @@ int M1M3SScli::setDCAGain(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 2);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     for (auto u : ilcs) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setDCAGain(u.second, primary, secondary);
     }
-    runILCCommands(500);
+    _runILCCommands();
     return 0;
 }
 
@@ -327,13 +421,13 @@ int M1M3SScli::setSAAOffset(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 1);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     for (auto u : ilcs) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setSAAForceOffset(u.second, false,
                                                                                       primary);
     }
-    runILCCommands(500);
+    _runILCCommands();
     return 0;
 }
 
@@ -349,13 +443,13 @@ int M1M3SScli::setDAAOffset(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 2);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     for (auto u : ilcs) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setDAAForceOffset(u.second, false,
                                                                                       primary, secondary);
     }
-    runILCCommands(500);
+    _runILCCommands();
     return 0;
 }
 
@@ -371,7 +465,7 @@ int M1M3SScli::setCalibration(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 3);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     if (ilcs.size() != 1) {
         std::cerr << "Calibration data can be set only for a single ILC." << std::endl;
@@ -381,11 +475,15 @@ int M1M3SScli::setCalibration(command_vec cmds) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setOffsetAndSensitivity(
                 u.second, channel, offset, sensitivity);
     }
-    runILCCommands(500);
+    _runILCCommands();
     return 0;
 }
 
 int M1M3SScli::testSAA(command_vec cmds) {
+    if (_rejectInBatch("saa-test")) {
+        return -1;
+    }
+
     float primary = stof(cmds[0]);
 
     if (fabs(primary) > MAX_FORCE) {
@@ -396,13 +494,13 @@ int M1M3SScli::testSAA(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 1);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     for (auto u : ilcs) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setSAAForceOffset(u.second, false,
                                                                                       primary);
     }
-    runILCCommands(500);
+    runILCCommands(ILC_TIMEOUT);
 
     _report_pressure_forces(ilcs);
 
@@ -410,6 +508,10 @@ int M1M3SScli::testSAA(command_vec cmds) {
 }
 
 int M1M3SScli::testDAA(command_vec cmds) {
+    if (_rejectInBatch("daa-test")) {
+        return -1;
+    }
+
     float primary = stof(cmds[0]);
     float secondary = stof(cmds[1]);
 
@@ -421,19 +523,380 @@ int M1M3SScli::testDAA(command_vec cmds) {
 
     cmds.erase(cmds.begin(), cmds.begin() + 2);
 
-    clearILCs();
+    _clearILCs();
     ILCUnits ilcs = getILCs(cmds);
     for (auto u : ilcs) {
         std::dynamic_pointer_cast<PrintElectromechanical>(u.first)->setDAAForceOffset(u.second, false,
                                                                                       primary, secondary);
     }
-    runILCCommands(500);
+    runILCCommands(ILC_TIMEOUT);
 
     _report_pressure_forces(ilcs);
 
     return 0;
 }
 
+int M1M3SScli::runScript(command_vec cmds) {
+    int repeat = cmds.size() > 1 ? std::stoi(cmds[1]) : 1;
+
+    std::vector<std::pair<int, command_vec>> script;
+
+    std::ifstream file(cmds[0]);
+    if (!file.good()) {
+        std::cerr << "Cannot open script " << cmds[0] << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        std::istringstream tokens(line);
+        command_vec lineCmds;
+        std::string token;
+        while (tokens >> token) {
+            lineCmds.push_back(token);
+        }
+        if (lineCmds.empty() || lineCmds[0][0] == '#') {
+            continue;
+        }
+        script.push_back(std::make_pair(lineNumber, lineCmds));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int r = 0; r < repeat; r++) {
+        for (auto& l : script) {
+            int ret = _runTimed(l.second);
+            if (ret != 0) {
+                std::cerr << cmds[0] << ":" << l.first << ": " << l.second[0] << " failed (" << ret
+                          << "), script terminated." << std::endl;
+                if (_batch) {
+                    _abortBatch("script failed");
+                }
+                return ret;
+            }
+        }
+    }
+
+    if (_timing) {
+        std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        std::cout << "Script " << cmds[0] << " " << repeat << "x " << script.size() << " commands: "
+                  << std::setprecision(3) << std::fixed << duration.count() << " s" << std::endl;
+    }
+
+    return 0;
+}
+
+int M1M3SScli::repeatCommand(command_vec cmds) {
+    int count = std::stoi(cmds[0]);
+    if (cmds.size() < 2) {
+        std::cerr << "Missing command to repeat." << std::endl;
+        return -1;
+    }
+
+    cmds.erase(cmds.begin());
+
+    for (int i = 0; i < count; i++) {
+        int ret = _runTimed(cmds);
+        if (ret != 0) {
+            std::cerr << cmds[0] << " failed (" << ret << ") in " << (i + 1) << ". repetition." << std::endl;
+            return ret;
+        }
+    }
+    return 0;
+}
+
+int M1M3SScli::setTiming(command_vec cmds) {
+    if (cmds.size() == 1) {
+        _timing = CliApp::onOff(cmds[0]);
+    }
+    std::cout << "Timing: " << (_timing ? "on" : "off") << std::endl;
+    return 0;
+}
+
+int M1M3SScli::beginBatch(command_vec cmds) {
+    if (_batch) {
+        std::cerr << "Batch already started, " << _batchedILCCommands << " ILC and "
+                  << _batchedFPGACommands.size() << " FPGA command words queued." << std::endl;
+        return -1;
+    }
+    clearILCs();
+    _batchedILCCommands = 0;
+    _batchedFPGACommands.clear();
+    _batch = true;
+    return 0;
+}
+
+int M1M3SScli::commitBatch(command_vec cmds) {
+    if (_batch == false) {
+        std::cerr << "Batch not started, use @begin first." << std::endl;
+        return -1;
+    }
+    _batch = false;
+
+    if (_batchedFPGACommands.empty() == false) {
+        getFPGA()->writeCommandFIFO(_batchedFPGACommands.data(), _batchedFPGACommands.size(), 0);
+        _batchedFPGACommands.clear();
+        _printSupportData();
+    }
+
+    int batchedILCCommands = _batchedILCCommands;
+    _batchedILCCommands = 0;
+    if (batchedILCCommands > 0) {
+        runILCCommands(ILC_TIMEOUT * batchedILCCommands);
+    }
+    clearILCs();
+    return 0;
+}
+
+int M1M3SScli::auditILCs(command_vec cmds) {
+    if (_rejectInBatch("audit")) {
+        return -1;
+    }
+
+    ILCAudit audit;
+    std::function<void(std::shared_ptr<PrintElectromechanical>, uint8_t)> request;
+
+    if (cmds[0] == "calibration") {
+        for (auto set : {"Main", "Backup"}) {
+            for (auto name : {"ADCK", "Offset", "Sensitivity"}) {
+                for (int i = 1; i <= 4; i++) {
+                    audit.columns.push_back(std::string(set) + name + std::to_string(i));
+                }
+            }
+        }
+        request = [](std::shared_ptr<PrintElectromechanical> ilc, uint8_t address) {
+            ilc->reportCalibrationData(address);
+        };
+    } else if (cmds[0] == "dca-gain") {
+        audit.columns = {"PrimaryGain", "SecondaryGain"};
+        request = [](std::shared_ptr<PrintElectromechanical> ilc, uint8_t address) {
+            ilc->reportDCAGain(address);
+        };
+    } else if (cmds[0] == "pressure") {
+        audit.columns = {"PrimaryPush", "PrimaryPull", "SecondaryPush", "SecondaryPull"};
+        request = [](std::shared_ptr<PrintElectromechanical> ilc, uint8_t address) {
+            ilc->reportMezzaninePressure(address);
+        };
+    } else {
+        std::cerr << "Unknown audit " << cmds[0] << ", expected calibration, dca-gain or pressure."
+                  << std::endl;
+        return -1;
+    }
+
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    std::vector<int> pending;
+    for (int i = 0; i < FA_COUNT; i++) {
+        pending.push_back(i);
+    }
+
+    _audit = &audit;
+
+    // requests for all subnets are queued and sent by a single
+    // runILCCommands call (which processes subnets one after another); only
+    // ILCs which didn't respond are retried
+    for (int attempt = 1; attempt <= AUDIT_RETRIES + 1 && pending.empty() == false; attempt++) {
+        clearILCs();
+        for (auto i : pending) {
+            ForceActuatorTableRow row = faa_settings.Table[i];
+            request(std::dynamic_pointer_cast<PrintElectromechanical>(getILC(row.Subnet - 1)), row.Address);
+        }
+        try {
+            runILCCommands(ILC_TIMEOUT);
+        } catch (std::exception& ex) {
+            std::cerr << "Attempt " << attempt << ": " << ex.what() << std::endl;
+        }
+
+        std::vector<int> failed;
+        for (auto i : pending) {
+            ForceActuatorTableRow row = faa_settings.Table[i];
+            if (audit.values.count(std::make_pair(row.Subnet, row.Address)) == 0) {
+                failed.push_back(i);
+            }
+        }
+        std::cerr << "Attempt " << attempt << ": " << (pending.size() - failed.size()) << " of "
+                  << pending.size() << " ILCs responded, " << audit.values.size() << "/" << FA_COUNT
+                  << " done." << std::endl;
+        pending = failed;
+    }
+
+    _audit = nullptr;
+    clearILCs();
+
+    for (auto i : pending) {
+        ForceActuatorTableRow row = faa_settings.Table[i];
+        std::cerr << "No response from " << row.ActuatorID << " (" << row.Subnet << "/" << row.Address
+                  << ")" << std::endl;
+    }
+
+    std::ofstream file;
+    if (cmds.size() > 1 && cmds[1] != "-") {
+        file.open(cmds[1], std::ofstream::out);
+        if (!file.good()) {
+            std::cerr << "Cannot open " << cmds[1] << ": " << strerror(errno) << std::endl;
+            return -1;
+        }
+    }
+    std::ostream& out = file.is_open() ? file : std::cout;
+
+    out << "ID,Bus,Address";
+    for (auto& c : audit.columns) {
+        out << "," << c;
+    }
+    out << std::endl;
+    for (int i = 0; i < FA_COUNT; i++) {
+        ForceActuatorTableRow row = faa_settings.Table[i];
+        auto values = audit.values.find(std::make_pair(row.Subnet, row.Address));
+        if (values == audit.values.end()) {
+            continue;
+        }
+        out << row.ActuatorID << "," << row.Subnet << "," << row.Address << std::setprecision(10);
+        for (auto v : values->second) {
+            out << "," << v;
+        }
+        out << std::endl;
+    }
+
+    int ret = pending.empty() ? 0 : -1;
+
+    if (cmds.size() > 2) {
+        int diff = _diffAudit(audit, cmds[2]);
+        if (diff != 0) {
+            ret = diff;
+        }
+    }
+
+    return ret;
+}
+
+int M1M3SScli::_diffAudit(const ILCAudit& audit, const std::string& reference) {
+    std::ifstream file(reference);
+    if (!file.good()) {
+        std::cerr << "Cannot open reference " << reference << ": " << strerror(errno) << std::endl;
+        return -1;
+    }
+
+    auto split = [](const std::string& line) {
+        std::vector<std::string> ret;
+        std::istringstream tokens(line);
+        std::string token;
+        while (std::getline(tokens, token, ',')) {
+            ret.push_back(token);
+        }
+        return ret;
+    };
+
+    std::string line;
+    std::getline(file, line);
+    auto header = split(line);
+    if (header.size() != audit.columns.size() + 3) {
+        std::cerr << "Reference " << reference << " has " << header.size() << " columns, expected "
+                  << (audit.columns.size() + 3) << "." << std::endl;
+        return -1;
+    }
+
+    int differences = 0;
+    int lineNumber = 1;
+    while (std::getline(file, line)) {
+        lineNumber++;
+        auto fields = split(line);
+        if (fields.empty()) {
+            continue;
+        }
+        if (fields.size() != header.size()) {
+            std::cerr << reference << ":" << lineNumber << ": expected " << header.size() << " values, got "
+                      << fields.size() << std::endl;
+            return -1;
+        }
+        auto values = audit.values.find(std::make_pair(std::stoi(fields[1]), std::stoi(fields[2])));
+        if (values == audit.values.end()) {
+            continue;
+        }
+        for (size_t c = 0; c < audit.columns.size(); c++) {
+            float ref = std::stof(fields[c + 3]);
+            float measured = values->second[c];
+            if (std::fabs(measured - ref) > 1e-6 * std::max(1.0f, std::fabs(ref))) {
+                std::cout << "DIFF " << fields[0] << " " << audit.columns[c] << ": " << std::setprecision(10)
+                          << ref << " -> " << measured << std::endl;
+                differences++;
+            }
+        }
+    }
+
+    std::cout << "Found " << differences << " difference(s) to " << reference << std::endl;
+    return differences > 0 ? 1 : 0;
+}
+
+int M1M3SScli::_runTimed(command_vec cmds) {
+    auto start = std::chrono::steady_clock::now();
+    int ret = processCmdVector(cmds);
+    if (_timing) {
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        std::cout << cmds[0] << ": " << std::setprecision(3) << std::fixed << duration.count() << " ms"
+                  << std::endl;
+    }
+    return ret;
+}
+
+void M1M3SScli::_clearILCs() {
+    if (_batch) {
+        _batchILCCommand = true;
+    } else {
+        clearILCs();
+    }
+}
+
+void M1M3SScli::_runILCCommands() {
+    if (_batch) {
+        _batchILCCommand = false;
+        _batchedILCCommands++;
+    } else {
+        runILCCommands(ILC_TIMEOUT);
+    }
+}
+
+void M1M3SScli::_writeCommandFIFO(uint16_t* data, size_t length) {
+    if (_batch) {
+        _batchedFPGACommands.insert(_batchedFPGACommands.end(), data, data + length);
+    } else {
+        getFPGA()->writeCommandFIFO(data, length, 0);
+    }
+}
+
+bool M1M3SScli::_rejectInBatch(const char* command) {
+    if (_batch) {
+        std::cerr << command << " cannot be run in batch, @commit the batch first." << std::endl;
+    }
+    return _batch;
+}
+
+void M1M3SScli::_abortBatch(const char* reason) {
+    std::cerr << "Batch aborted (" << reason << "), " << _batchedILCCommands << " ILC and "
+              << _batchedFPGACommands.size() << " FPGA command words discarded." << std::endl;
+    _batch = false;
+    _batchILCCommand = false;
+    _batchedILCCommands = 0;
+    _batchedFPGACommands.clear();
+    clearILCs();
+}
+
+std::function<int(command_vec)> M1M3SScli::_guardBatch(int (M1M3SScli::*command)(command_vec)) {
+    return [this, command](command_vec cmds) -> int {
+        try {
+            int ret = (this->*command)(cmds);
+            // command could return before queueing its ILC commands
+            _batchILCCommand = false;
+            return ret;
+        } catch (...) {
+            if (_batch) {
+                _abortBatch("command failed");
+            }
+            throw;
+        }
+    };
+}
+
 class ReadRawAccelerometer : public Thread {
 public:
     ReadRawAccelerometer(FPGAClass* _fpga) { fpga = _fpga; }
@@ -501,6 +964,13 @@ LSST::cRIO::FPGA* M1M3SScli::newFPGA(const char* dir, bool& fpga_singleton) {
 constexpr int ILC_BUS = 5;
 
 ILCUnits M1M3SScli::getILCs(command_vec cmds) {
+    // ILC commands inherited from FPGACliApp clear and run ILC commands on
+    // their own - that would discard or send the queued commands
+    if (_batch && _batchILCCommand == false) {
+        _abortBatch("ILC command cannot be queued");
+        throw std::runtime_error("This ILC command cannot be run in batch, @commit the batch first.");
+    }
+
     ILCUnits units;
     int ret = -2;
 
@@ -609,6 +1079,10 @@ ILCUnits M1M3SScli::getILCs(command_vec cmds) {
 }
 
 void M1M3SScli::_printSupportData() {
+    if (_batch) {
+        return;
+    }
+
     dynamic_cast<FPGAClass*>(getFPGA())->pullTelemetry();
     SupportFPGAData* fpgaData = dynamic_cast<FPGAClass*>(getFPGA())->getSupportFPGAData();
 
@@ -649,7 +1123,7 @@ void M1M3SScli::_report_pressure_forces(ILCUnits& ilcs) {
                         u.second);
             }
         }
-        runILCCommands(500);
+        runILCCommands(ILC_TIMEOUT);
 
         show_press = !show_press;
     }
@@ -691,6 +1165,11 @@ void PrintElectromechanical::processStepperForceStatus(uint8_t address, uint8_t
 }
 
 void PrintElectromechanical::processDCAGain(uint8_t address, float primaryGain, float secondaryGain) {
+    if (_audit != nullptr) {
+        _audit->values[std::make_pair(getBus(), address)] = {primaryGain, secondaryGain};
+        return;
+    }
+
     _printSepline();
 
     std::cout << "Primary (axial) gain: " << primaryGain << std::endl;
@@ -750,6 +1229,15 @@ void PrintElectromechanical::processDAAForceStatus(uint8_t address, uint8_t stat
 void PrintElectromechanical::processCalibrationData(uint8_t address, float mainADCK[4], float mainOffset[4],
                                                     float mainSensitivity[4], float backupADCK[4],
                                                     float backupOffset[4], float backupSensitivity[4]) {
+    if (_audit != nullptr) {
+        auto& values = _audit->values[std::make_pair(getBus(), address)];
+        values.clear();
+        for (auto a : {mainADCK, mainOffset, mainSensitivity, backupADCK, backupOffset, backupSensitivity}) {
+            values.insert(values.end(), a, a + 4);
+        }
+        return;
+    }
+
     _printSepline();
     std::cout << "Calibration data " << std::to_string(getBus()) << "/" << std::to_string(address)
               << std::endl;
@@ -768,6 +1256,12 @@ void PrintElectromechanical::processCalibrationData(uint8_t address, float mainA
 
 void PrintElectromechanical::processMezzaninePressure(uint8_t address, float primaryPush, float primaryPull,
                                                       float secondaryPush, float secondaryPull) {
+    if (_audit != nullptr) {
+        _audit->values[std::make_pair(getBus(), address)] = {primaryPush, primaryPull, secondaryPush,
+                                                             secondaryPull};
+        return;
+    }
+
     _printSepline();
     std::cout << "Pressure data " << std::to_string(getBus()) << "/" << std::to_string(address) << std::endl;
 
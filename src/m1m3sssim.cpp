@@ -0,0 +1,450 @@
+/*
+ * This file is part of LSST M1M3 support system package.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <getopt.h>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+#include <SAL_MTM1M3.h>
+
+#include <cRIO/DataTypes.h>
+
+#include "Context.h"
+#include "EnableCommand.h"
+#include "EnterControlCommand.h"
+#include "ForceActuatorData.h"
+#include "ForceActuatorSettings.h"
+#include "LowerM1M3Command.h"
+#include "M1M3SSPublisher.h"
+#include "PositionControllerSettings.h"
+#include "RaiseM1M3Command.h"
+#include "SettingReader.h"
+#include "SimulatedFPGA.h"
+#include "StartCommand.h"
+#include "UpdateCommand.h"
+
+#ifndef SIMULATOR
+#error m1m3sssim requires simulated FPGA, build it with SIMULATOR=1
+#endif
+
+using namespace LSST::M1M3::SS;
+
+extern const char* VERSION;
+
+//* simulated outer loop period, in seconds
+constexpr double OUTER_LOOP_PERIOD = 0.020;
+
+//* simulated time spent in Parked state before the mirror is raised, in seconds
+constexpr double PARKED_SETTLE = 1.0;
+
+/**
+ * Tuned parameter. Sets the parameter value in loaded settings, so it's
+ * used by the following raise and lower.
+ */
+struct Parameter {
+    const char* name;
+    void (*set)(double value);
+};
+
+const Parameter PARAMETERS[] = {
+        {"RaiseIncrementPercentage",
+         [](double v) { ForceActuatorSettings::instance().raiseIncrementPercentage = v; }},
+        {"LowerDecrementPercentage",
+         [](double v) { ForceActuatorSettings::instance().lowerDecrementPercentage = v; }},
+        {"RaiseLowerFollowingErrorLimit",
+         [](double v) { ForceActuatorSettings::instance().raiseLowerFollowingErrorLimit = v; }},
+        {"MaxStepsPerLoop", [](double v) { PositionControllerSettings::instance().maxStepsPerLoop = v; }},
+        {"RaiseHPForceLimitLow",
+         [](double v) { PositionControllerSettings::instance().raiseHPForceLimitLow = v; }},
+        {"RaiseHPForceLimitHigh",
+         [](double v) { PositionControllerSettings::instance().raiseHPForceLimitHigh = v; }},
+        {"LowerHPForceLimitLow",
+         [](double v) { PositionControllerSettings::instance().lowerHPForceLimitLow = v; }},
+        {"LowerHPForceLimitHigh",
+         [](double v) { PositionControllerSettings::instance().lowerHPForceLimitHigh = v; }},
+        {"RaiseLowerProfileEnabled",
+         [](double v) { PositionControllerSettings::instance().raiseLowerProfileEnabled = v != 0; }},
+        {"RaiseLowerProfileMaxFactor",
+         [](double v) { PositionControllerSettings::instance().raiseLowerProfileMaxFactor = v; }},
+        {"RaiseLowerProfileLowUtilization",
+         [](double v) { PositionControllerSettings::instance().raiseLowerProfileLowUtilization = v; }},
+        {"RaiseLowerProfileHighUtilization",
+         [](double v) { PositionControllerSettings::instance().raiseLowerProfileHighUtilization = v; }},
+};
+
+//* parameter with values to try
+struct Axis {
+    const Parameter* parameter;
+    std::vector<double> values;
+};
+
+//* outcome of a single raise or lower
+struct PhaseResult {
+    bool completed = false;
+    double duration = NAN;
+    double peakHPForce = 0;
+    double peakFollowingError = 0;
+};
+
+void printHelp() {
+    std::cout << "Runs M1M3 raise and lower on simulated FPGA, without real time pacing, for all "
+                 "combinations of given parameters values. Prints CSV with raise/lower durations, peak "
+                 "hardpoint forces and peak force actuators following errors."
+              << std::endl
+              << "Version: " << VERSION << std::endl
+              << "Usage: m1m3sssim [options] <parameter>=<value>[,<value>..] .." << std::endl
+              << "Options:" << std::endl
+              << "  -c <configuration path> use given configuration directory (should be SettingFiles)"
+              << std::endl
+              << "  -C <configuration> configuration override passed to start command (default Default)"
+              << std::endl
+              << "  -d increases debugging (can be specified multiple times, default is warning)"
+              << std::endl
+              << "  -h prints this help" << std::endl
+              << "  -j <jobs> number of combinations simulated in parallel (default 1)" << std::endl
+              << "Parameters:" << std::endl;
+    for (auto& p : PARAMETERS) {
+        std::cout << "  " << p.name << std::endl;
+    }
+}
+
+int debugLevel = 0;
+
+Axis parseAxis(const char* arg) {
+    const char* eq = strchr(arg, '=');
+    if (eq == NULL) {
+        throw std::runtime_error(fmt::format("Expected <parameter>=<values>, got {}", arg));
+    }
+    std::string name(arg, eq - arg);
+    Axis axis{NULL, {}};
+    for (auto& p : PARAMETERS) {
+        if (name == p.name) {
+            axis.parameter = &p;
+        }
+    }
+    if (axis.parameter == NULL) {
+        throw std::runtime_error(fmt::format("Unknown parameter {}", name));
+    }
+    std::istringstream values(eq + 1);
+    std::string value;
+    while (std::getline(values, value, ',')) {
+        size_t end;
+        axis.values.push_back(std::stod(value, &end));
+        if (end != value.length()) {
+            throw std::runtime_error(fmt::format("Invalid {} value: {}", name, value));
+        }
+    }
+    if (axis.values.empty()) {
+        throw std::runtime_error(fmt::format("No values for {}", name));
+    }
+    return axis;
+}
+
+/**
+ * Returns parameters values for given combination. The first axis changes
+ * slowest.
+ */
+std::vector<double> combination(const std::vector<Axis>& axes, size_t index) {
+    std::vector<double> ret(axes.size());
+    for (size_t a = axes.size(); a > 0; a--) {
+        auto& values = axes[a - 1].values;
+        ret[a - 1] = values[index % values.size()];
+        index /= values.size();
+    }
+    return ret;
+}
+
+void runCommand(Command* command) {
+    if (command->validate() == false) {
+        throw std::runtime_error(fmt::format("Command {} rejected", command->getCommandID()));
+    }
+    command->ackInProgress();
+    command->execute();
+    command->ackComplete();
+    delete command;
+}
+
+/**
+ * Runs outer loop until target state is reached, mirror faults or timeout
+ * (in simulated seconds) expires. Tracks peak hardpoint forces and following
+ * errors.
+ */
+PhaseResult runUntil(States::Type target, double timeout) {
+    auto& fpga = IFPGA::get();
+    auto hardpointData = M1M3SSPublisher::instance().getHardpointActuatorData();
+    auto appliedForces = M1M3SSPublisher::instance().getAppliedForces();
+    auto& faData = ForceActuatorData::instance();
+    std::mutex updateMutex;
+
+    auto peak = [](double& current, double value) { current = std::max(current, std::fabs(value)); };
+
+    PhaseResult result;
+    int cycles = 0;
+    int maxCycles = std::ceil(timeout / OUTER_LOOP_PERIOD);
+
+    while (cycles < maxCycles) {
+        fpga.waitForOuterLoopClock(25);
+        {
+            UpdateCommand update(&updateMutex);
+            update.execute();
+        }
+        fpga.ackOuterLoopClock();
+        cycles++;
+
+        for (int i = 0; i < HP_COUNT; i++) {
+            peak(result.peakHPForce, hardpointData->measuredForce[i]);
+        }
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (i < FA_X_COUNT) {
+                peak(result.peakFollowingError, faData.xForce[i] - appliedForces->xForces[i]);
+            }
+            if (i < FA_Y_COUNT) {
+                peak(result.peakFollowingError, faData.yForce[i] - appliedForces->yForces[i]);
+            }
+            peak(result.peakFollowingError, faData.zForce[i] - appliedForces->zForces[i]);
+        }
+
+        auto state = Context::instance().getCurrentState();
+        if (state == target) {
+            result.completed = true;
+            break;
+        }
+        if ((state >> 32) == MTM1M3::MTM1M3_shared_SummaryStates_FaultState) {
+            SPDLOG_WARN("Mirror faulted after {:.2f} s", cycles * OUTER_LOOP_PERIOD);
+            break;
+        }
+    }
+    result.duration = cycles * OUTER_LOOP_PERIOD;
+    return result;
+}
+
+std::string formatResult(const PhaseResult& result) {
+    return fmt::format("{},{:.2f},{:.1f},{:.1f}", result.completed ? "OK" : "FAIL", result.duration,
+                       result.peakHPForce, result.peakFollowingError);
+}
+
+/**
+ * Simulates single combination. Runs in its own process, as the controller
+ * is built from singletons.
+ *
+ * @return CSV formatted raise and lower results
+ */
+std::string simulate(const std::vector<Axis>& axes, const std::vector<double>& values,
+                     const char* configRoot, const char* configuration) {
+    SettingReader::instance().setRootPath(configRoot);
+    std::shared_ptr<SAL_MTM1M3> m1m3SAL = std::make_shared<SAL_MTM1M3>();
+    M1M3SSPublisher::instance().setSAL(m1m3SAL);
+
+    auto& fpga = dynamic_cast<SimulatedFPGA&>(IFPGA::get());
+    fpga.setRealTime(false);
+    fpga.initialize();
+    fpga.open();
+
+    runCommand(new EnterControlCommand());
+    MTM1M3_command_startC startData;
+    startData.configurationOverride = configuration;
+    runCommand(new StartCommand(1, &startData));
+    runCommand(new EnableCommand(2));
+
+    for (size_t a = 0; a < axes.size(); a++) {
+        axes[a].parameter->set(values[a]);
+    }
+
+    // NoStateTransition is never reached, so this just runs the outer loop in Parked state
+    runUntil(States::NoStateTransition, PARKED_SETTLE);
+
+    MTM1M3_command_raiseM1M3C raiseData;
+    raiseData.bypassReferencePosition = false;
+    runCommand(new RaiseM1M3Command(3, &raiseData));
+    auto raise = runUntil(States::ActiveState, PositionControllerSettings::instance().raiseTimeout);
+
+    PhaseResult lower;
+    if (raise.completed) {
+        runCommand(new LowerM1M3Command(4));
+        lower = runUntil(States::ParkedState, PositionControllerSettings::instance().lowerTimeout);
+    }
+
+    fpga.close();
+    fpga.finalize();
+    m1m3SAL->salShutdown();
+
+    return formatResult(raise) + "," + formatResult(lower);
+}
+
+struct Job {
+    size_t index;
+    int fd;
+};
+
+int main(int argc, char* const argv[]) {
+    const char* configRoot = "/var/lib/M1M3support";
+    const char* configuration = "Default";
+    int jobs = 1;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:C:dhj:")) != -1) {
+        switch (opt) {
+            case 'c':
+                configRoot = optarg;
+                break;
+            case 'C':
+                configuration = optarg;
+                break;
+            case 'd':
+                debugLevel++;
+                break;
+            case 'h':
+                printHelp();
+                exit(EXIT_SUCCESS);
+            case 'j':
+                jobs = std::max(1, atoi(optarg));
+                break;
+            default:
+                printHelp();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    std::vector<Axis> axes;
+    size_t count = 1;
+    try {
+        for (int i = optind; i < argc; i++) {
+            axes.push_back(parseAxis(argv[i]));
+            count *= axes.back().values.size();
+        }
+    } catch (std::exception& ex) {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    spdlog::set_default_logger(spdlog::stderr_color_mt("m1m3sssim"));
+    spdlog::set_level(debugLevel == 0 ? spdlog::level::warn
+                                      : (debugLevel == 1 ? spdlog::level::info : spdlog::level::debug));
+
+    for (auto& axis : axes) {
+        std::cout << axis.parameter->name << ",";
+    }
+    std::cout << "raise,raiseDuration,raisePeakHPForce,raisePeakFollowingError,"
+                 "lower,lowerDuration,lowerPeakHPForce,lowerPeakFollowingError"
+              << std::endl;
+
+    // each combination runs in a forked process - results are collected via
+    // pipe and printed in combination order
+    std::vector<std::string> results(count);
+    std::map<pid_t, Job> running;
+    size_t next = 0;
+    size_t printed = 0;
+
+    while (printed < count) {
+        while (next < count && static_cast<int>(running.size()) < jobs) {
+            int fds[2];
+            if (pipe(fds) == -1) {
+                std::cerr << "Error: Cannot create pipe: " << strerror(errno) << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            pid_t child = fork();
+            if (child < 0) {
+                std::cerr << "Error: Cannot fork: " << strerror(errno) << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            if (child == 0) {
+                close(fds[0]);
+                std::string result;
+                try {
+                    result = simulate(axes, combination(axes, next), configRoot, configuration);
+                } catch (std::exception& ex) {
+                    SPDLOG_ERROR("Combination {}: {}", next, ex.what());
+                    result = "ERROR,,,,ERROR,,,";
+                }
+                const char* data = result.c_str();
+                size_t remaining = result.length();
+                while (remaining > 0) {
+                    ssize_t written = write(fds[1], data, remaining);
+                    if (written < 0) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+                        SPDLOG_ERROR("Combination {}: cannot write result: {}", next, strerror(errno));
+                        close(fds[1]);
+                        return EXIT_FAILURE;
+                    }
+                    data += written;
+                    remaining -= written;
+                }
+                close(fds[1]);
+                return EXIT_SUCCESS;
+            }
+            close(fds[1]);
+            running[child] = Job{next, fds[0]};
+            next++;
+        }
+
+        int status;
+        pid_t child = wait(&status);
+        if (child < 0) {
+            std::cerr << "Error: Cannot wait for child: " << strerror(errno) << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        auto job = running.find(child);
+        if (job == running.end()) {
+            continue;
+        }
+
+        char buf[512];
+        ssize_t len;
+        std::string& result = results[job->second.index];
+        while ((len = read(job->second.fd, buf, sizeof(buf))) > 0) {
+            result.append(buf, len);
+        }
+        close(job->second.fd);
+        if (result.empty()) {
+            result = "CRASH,,,,CRASH,,,";
+        }
+        running.erase(job);
+
+        // print finished results in order
+        while (printed < count && results[printed].empty() == false) {
+            for (auto v : combination(axes, printed)) {
+                std::cout << v << ",";
+            }
+            std::cout << results[printed] << std::endl;
+            printed++;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -267,9 +267,11 @@ spdlog::level::level_enum getSpdLogLogLevel() {
 }
 
 void setSinks() {
+    // real-time threads shall never block on logging - when the queue is
+    // full, the oldest messages are dropped (and counted by the thread pool)
     auto logger = std::make_shared<spdlog::async_logger>("M1M3support", sinks.begin(), sinks.end(),
                                                          spdlog::thread_pool(),
-                                                         spdlog::async_overflow_policy::block);
+                                                         spdlog::async_overflow_policy::overrun_oldest);
     spdlog::set_default_logger(logger);
     spdlog::set_level(getSpdLogLogLevel());
 }
@@ -371,7 +373,8 @@ int main(int argc, char* const argv[]) {
     m1m3SAL->setDebugLevel(debugLevelSAL);
 
     if (enabledSinks & 0x10) {
-        sinks.push_back(std::make_shared<SALSink_mt>(m1m3SAL));
+        auto salSink = std::make_shared<SALSink>(m1m3SAL, spdlog::thread_pool());
+        sinks.push_back(salSink);
         setSinks();
         SPDLOG_INFO("Enabled SAL logger");
     }
@@ -0,0 +1,175 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests AccelerometerFilter.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <AccelerometerFilter.h>
+
+using namespace LSST::M1M3::SS;
+
+using Catch::Matchers::WithinAbs;
+
+constexpr size_t CHANNELS = AccelerometerFilter::CHANNELS;
+
+/**
+ * Returns peak absolute filter output for sine on all channels, after
+ * settling period.
+ */
+double sinePeak(AccelerometerFilter& filter, double sampleRate, double frequency, size_t samples,
+                size_t settle) {
+    std::vector<float> data(samples * CHANNELS);
+    for (size_t s = 0; s < samples; s++) {
+        for (size_t c = 0; c < CHANNELS; c++) {
+            data[s * CHANNELS + c] = sin(2 * M_PI * frequency * s / sampleRate);
+        }
+    }
+
+    filter.process(data.data(), settle);
+
+    double peak = 0;
+    float output[CHANNELS];
+    for (size_t s = settle; s < samples; s++) {
+        filter.process(data.data() + s * CHANNELS, 1);
+        filter.getOutput(output);
+        for (size_t c = 0; c < CHANNELS; c++) {
+            peak = std::max(peak, fabs(output[c]));
+        }
+    }
+    return peak;
+}
+
+TEST_CASE("AccelerometerFilter DC and decimation", "[AccelerometerFilter]") {
+    AccelerometerFilter filter;
+    filter.configure(1000, 10, 4);
+
+    REQUIRE(filter.getSections() == 2);
+
+    float output[CHANNELS];
+    REQUIRE(filter.getOutput(output) == 0);
+
+    // the first sample initializes state - no transient
+    float data[20 * CHANNELS];
+    for (size_t s = 0; s < 20; s++) {
+        for (size_t c = 0; c < CHANNELS; c++) {
+            data[s * CHANNELS + c] = c * 0.5 - 1.0;
+        }
+    }
+    filter.process(data, 20);
+
+    REQUIRE(filter.getOutput(output) == 20);
+    for (size_t c = 0; c < CHANNELS; c++) {
+        REQUIRE_THAT(output[c], WithinAbs(c * 0.5 - 1.0, 1e-5));
+    }
+
+    // output is kept, but no new samples are reported
+    REQUIRE(filter.getOutput(output) == 0);
+    REQUIRE_THAT(output[7], WithinAbs(2.5, 1e-5));
+
+    filter.reset();
+    REQUIRE(filter.getOutput(output) == 0);
+    REQUIRE(output[7] == 0);
+}
+
+TEST_CASE("AccelerometerFilter anti-alias", "[AccelerometerFilter]") {
+    AccelerometerFilter filter;
+    filter.configure(1000, 10, 4);
+
+    // pass band
+    REQUIRE_THAT(sinePeak(filter, 1000, 1, 4000, 2000), WithinAbs(1, 0.01));
+
+    // -3 dB at cutoff
+    filter.reset();
+    REQUIRE_THAT(sinePeak(filter, 1000, 10, 4000, 2000), WithinAbs(M_SQRT1_2, 0.01));
+
+    // vibrations above outer loop Nyquist frequency (25 Hz) are removed
+    filter.reset();
+    REQUIRE(sinePeak(filter, 1000, 100, 4000, 2000) < 2e-4);
+
+    // higher order filter attenuates more
+    filter.configure(1000, 10, 8);
+    REQUIRE(filter.getSections() == 4);
+    REQUIRE(sinePeak(filter, 1000, 100, 4000, 2000) < 1e-7);
+}
+
+TEST_CASE("AccelerometerFilter notch", "[AccelerometerFilter]") {
+    AccelerometerFilter filter;
+    filter.configure(1000, 0, 0, 50, 5);
+
+    REQUIRE(filter.getSections() == 1);
+
+    REQUIRE(sinePeak(filter, 1000, 50, 8000, 4000) < 1e-3);
+
+    filter.reset();
+    REQUIRE_THAT(sinePeak(filter, 1000, 5, 8000, 4000), WithinAbs(1, 0.01));
+
+    // notch and anti-alias
+    filter.configure(1000, 100, 2, 50, 5);
+    REQUIRE(filter.getSections() == 2);
+    REQUIRE(sinePeak(filter, 1000, 50, 8000, 4000) < 1e-3);
+}
+
+TEST_CASE("AccelerometerFilter latency", "[AccelerometerFilter]") {
+    AccelerometerFilter filter;
+
+    auto measuredDelay = [&filter](double sampleRate) {
+        // ramp output lags input by group delay
+        const size_t samples = 5000;
+        std::vector<float> data(samples * CHANNELS);
+        for (size_t s = 0; s < samples; s++) {
+            for (size_t c = 0; c < CHANNELS; c++) {
+                data[s * CHANNELS + c] = s * 0.001;
+            }
+        }
+        filter.process(data.data(), samples);
+        float output[CHANNELS];
+        filter.getOutput(output);
+        return ((samples - 1) * 0.001 - output[0]) / 0.001 / sampleRate;
+    };
+
+    filter.configure(1000, 10, 4);
+    REQUIRE(filter.getLatency() > 0);
+    REQUIRE_THAT(measuredDelay(1000), WithinAbs(filter.getLatency(), 1e-4));
+
+    filter.configure(2000, 10, 2, 50, 2);
+    REQUIRE_THAT(measuredDelay(2000), WithinAbs(filter.getLatency(), 1e-4));
+
+    filter.configure(1000, 0, 0);
+    REQUIRE(filter.getSections() == 0);
+    REQUIRE(filter.getLatency() == 0);
+}
+
+TEST_CASE("AccelerometerFilter invalid parameters", "[AccelerometerFilter]") {
+    AccelerometerFilter filter;
+
+    REQUIRE_THROWS(filter.configure(0, 10, 4));
+    REQUIRE_THROWS(filter.configure(1000, 10, 3));
+    REQUIRE_THROWS(filter.configure(1000, 10, 10));
+    REQUIRE_THROWS(filter.configure(1000, 500, 4));
+    REQUIRE_THROWS(filter.configure(1000, 0, 4));
+    REQUIRE_THROWS(filter.configure(1000, 10, 4, 600, 5));
+    REQUIRE_THROWS(filter.configure(1000, 10, 4, 50, 0));
+    REQUIRE_NOTHROW(filter.configure(1000, 0, 0, 50, 5));
+}
@@ -0,0 +1,142 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests BumpTestScheduler.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <cRIO/DataTypes.h>
+
+#include <BumpTestScheduler.h>
+#include <ForceActuatorApplicationSettings.h>
+
+using namespace LSST::M1M3::SS;
+
+void check_plan(const std::vector<BumpTestTask>& plan, float minimal_distance) {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    for (size_t i = 0; i < plan.size(); i++) {
+        for (size_t j = i + 1; j < plan.size(); j++) {
+            bool overlaps = plan[i].start < plan[j].end && plan[j].start < plan[i].end;
+            if (overlaps) {
+                CHECK(plan[i].z_index != plan[j].z_index);
+                CHECK(faa_settings.actuator_distance(plan[i].z_index, plan[j].z_index) > minimal_distance);
+            }
+        }
+    }
+}
+
+TEST_CASE("Plan mirror bump test", "[BumpTestScheduler]") {
+    BumpTestScheduler scheduler;
+
+    CHECK(scheduler.empty());
+
+    std::vector<int> z_indices;
+    for (int i = 0; i < FA_COUNT; i++) {
+        z_indices.push_back(i);
+    }
+
+    scheduler.plan(z_indices, true, true, 4, 2, 3, 1);
+
+    auto& plan = scheduler.get_plan();
+
+    REQUIRE(plan.size() == FA_COUNT + FA_S_COUNT);
+    CHECK(scheduler.empty() == false);
+    CHECK(scheduler.max_concurrency() > 1);
+
+    // 5 stages per test, 2 seconds each
+    CHECK(scheduler.expected_duration() < (FA_COUNT + FA_S_COUNT) * 10);
+    CHECK(scheduler.expected_duration() >= 10);
+
+    check_plan(plan, 4);
+
+    // all tests planned exactly once
+    for (int z = 0; z < FA_COUNT; z++) {
+        CHECK(std::count_if(plan.begin(), plan.end(),
+                            [z](const BumpTestTask& t) { return t.z_index == z && t.primary; }) == 1);
+    }
+}
+
+TEST_CASE("Run and replan", "[BumpTestScheduler]") {
+    BumpTestScheduler scheduler;
+
+    // FA IDs 101, 102, 103, 323 and 343. 101-103 are within 4 m of each
+    // other, 323 is within 4 m of 101 and 343
+    std::vector<int> z_indices = {0, 1, 2, 100, 120};
+
+    scheduler.plan(z_indices, true, false, 4, 2, 3, 1);
+
+    auto& plan = scheduler.get_plan();
+    REQUIRE(plan.size() == 5);
+    CHECK(plan[0].z_index == 0);
+    CHECK(plan[1].z_index == 120);
+    CHECK(plan[2].z_index == 1);
+    CHECK(plan[3].z_index == 100);
+    CHECK(plan[4].z_index == 2);
+    CHECK(scheduler.max_concurrency() == 2);
+    CHECK(scheduler.expected_duration() == 30);
+
+    auto always = [](int) { return true; };
+
+    auto start_all = [&scheduler, &always](float now) {
+        std::vector<int> started;
+        BumpTestTask task;
+        while (scheduler.next(now, always, task)) {
+            started.push_back(task.z_index);
+        }
+        return started;
+    };
+
+    CHECK(start_all(0) == std::vector<int>{0, 120});
+
+    // nothing can be started if the check fails
+    BumpTestTask task;
+    scheduler.finished(0, true, false, 10);
+    CHECK(scheduler.next(10, [](int) { return false; }, task) == false);
+
+    // failed test is retried after the pending tests
+    scheduler.finished(120, true, true, 10);
+    CHECK(scheduler.failed_count() == 1);
+    REQUIRE(plan.size() == 4);
+    CHECK(plan[0].z_index == 1);
+    CHECK(plan[1].z_index == 100);
+    CHECK(plan[2].z_index == 2);
+    CHECK(plan[3].z_index == 120);
+    CHECK(plan[3].retries == 0);
+    CHECK(scheduler.expected_duration() == 30);
+
+    CHECK(start_all(20) == std::vector<int>{1, 100});
+    CHECK(start_all(20) == std::vector<int>{});
+
+    scheduler.finished(1, true, false, 30);
+    scheduler.finished(100, true, false, 30);
+
+    CHECK(start_all(30) == std::vector<int>{2, 120});
+
+    scheduler.finished(2, true, false, 40);
+    scheduler.finished(120, true, false, 40);
+
+    CHECK(scheduler.empty());
+    CHECK(scheduler.failed_count() == 1);
+}
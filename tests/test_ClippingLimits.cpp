@@ -0,0 +1,141 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests ClippingLimits.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <ClippingLimits.h>
+#include <Range.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("ClippingLimits match Range::InRangeAndCoerce", "[ClippingLimits]") {
+    constexpr size_t N = 156;
+
+    std::mt19937 gen(1357);
+    std::uniform_real_distribution<float> limit(0, 1000);
+    std::uniform_real_distribution<float> value(-2000, 2000);
+
+    std::vector<Limit> table;
+    for (size_t i = 0; i < N; i++) {
+        table.push_back(Limit(-limit(gen), 0, 0, limit(gen)));
+    }
+
+    ClippingLimits<N> limits;
+    limits.set(table);
+
+    for (int cycle = 0; cycle < 100; cycle++) {
+        float values[N];
+        for (size_t i = 0; i < N; i++) {
+            values[i] = value(gen);
+        }
+        // special values - boundaries, NaN, infinities, signed zero
+        values[0] = table[0].LowFault;
+        values[1] = table[1].HighFault;
+        values[2] = std::nextafter(table[2].HighFault, INFINITY);
+        values[3] = NAN;
+        values[4] = INFINITY;
+        values[5] = -INFINITY;
+        values[6] = -0.0f;
+
+        float output[N];
+        std::bitset<N> clipped = limits.clip(values, output);
+
+        for (size_t i = 0; i < N; i++) {
+            float expected;
+            bool inRange =
+                    Range::InRangeAndCoerce(table[i].LowFault, table[i].HighFault, values[i], expected);
+            CHECK(clipped[i] == !inRange);
+            if (std::isnan(expected)) {
+                CHECK(std::isnan(output[i]));
+            } else {
+                CHECK(output[i] == expected);
+                CHECK(std::signbit(output[i]) == std::signbit(expected));
+            }
+        }
+    }
+}
+
+TEST_CASE("Integer ClippingLimits match Range::InRangeAndCoerce", "[ClippingLimits]") {
+    constexpr size_t N = 112;
+
+    std::mt19937 gen(2468);
+    std::uniform_real_distribution<float> limit(0, 1000);
+    std::uniform_int_distribution<int> value(-2000, 2000);
+
+    std::vector<Limit> table;
+    for (size_t i = 0; i < N; i++) {
+        table.push_back(Limit(-limit(gen), 0, 0, limit(gen)));
+    }
+
+    ClippingLimits<N, int> limits;
+    limits.set(table);
+
+    for (int cycle = 0; cycle < 100; cycle++) {
+        int values[N];
+        for (size_t i = 0; i < N; i++) {
+            values[i] = value(gen);
+        }
+        values[0] = static_cast<int>(table[0].LowFault);
+        values[1] = static_cast<int>(table[1].HighFault);
+        values[2] = static_cast<int>(table[2].HighFault) + 1;
+        values[3] = std::numeric_limits<int>::lowest();
+        values[4] = std::numeric_limits<int>::max();
+
+        int output[N];
+        std::bitset<N> clipped = limits.clip(values, output);
+
+        for (size_t i = 0; i < N; i++) {
+            int expected;
+            bool inRange = Range::InRangeAndCoerce<int>(table[i].LowFault, table[i].HighFault, values[i],
+                                                        expected);
+            CHECK(clipped[i] == !inRange);
+            CHECK(output[i] == expected);
+        }
+    }
+}
+
+TEST_CASE("ClippingLimits without clipped values", "[ClippingLimits]") {
+    ClippingLimits<12> unlimited;
+
+    float values[12];
+    float output[12];
+    for (int i = 0; i < 12; i++) {
+        values[i] = i * 1e30f;
+    }
+
+    CHECK(unlimited.clip(values, output).none());
+    for (int i = 0; i < 12; i++) {
+        CHECK(output[i] == values[i]);
+    }
+}
+
+TEST_CASE("ClippingLimits short table", "[ClippingLimits]") {
+    ClippingLimits<12> limits;
+    std::vector<Limit> table(11, Limit(-1, 0, 0, 1));
+    REQUIRE_THROWS_AS(limits.set(table), std::runtime_error);
+}
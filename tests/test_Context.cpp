@@ -0,0 +1,129 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests Context state transitions.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <deque>
+#include <map>
+
+#include <catch2/catch_all.hpp>
+
+#include <SAL_MTM1M3.h>
+
+#include <Context.h>
+#include <DetailedState.h>
+#include <M1M3SSPublisher.h>
+#include <StaticStateFactory.h>
+
+using namespace LSST::M1M3::SS;
+
+namespace LSST {
+namespace M1M3 {
+namespace SS {
+
+// access to state transitions, normally done with command results
+class ContextTest {
+public:
+    static void transition(States::Type newState) {
+        Context::instance()._updateCurrentStateIfRequired(newState);
+    }
+};
+
+}  // namespace SS
+}  // namespace M1M3
+}  // namespace LSST
+
+// walks legal transitions from the current state to target
+void walkTo(States::Type target) {
+    std::map<States::Type, States::Type> previous;
+    std::deque<States::Type> queue{Context::instance().getCurrentState()};
+    previous[queue.front()] = queue.front();
+    while (queue.empty() == false && previous.count(target) == 0) {
+        States::Type current = queue.front();
+        queue.pop_front();
+        for (auto& transition : StaticStateFactory::LEGAL_TRANSITIONS) {
+            if (transition.from == current && previous.count(transition.to) == 0) {
+                previous[transition.to] = current;
+                queue.push_back(transition.to);
+            }
+        }
+    }
+    REQUIRE(previous.count(target) == 1);
+
+    std::deque<States::Type> path;
+    for (States::Type s = target; s != Context::instance().getCurrentState(); s = previous[s]) {
+        path.push_front(s);
+    }
+    for (auto s : path) {
+        ContextTest::transition(s);
+    }
+    REQUIRE(Context::instance().getCurrentState() == target);
+}
+
+TEST_CASE("Legal transitions table", "[Context]") {
+    for (auto& transition : StaticStateFactory::LEGAL_TRANSITIONS) {
+        CHECK(transition.from != transition.to);
+        CHECK(StaticStateFactory::get().create(transition.from) != nullptr);
+        CHECK(StaticStateFactory::get().create(transition.to) != nullptr);
+        CHECK(StaticStateFactory::isLegalTransition(transition.from, transition.to));
+    }
+
+    CHECK_FALSE(StaticStateFactory::isLegalTransition(States::OfflineState, States::ActiveState));
+    CHECK_FALSE(StaticStateFactory::isLegalTransition(States::FaultState, States::ParkedState));
+    CHECK_FALSE(StaticStateFactory::isLegalTransition(States::LoweringFaultState, States::StandbyState));
+    CHECK(StaticStateFactory::get().create(States::NoStateTransition) == nullptr);
+}
+
+TEST_CASE("Context walks every legal transition", "[Context]") {
+    M1M3SSPublisher::instance().setSAL(std::make_shared<SAL_MTM1M3>());
+
+    auto& context = Context::instance();
+
+    REQUIRE(context.getCurrentState() == States::OfflineState);
+    REQUIRE(context.getCurrentStateObject() == StaticStateFactory::get().create(States::OfflineState));
+
+    for (auto& transition : StaticStateFactory::LEGAL_TRANSITIONS) {
+        walkTo(transition.from);
+
+        State* fromObject = context.getCurrentStateObject();
+        REQUIRE(fromObject == StaticStateFactory::get().create(transition.from));
+
+        // no transition keeps cached state object
+        ContextTest::transition(States::NoStateTransition);
+        REQUIRE(context.getCurrentState() == transition.from);
+        REQUIRE(context.getCurrentStateObject() == fromObject);
+
+        ContextTest::transition(transition.to);
+
+        uint64_t to = transition.to;
+        REQUIRE(context.getCurrentState() == transition.to);
+        REQUIRE(context.getCurrentStateObject() == StaticStateFactory::get().create(transition.to));
+        REQUIRE(context.getLastStateDuration().count() >= 0);
+        REQUIRE(DetailedState::instance().detailedState == static_cast<int>(to & 0xFFFFFFFF));
+        REQUIRE(M1M3SSPublisher::instance().getEventSummaryState()->summaryState ==
+                static_cast<int>(to >> 32));
+    }
+
+    // unknown state is ignored
+    States::Type current = context.getCurrentState();
+    ContextTest::transition(static_cast<States::Type>(0));
+    REQUIRE(context.getCurrentState() == current);
+}
@@ -0,0 +1,136 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests CylinderForcesConverter.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <CylinderForcesConverter.h>
+#include <ForceActuatorApplicationSettings.h>
+#include <ForceActuatorOrientations.h>
+
+using namespace LSST::M1M3::SS;
+
+static int32_t toInt24(float force) { return (int32_t)(force * 1000.0); }
+
+static double constexpr sqrt2 = 1.4142135623730950488016887242097;
+
+/**
+ * Conversion switching on actuator orientation.
+ */
+void convert(const std::vector<float>& x, const std::vector<float>& y, const std::vector<float>& z,
+             std::vector<int>& primary, std::vector<int>& secondary) {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    for (int pIndex = 0; pIndex < FA_COUNT; pIndex++) {
+        int xIndex = faa_settings.ZIndexToXIndex[pIndex];
+        int yIndex = faa_settings.ZIndexToYIndex[pIndex];
+        int sIndex = faa_settings.ZIndexToSecondaryCylinderIndex[pIndex];
+
+        switch (faa_settings.Table[pIndex].Orientation) {
+            case ForceActuatorOrientations::PositiveY:
+                secondary[sIndex] = toInt24(y[yIndex] * sqrt2);
+                primary[pIndex] = toInt24(z[pIndex] - y[yIndex]);
+                break;
+            case ForceActuatorOrientations::NA:
+                primary[pIndex] = toInt24(z[pIndex]);
+                break;
+            case ForceActuatorOrientations::PositiveX:
+                secondary[sIndex] = toInt24(x[xIndex] * sqrt2);
+                primary[pIndex] = toInt24(z[pIndex] - x[xIndex]);
+                break;
+            case ForceActuatorOrientations::NegativeX:
+                secondary[sIndex] = toInt24(-x[xIndex] * sqrt2);
+                primary[pIndex] = toInt24(z[pIndex] - -x[xIndex]);
+                break;
+            case ForceActuatorOrientations::NegativeY:
+                secondary[sIndex] = toInt24(-y[yIndex] * sqrt2);
+                primary[pIndex] = toInt24(z[pIndex] - -y[yIndex]);
+                break;
+        }
+    }
+}
+
+void check_conversion(CylinderForcesConverter& converter, const std::vector<float>& x,
+                      const std::vector<float>& y, const std::vector<float>& z) {
+    std::vector<int> primary(FA_COUNT), secondary(FA_S_COUNT);
+    std::vector<int> expectedPrimary(FA_COUNT), expectedSecondary(FA_S_COUNT);
+
+    converter.convert(x, y, z, primary, secondary);
+    convert(x, y, z, expectedPrimary, expectedSecondary);
+
+    for (int i = 0; i < FA_COUNT; i++) {
+        CHECK(primary[i] == expectedPrimary[i]);
+    }
+    for (int i = 0; i < FA_S_COUNT; i++) {
+        CHECK(secondary[i] == expectedSecondary[i]);
+    }
+}
+
+TEST_CASE("Cylinder setpoints match orientation conversion", "[CylinderForcesConverter]") {
+    CylinderForcesConverter converter;
+
+    std::vector<float> x(FA_X_COUNT), y(FA_Y_COUNT), z(FA_Z_COUNT);
+
+    SECTION("Zero forces") { check_conversion(converter, x, y, z); }
+
+    SECTION("Random forces") {
+        std::mt19937 gen(5678);
+        std::uniform_real_distribution<float> lateral(-600, 600);
+        std::uniform_real_distribution<float> vertical(-1500, 3000);
+
+        for (int i = 0; i < 1000; i++) {
+            for (auto& f : x) f = lateral(gen);
+            for (auto& f : y) f = lateral(gen);
+            for (auto& f : z) f = vertical(gen);
+            check_conversion(converter, x, y, z);
+        }
+    }
+
+    SECTION("Signed zeros and rounding boundaries") {
+        std::vector<float> values = {-0.0f, 0.0f, 0.001f, -0.001f, 0.0005f, -0.0005f, 1e-7f, 8388.607f};
+        for (auto v : values) {
+            for (auto& f : x) f = v;
+            for (auto& f : y) f = -v;
+            for (auto& f : z) f = v;
+            check_conversion(converter, x, y, z);
+        }
+    }
+}
+
+TEST_CASE("Single axis actuators ignore lateral forces", "[CylinderForcesConverter]") {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+    CylinderForcesConverter converter;
+
+    std::vector<float> x(FA_X_COUNT, 100), y(FA_Y_COUNT, -200), z(FA_Z_COUNT, 500);
+    std::vector<int> primary(FA_COUNT), secondary(FA_S_COUNT);
+
+    converter.convert(x, y, z, primary, secondary);
+
+    for (int i = 0; i < FA_COUNT; i++) {
+        if (faa_settings.ZIndexToSecondaryCylinderIndex[i] == -1) {
+            CHECK(primary[i] == 500000);
+        }
+    }
+}
@@ -0,0 +1,253 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests DisabledForcesRedistribution.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <DisabledForcesRedistribution.h>
+#include <ForceActuatorApplicationSettings.h>
+
+using namespace LSST::M1M3::SS;
+
+/**
+ * Redistribution as was done in FinalForceComponent::applyForcesByComponents
+ * before the plan was introduced. Copied verbatim.
+ */
+void redistribute(const bool enabled[FA_COUNT], float* xTarget, float* yTarget, float* zTarget) {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    // find disabled FAs quadrants
+    std::vector<int> disabledInQuadrants[4];
+
+    for (int i = 0; i < FA_COUNT; i++) {
+        if (enabled[i] == false) {
+            disabledInQuadrants[int(faa_settings.ZIndexToActuatorId(i) / 100) - 1].push_back(i);
+        }
+    }
+
+    // 2nd pass - distribute any disabled FA force per quadrants
+    for (int q = 0; q < 4; q++) {
+        auto qd = disabledInQuadrants[q];
+
+        if (disabledInQuadrants[q].size() == 0) {
+            continue;
+        }
+
+        float excess_z = 0;
+        float excess_y = 0;
+        float excess_x = 0;
+
+        int z_disabled = 0;
+        int y_disabled = 0;
+        int x_disabled = 0;
+
+        for (auto disabled : qd) {
+            excess_z += zTarget[disabled];
+            zTarget[disabled] = 0;
+            z_disabled++;
+
+            int yIndex = faa_settings.ZIndexToYIndex[disabled];
+            if (yIndex >= 0) {
+                excess_y += yTarget[yIndex];
+                yTarget[yIndex] = 0;
+                y_disabled++;
+            }
+
+            int xIndex = faa_settings.ZIndexToXIndex[disabled];
+            if (xIndex >= 0) {
+                excess_x += xTarget[xIndex];
+                xTarget[xIndex] = 0;
+                x_disabled++;
+            }
+        }
+
+        auto qz = faa_settings.QuadrantZ[q];
+
+        for (auto fa : qz) {
+            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
+                continue;
+            }
+
+            zTarget[fa] += excess_z / (qz.size() - z_disabled);
+        }
+
+        auto qy = faa_settings.QuadrantY[q];
+
+        for (auto fa : qy) {
+            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
+                continue;
+            }
+
+            yTarget[fa] += excess_y / (qy.size() - y_disabled);
+        }
+
+        auto qx = faa_settings.QuadrantX[q];
+
+        for (auto fa : qx) {
+            if (std::find(qd.begin(), qd.end(), fa) != std::end(qd)) {
+                continue;
+            }
+
+            xTarget[fa] += excess_x / (qx.size() - x_disabled);
+        }
+    }
+}
+
+/**
+ * Bitwise comparison, so NaNs and signed zeros are compared as well.
+ */
+bool same(float a, float b) { return memcmp(&a, &b, sizeof(float)) == 0; }
+
+void check_redistribution(const bool enabled[FA_COUNT], std::mt19937& gen) {
+    std::uniform_real_distribution<float> force(-800, 800);
+
+    float x[FA_X_COUNT], y[FA_Y_COUNT], z[FA_Z_COUNT];
+    for (auto& f : x) f = force(gen);
+    for (auto& f : y) f = force(gen);
+    for (auto& f : z) f = force(gen);
+
+    float ex[FA_X_COUNT], ey[FA_Y_COUNT], ez[FA_Z_COUNT];
+    std::copy(x, x + FA_X_COUNT, ex);
+    std::copy(y, y + FA_Y_COUNT, ey);
+    std::copy(z, z + FA_Z_COUNT, ez);
+
+    DisabledForcesRedistribution redistribution;
+    REQUIRE(redistribution.planRequired(enabled));
+    redistribution.plan(enabled);
+    REQUIRE(redistribution.planRequired(enabled) == false);
+
+    redistribute(enabled, ex, ey, ez);
+    redistribution.apply(x, y, z);
+
+    for (int i = 0; i < FA_X_COUNT; i++) {
+        CHECK(same(x[i], ex[i]));
+    }
+    for (int i = 0; i < FA_Y_COUNT; i++) {
+        CHECK(same(y[i], ey[i]));
+    }
+    for (int i = 0; i < FA_Z_COUNT; i++) {
+        CHECK(same(z[i], ez[i]));
+    }
+}
+
+TEST_CASE("No disabled actuators", "[DisabledForcesRedistribution]") {
+    std::mt19937 gen(1);
+
+    bool enabled[FA_COUNT];
+    std::fill(enabled, enabled + FA_COUNT, true);
+
+    DisabledForcesRedistribution redistribution;
+    redistribution.plan(enabled);
+    REQUIRE(redistribution.empty());
+
+    check_redistribution(enabled, gen);
+}
+
+TEST_CASE("Single disabled actuator per quadrant", "[DisabledForcesRedistribution]") {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+    std::mt19937 gen(2);
+
+    bool enabled[FA_COUNT];
+
+    SECTION("Every actuator") {
+        for (int d = 0; d < FA_COUNT; d++) {
+            std::fill(enabled, enabled + FA_COUNT, true);
+            enabled[d] = false;
+            check_redistribution(enabled, gen);
+        }
+    }
+
+    SECTION("All quadrants") {
+        std::fill(enabled, enabled + FA_COUNT, true);
+        // X actuator in first quadrant, Y in the others
+        enabled[faa_settings.XIndexToZIndex[faa_settings.QuadrantX[0][0]]] = false;
+        for (int q = 1; q < 4; q++) {
+            enabled[faa_settings.YIndexToZIndex[faa_settings.QuadrantY[q][1]]] = false;
+        }
+
+        DisabledForcesRedistribution redistribution;
+        redistribution.plan(enabled);
+        REQUIRE(redistribution.empty() == false);
+
+        check_redistribution(enabled, gen);
+    }
+}
+
+TEST_CASE("Multiple disabled actuators per quadrant", "[DisabledForcesRedistribution]") {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+    std::mt19937 gen(3);
+    std::bernoulli_distribution disable(0.1);
+
+    bool enabled[FA_COUNT];
+
+    SECTION("Random") {
+        for (int i = 0; i < 100; i++) {
+            for (int z = 0; z < FA_COUNT; z++) {
+                enabled[z] = !disable(gen);
+            }
+            check_redistribution(enabled, gen);
+        }
+    }
+
+    SECTION("Whole quadrant") {
+        std::fill(enabled, enabled + FA_COUNT, true);
+        for (auto z : faa_settings.QuadrantZ[2]) {
+            enabled[z] = false;
+        }
+        check_redistribution(enabled, gen);
+    }
+
+    SECTION("Replan") {
+        std::fill(enabled, enabled + FA_COUNT, true);
+
+        DisabledForcesRedistribution redistribution;
+        redistribution.plan(enabled);
+
+        enabled[faa_settings.QuadrantZ[1][3]] = false;
+        enabled[faa_settings.QuadrantZ[1][7]] = false;
+        REQUIRE(redistribution.planRequired(enabled));
+        redistribution.plan(enabled);
+        REQUIRE(redistribution.planRequired(enabled) == false);
+
+        float x[FA_X_COUNT], y[FA_Y_COUNT], z[FA_Z_COUNT];
+        std::fill(x, x + FA_X_COUNT, 1);
+        std::fill(y, y + FA_Y_COUNT, 1);
+        std::fill(z, z + FA_Z_COUNT, 1);
+
+        redistribution.apply(x, y, z);
+
+        CHECK(z[faa_settings.QuadrantZ[1][3]] == 0);
+        CHECK(z[faa_settings.QuadrantZ[1][7]] == 0);
+
+        float sum = 0;
+        for (auto fa : faa_settings.QuadrantZ[1]) {
+            sum += z[fa];
+        }
+        CHECK_THAT(sum, Catch::Matchers::WithinRel(faa_settings.QuadrantZ[1].size(), 1e-5));
+        CHECK(z[faa_settings.QuadrantZ[0][0]] == 1);
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests EventChangeTracker.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <random>
+
+#include <catch2/catch_all.hpp>
+
+#include <SAL_MTM1M3.h>
+
+#include <EventChangeTracker.h>
+#include <M1M3SSPublisher.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("EventChangeTracker set and check", "[EventChangeTracker]") {
+    EventChangeTracker tracker;
+
+    // new tracker forces the first comparison
+    REQUIRE(tracker.changed() == true);
+    REQUIRE(tracker.check() == true);
+    REQUIRE(tracker.check() == false);
+
+    bool b = false;
+    REQUIRE(tracker.set(b, false) == false);
+    REQUIRE(tracker.changed() == false);
+
+    REQUIRE(tracker.set(b, true) == true);
+    REQUIRE(b == true);
+    REQUIRE(tracker.changed() == true);
+    REQUIRE(tracker.check() == true);
+    REQUIRE(tracker.changed() == false);
+
+    // flip back before check still marks the event - publisher comparison decides
+    REQUIRE(tracker.set(b, false) == true);
+    REQUIRE(tracker.set(b, true) == true);
+    REQUIRE(tracker.check() == true);
+
+    int i = 0;
+    REQUIRE(tracker.set(i, 5u) == true);
+    REQUIRE(i == 5);
+    REQUIRE(tracker.set(i, 5) == false);
+    REQUIRE(tracker.check() == true);
+
+    float f = NAN;
+    REQUIRE(tracker.set(f, NAN) == true);
+    REQUIRE(std::isnan(f));
+
+    tracker.check();
+    tracker.mark();
+    REQUIRE(tracker.check() == true);
+}
+
+TEST_CASE("tryLog decisions with change tracking", "[EventChangeTracker]") {
+    M1M3SSPublisher::instance().setSAL(std::make_shared<SAL_MTM1M3>());
+
+    auto setpointWarning = M1M3SSPublisher::instance().getEventForceSetpointWarning();
+    auto setpointTracker = M1M3SSPublisher::instance().getEventForceSetpointWarningTracker();
+
+    auto powerStatus = M1M3SSPublisher::instance().getEventPowerStatus();
+    auto powerTracker = M1M3SSPublisher::instance().getEventPowerStatusTracker();
+
+    // synchronize published and current event
+    M1M3SSPublisher::instance().logForceSetpointWarning();
+    M1M3SSPublisher::instance().logPowerStatus();
+
+    bool lastSafety[FA_COUNT];
+    bool lastNear[FA_COUNT];
+    bool lastMagnitude = setpointWarning->magnitudeWarning;
+    for (int i = 0; i < FA_COUNT; i++) {
+        lastSafety[i] = setpointWarning->safetyLimitWarning[i];
+        lastNear[i] = setpointWarning->nearNeighborWarning[i];
+    }
+    bool lastNetworkA = powerStatus->powerNetworkACommandedOn;
+
+    REQUIRE(M1M3SSPublisher::instance().tryLogForceSetpointWarning() == false);
+    REQUIRE(M1M3SSPublisher::instance().tryLogPowerStatus() == false);
+
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<int> index(0, FA_COUNT - 1);
+    std::bernoulli_distribution rare(0.02);
+    std::bernoulli_distribution often(0.5);
+
+    int published = 0;
+
+    for (int cycle = 0; cycle < 2000; cycle++) {
+        // mostly unchanged values, with occasional flips and flip-backs
+        for (int w = 0; w < 3; w++) {
+            int i = index(gen);
+            if (rare(gen)) {
+                setpointTracker->set(setpointWarning->safetyLimitWarning[i],
+                                     !setpointWarning->safetyLimitWarning[i]);
+            } else {
+                setpointTracker->set(setpointWarning->safetyLimitWarning[i],
+                                     setpointWarning->safetyLimitWarning[i]);
+            }
+            if (rare(gen)) {
+                setpointTracker->set(setpointWarning->nearNeighborWarning[i],
+                                     !setpointWarning->nearNeighborWarning[i]);
+            }
+        }
+        if (rare(gen)) {
+            setpointTracker->set(setpointWarning->magnitudeWarning, often(gen));
+        }
+
+        bool expected = setpointWarning->magnitudeWarning != lastMagnitude;
+        for (int i = 0; i < FA_COUNT; i++) {
+            expected = expected || setpointWarning->safetyLimitWarning[i] != lastSafety[i] ||
+                       setpointWarning->nearNeighborWarning[i] != lastNear[i];
+        }
+
+        bool sent = M1M3SSPublisher::instance().tryLogForceSetpointWarning();
+        REQUIRE(sent == expected);
+
+        if (sent) {
+            published++;
+            lastMagnitude = setpointWarning->magnitudeWarning;
+            for (int i = 0; i < FA_COUNT; i++) {
+                lastSafety[i] = setpointWarning->safetyLimitWarning[i];
+                lastNear[i] = setpointWarning->nearNeighborWarning[i];
+            }
+        }
+
+        if (rare(gen)) {
+            powerTracker->set(powerStatus->powerNetworkACommandedOn, often(gen));
+        }
+        bool powerSent = M1M3SSPublisher::instance().tryLogPowerStatus();
+        REQUIRE(powerSent == (powerStatus->powerNetworkACommandedOn != lastNetworkA));
+        lastNetworkA = powerStatus->powerNetworkACommandedOn;
+    }
+
+    REQUIRE(published > 0);
+}
@@ -23,8 +23,11 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <SAL_MTM1M3.h>
@@ -123,3 +126,106 @@ TEST_CASE("fromRaw", "[FABumpTestData]") {
         CHECK_THAT(stat.error_rms, WithinAbs(0.073386133, 1e-3));
     }
 }
+
+TEST_CASE("Streaming statistics", "[FABumpTestData]") {
+    constexpr int size = 7;
+
+    FABumpTestData data(size);
+
+    std::vector<int> states(FA_COUNT, MTM1M3::MTM1M3_shared_BumpTest_TestingPositive);
+
+    for (int i = 0; i < 5 * size + 3; i++) {
+        std::vector<float> forces(FA_COUNT);
+        for (int c = 0; c < FA_COUNT; c++) {
+            forces[c] = 100 * sin(0.7 * i + c) + c;
+        }
+        data.add_data(forces, forces, forces, forces, forces, states, states);
+
+        for (int c = 0; c < FA_S_COUNT; c += 13) {
+            float* raw = data.get_data(c, MTM1M3::MTM1M3_shared_BumpTestType_Secondary);
+            size_t n = data.size();
+
+            // full buffer scan as oracle - running sums differ only by float rounding
+            float min = raw[0], max = raw[0];
+            float sum = 0, rms = 0;
+            for (size_t j = 0; j < n; j++) {
+                min = std::min(min, raw[j]);
+                max = std::max(max, raw[j]);
+                sum += raw[j];
+                float v_b = raw[j] - 10.0f;
+                rms += v_b * v_b;
+            }
+
+            auto stat = data.statistics(c, c, MTM1M3::MTM1M3_shared_BumpTestType_Secondary, 10);
+            CHECK(stat.min == min);
+            CHECK(stat.max == max);
+            CHECK_THAT(stat.average, WithinAbs(sum / n, 1e-3));
+            CHECK_THAT(stat.error_rms, WithinAbs(sqrtf(rms / n), 1e-3));
+
+            auto cached = data.cached_statistics(c, MTM1M3::MTM1M3_shared_BumpTestType_Secondary);
+            CHECK(cached.average == stat.average);
+        }
+
+        CHECK_THROWS_AS(data.cached_statistics(1, MTM1M3::MTM1M3_shared_BumpTestType_Secondary),
+                        std::out_of_range);
+    }
+
+    data.clear();
+    CHECK(data.empty() == true);
+    CHECK_THROWS_AS(data.statistics(0, 0, MTM1M3::MTM1M3_shared_BumpTestType_Z), std::runtime_error);
+}
+
+TEST_CASE("Running sums don't drift", "[FABumpTestData]") {
+    constexpr int size = 5;
+
+    FABumpTestData data(size);
+
+    std::vector<int> states(FA_COUNT, MTM1M3::MTM1M3_shared_BumpTest_TestingPositive);
+
+    for (int i = 0; i < 3000; i++) {
+        std::vector<float> forces(FA_COUNT);
+        for (int c = 0; c < FA_COUNT; c++) {
+            forces[c] = 10000 * (i % 3) + sin(0.3 * i + c);
+        }
+        data.add_data(forces, forces, forces, forces, forces, states, states);
+    }
+
+    for (int c = 0; c < FA_COUNT; c += 17) {
+        float* raw = data.get_data(c, MTM1M3::MTM1M3_shared_BumpTestType_Z);
+        double sum = 0, rms = 0;
+        for (int j = 0; j < size; j++) {
+            sum += raw[j];
+            rms += (raw[j] - 10000.0) * (raw[j] - 10000.0);
+        }
+
+        auto stat = data.statistics(c, c, MTM1M3::MTM1M3_shared_BumpTestType_Z, 10000);
+        CHECK_THAT(stat.average, WithinAbs(sum / size, 1e-3));
+        CHECK_THAT(stat.error_rms, WithinAbs(sqrt(rms / size), 1e-3));
+    }
+}
+
+TEST_CASE("Readers see consistent statistics", "[FABumpTestData]") {
+    constexpr int size = 10;
+
+    FABumpTestData data(size);
+
+    std::vector<int> states(FA_COUNT, MTM1M3::MTM1M3_shared_BumpTest_TestingPositive);
+
+    std::thread writer([&data, &states]() {
+        for (int i = 0; i < 5000; i++) {
+            std::vector<float> forces(FA_COUNT, i);
+            data.add_data(forces, forces, forces, forces, forces, states, states);
+        }
+    });
+
+    // samples are increasing, so a consistent window has average in the middle of minimum and maximum
+    for (int i = 0; i < 5000; i++) {
+        if (data.empty()) {
+            continue;
+        }
+        auto stat = data.statistics(20, 20, MTM1M3::MTM1M3_shared_BumpTestType_Z, 0);
+        REQUIRE_THAT(stat.average, WithinAbs((stat.min + stat.max) / 2.0, 1e-3));
+    }
+
+    writer.join();
+}
@@ -216,6 +216,57 @@ TEST_CASE("M1M3 ForceController tests", "[M1M3]") {
                     205.89926, -4254.60693);
     }
 
+    SECTION("Unchanged offset forces aren't recalculated") {
+        ForceController* forceController = Model::instance().getForceController();
+        MTM1M3_logevent_appliedOffsetForcesC* appliedOffsetForces =
+                M1M3SSPublisher::instance().getEventAppliedOffsetForces();
+
+        forceController->applyOffsetForcesByMirrorForces(0, 0, 2000, 0, 0, 0);
+        for (int i = 0; i < 100; i++) {
+            forceController->updateAppliedForces();
+        }
+        CHECK_THAT(appliedOffsetForces->fz, WithinRel(2000, 0.001));
+
+        // values scribbled into the applied forces survive as long as the
+        // component skips clipping and forces and moments calculation
+        appliedOffsetForces->zForces[5] = -12345;
+        appliedOffsetForces->fz = -12345;
+        for (int i = 0; i < 10; i++) {
+            forceController->updateAppliedForces();
+        }
+        CHECK(appliedOffsetForces->zForces[5] == -12345);
+        CHECK(appliedOffsetForces->fz == -12345);
+
+        // NaN target is detected as change, and once reached is not reported
+        // as change in every cycle
+        std::vector<float> x(FA_X_COUNT, 0);
+        std::vector<float> y(FA_Y_COUNT, 0);
+        std::vector<float> z(FA_Z_COUNT, 0);
+        z[10] = NAN;
+        forceController->applyOffsetForces(x, y, z);
+        forceController->updateAppliedForces();
+        CHECK(std::isnan(appliedOffsetForces->zForces[10]));
+        CHECK(std::isnan(appliedOffsetForces->fz));
+
+        for (int i = 0; i < 100; i++) {
+            forceController->updateAppliedForces();
+        }
+        CHECK(std::isnan(appliedOffsetForces->zForces[10]));
+        CHECK(appliedOffsetForces->zForces[11] == 0);
+        CHECK(std::isnan(appliedOffsetForces->fz));
+
+        appliedOffsetForces->zForces[11] = -12345;
+        forceController->updateAppliedForces();
+        CHECK(appliedOffsetForces->zForces[11] == -12345);
+
+        forceController->applyOffsetForcesByMirrorForces(0, 0, 1000, 0, 0, 0);
+        for (int i = 0; i < 100; i++) {
+            forceController->updateAppliedForces();
+        }
+        CHECK(std::isnan(appliedOffsetForces->zForces[10]) == false);
+        CHECK_THAT(appliedOffsetForces->fz, WithinRel(1000, 0.001));
+    }
+
     SECTION("Elevation 45 deg with 100% support, force sum doesn't support mirror") {
         Model::instance().getForceController()->applyElevationForces();
         RaisingLoweringInfo::instance().fillSupportPercentage();
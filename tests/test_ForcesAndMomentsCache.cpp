@@ -0,0 +1,143 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests ForcesAndMomentsCache.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <ForceActuatorApplicationSettings.h>
+#include <ForceActuatorSettings.h>
+#include <ForcesAndMomentsCache.h>
+
+using namespace Catch::Matchers;
+using namespace LSST::M1M3::SS;
+
+void check_equal(const ForcesAndMoments& a, const ForcesAndMoments& b) {
+    CHECK(a.Fx == b.Fx);
+    CHECK(a.Fy == b.Fy);
+    CHECK(a.Fz == b.Fz);
+    CHECK(a.Mx == b.Mx);
+    CHECK(a.My == b.My);
+    CHECK(a.Mz == b.Mz);
+    CHECK(a.ForceMagnitude == b.ForceMagnitude);
+}
+
+TEST_CASE("Forces and moments match actuator geometry", "[ForcesAndMomentsCache]") {
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+    auto& fa_settings = ForceActuatorSettings::instance();
+
+    std::vector<float> x(FA_X_COUNT), y(FA_Y_COUNT), z(FA_Z_COUNT);
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> force(-500, 500);
+    for (auto& f : x) f = force(gen);
+    for (auto& f : y) f = force(gen);
+    for (auto& f : z) f = force(gen);
+
+    double fx = 0, fy = 0, fz = 0, mx = 0, my = 0, mz = 0;
+    double zmx = 0, zmy = 0;
+    for (int zIndex = 0; zIndex < FA_COUNT; zIndex++) {
+        double rx = faa_settings.Table[zIndex].XPosition - fa_settings.mirrorCenterOfGravityX;
+        double ry = faa_settings.Table[zIndex].YPosition - fa_settings.mirrorCenterOfGravityY;
+        double rz = faa_settings.Table[zIndex].ZPosition - fa_settings.mirrorCenterOfGravityZ;
+        int xIndex = faa_settings.ZIndexToXIndex[zIndex];
+        int yIndex = faa_settings.ZIndexToYIndex[zIndex];
+        double afx = xIndex != -1 ? x[xIndex] : 0;
+        double afy = yIndex != -1 ? y[yIndex] : 0;
+        double afz = z[zIndex];
+
+        fx += afx;
+        fy += afy;
+        fz += afz;
+        mx += afz * ry - afy * rz;
+        my += afx * rz - afz * rx;
+        mz += afy * rx - afx * ry;
+        zmx += afz * ry;
+        zmy -= afz * rx;
+    }
+
+    auto fm = fa_settings.calculateForcesAndMoments(x, y, z);
+    CHECK_THAT(fm.Fx, WithinAbs(fx, 0.1));
+    CHECK_THAT(fm.Fy, WithinAbs(fy, 0.1));
+    CHECK_THAT(fm.Fz, WithinAbs(fz, 0.1));
+    CHECK_THAT(fm.Mx, WithinAbs(mx, 0.1));
+    CHECK_THAT(fm.My, WithinAbs(my, 0.1));
+    CHECK_THAT(fm.Mz, WithinAbs(mz, 0.1));
+    CHECK_THAT(fm.ForceMagnitude, WithinAbs(sqrt(fx * fx + fy * fy + fz * fz), 0.1));
+
+    auto zfm = fa_settings.calculateForcesAndMoments(z);
+    CHECK(zfm.Fz == fm.Fz);
+    CHECK_THAT(zfm.Mx, WithinAbs(zmx, 0.1));
+    CHECK_THAT(zfm.My, WithinAbs(zmy, 0.1));
+}
+
+TEST_CASE("Cached forces and moments", "[ForcesAndMomentsCache]") {
+    auto& fa_settings = ForceActuatorSettings::instance();
+
+    std::vector<float> x(FA_X_COUNT, 0), y(FA_Y_COUNT, 0), z(FA_Z_COUNT, 0);
+
+    ForcesAndMomentsCache cache;
+    ForcesAndMomentsCache zCache;
+
+    check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+    check_equal(zCache.calculate(z), fa_settings.calculateForcesAndMoments(z));
+
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> force(-500, 500);
+    std::uniform_int_distribution<int> index(0, FA_X_COUNT - 1);
+    std::bernoulli_distribution rare(0.1);
+
+    for (int cycle = 0; cycle < 500; cycle++) {
+        if (rare(gen)) {
+            x[index(gen)] = force(gen);
+        }
+        if (rare(gen)) {
+            y[index(gen) % FA_Y_COUNT] = force(gen);
+        }
+        if (rare(gen)) {
+            z[index(gen) % FA_Z_COUNT] = force(gen);
+        }
+
+        check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+        check_equal(zCache.calculate(z), fa_settings.calculateForcesAndMoments(z));
+    }
+
+    SECTION("NaN and signed zero") {
+        z[0] = NAN;
+        CHECK(std::isnan(cache.calculate(x, y, z).Fz));
+        CHECK(std::isnan(cache.calculate(x, y, z).Fz));
+        z[0] = 0;
+        check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+        z[0] = -0.0f;
+        check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+    }
+
+    SECTION("Mixed calls") {
+        check_equal(cache.calculate(z), fa_settings.calculateForcesAndMoments(z));
+        check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+        cache.invalidate();
+        check_equal(cache.calculate(x, y, z), fa_settings.calculateForcesAndMoments(x, y, z));
+    }
+}
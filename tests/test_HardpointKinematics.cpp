@@ -0,0 +1,144 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests HardpointKinematics.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <HardpointKinematics.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Matchers::WithinAbs;
+
+static const double MICROMETERS_PER_STEP = 4.0 / 3.0;
+static const double MICROMETERS_PER_ENCODER = 0.2;
+
+static std::vector<double> randomMatrix(std::mt19937& gen) {
+    std::uniform_real_distribution<double> value(-2.0, 2.0);
+    std::vector<double> ret(36);
+    for (auto& v : ret) {
+        v = value(gen);
+    }
+    return ret;
+}
+
+// conversion as written in PositionController before kinematics were
+// extracted - hardpoints are listed as 3, 4, 5, 6, 1, 2 in the matrix
+static void legacySteps(const std::vector<double>& m, const double* p, int32_t* steps) {
+    for (int row = 0; row < 6; row++) {
+        steps[(row + 2) % 6] = (m[row * 6 + 0] * p[0] + m[row * 6 + 1] * p[1] + m[row * 6 + 2] * p[2] +
+                                m[row * 6 + 3] * p[3] + m[row * 6 + 4] * p[4] + m[row * 6 + 5] * p[5]) *
+                               (1000.0 * 1000.0 / MICROMETERS_PER_STEP);
+    }
+}
+
+static void legacyPosition(const std::vector<double>& m, const int32_t* encoder, const int32_t* reference,
+                           double* position) {
+    double displacement[6];
+    for (int i = 0; i < 6; i++) {
+        displacement[i] = ((encoder[i] - reference[i]) * MICROMETERS_PER_ENCODER) / (1000.0 * 1000.0);
+    }
+    for (int k = 0; k < 6; k++) {
+        position[k] = m[k * 6 + 0] * displacement[2] + m[k * 6 + 1] * displacement[3] +
+                      m[k * 6 + 2] * displacement[4] + m[k * 6 + 3] * displacement[5] +
+                      m[k * 6 + 4] * displacement[0] + m[k * 6 + 5] * displacement[1];
+    }
+}
+
+TEST_CASE("Kinematics match legacy conversions", "[HardpointKinematics]") {
+    std::mt19937 gen(39);
+    auto toHardpoint = randomMatrix(gen);
+    auto toMirror = randomMatrix(gen);
+
+    HardpointKinematics kinematics;
+    kinematics.load(toHardpoint, toMirror, MICROMETERS_PER_STEP, MICROMETERS_PER_ENCODER);
+
+    REQUIRE_THAT(kinematics.getStepsToEncoder(),
+                 WithinAbs(MICROMETERS_PER_STEP / MICROMETERS_PER_ENCODER, 1e-12));
+
+    std::uniform_real_distribution<double> offset(-0.005, 0.005);
+    std::uniform_int_distribution<int32_t> encoder(-50000, 50000);
+
+    const size_t count = 100;
+    std::vector<double> positions(count * 6);
+    std::vector<int32_t> encoders(count * HP_COUNT);
+    for (auto& p : positions) {
+        p = offset(gen);
+    }
+    for (auto& e : encoders) {
+        e = encoder(gen);
+    }
+    int32_t reference[HP_COUNT] = {1000, -2000, 3000, -4000, 5000, -6000};
+
+    std::vector<int32_t> steps(count * HP_COUNT);
+    kinematics.positionsToSteps(positions.data(), steps.data(), count);
+
+    std::vector<double> calculated(count * 6);
+    kinematics.encodersToPositions(encoders.data(), reference, calculated.data(), count);
+
+    for (size_t i = 0; i < count; i++) {
+        int32_t expectedSteps[HP_COUNT];
+        legacySteps(toHardpoint, positions.data() + i * 6, expectedSteps);
+        double expectedPosition[6];
+        legacyPosition(toMirror, encoders.data() + i * HP_COUNT, reference, expectedPosition);
+        for (int hp = 0; hp < HP_COUNT; hp++) {
+            // summation order might differ - allow truncation to the other side
+            CHECK(std::abs(steps[i * HP_COUNT + hp] - expectedSteps[hp]) <= 1);
+        }
+        for (int axis = 0; axis < 6; axis++) {
+            CHECK_THAT(calculated[i * 6 + axis], WithinAbs(expectedPosition[axis], 1e-12));
+        }
+    }
+}
+
+TEST_CASE("Kinematics round trip", "[HardpointKinematics]") {
+    // identity matrices - hardpoint 3 moves with x
+    std::vector<double> identity(36, 0);
+    for (int i = 0; i < 6; i++) {
+        identity[i * 6 + i] = 1;
+    }
+
+    HardpointKinematics kinematics;
+    kinematics.load(identity, identity, 1.0, 1.0);
+
+    double position[6] = {0.001, 0, 0, 0, 0, 0};
+    int32_t steps[HP_COUNT];
+    kinematics.positionToSteps(position, steps);
+    CHECK(steps[2] == 1000);
+    CHECK(steps[0] == 0);
+
+    int32_t reference[HP_COUNT] = {0, 0, 0, 0, 0, 0};
+    double back[6];
+    kinematics.encoderToPosition(steps, reference, back);
+    CHECK_THAT(back[0], WithinAbs(0.001, 1e-12));
+    CHECK_THAT(back[1], WithinAbs(0, 1e-12));
+}
+
+TEST_CASE("Kinematics invalid matrix", "[HardpointKinematics]") {
+    HardpointKinematics kinematics;
+    std::vector<double> small(35, 0);
+    std::vector<double> valid(36, 0);
+    REQUIRE_THROWS(kinematics.load(small, valid, 1.0, 1.0));
+    REQUIRE_THROWS(kinematics.load(valid, small, 1.0, 1.0));
+}
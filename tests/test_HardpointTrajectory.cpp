@@ -0,0 +1,121 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests HardpointTrajectory.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+
+#include <catch2/catch_all.hpp>
+
+#include <HardpointTrajectory.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Single segment is spread evenly", "[HardpointTrajectory]") {
+    HardpointTrajectory trajectory;
+
+    int32_t steps[HP_COUNT] = {1000, -250, 0, 3, -999, 100};
+    REQUIRE(trajectory.addSegment(steps, 100) == 10);
+    REQUIRE(trajectory.cycles() == 10);
+
+    CHECK(trajectory.finished(2));
+    CHECK(trajectory.next(2) == 0);
+
+    int32_t sum[HP_COUNT] = {0, 0, 0, 0, 0, 0};
+    for (size_t c = 0; c < 10; c++) {
+        for (int hp = 0; hp < HP_COUNT; hp++) {
+            int32_t quota = trajectory.next(hp);
+            CHECK(std::abs(quota) <= 100);
+            sum[hp] += quota;
+            CHECK(trajectory.remaining(hp) == steps[hp] - sum[hp]);
+        }
+        // all non zero hardpoints finish in the same cycle
+        for (int hp = 0; hp < HP_COUNT; hp++) {
+            CHECK(trajectory.finished(hp) == (c == 9 || steps[hp] == 0));
+        }
+    }
+
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        CHECK(sum[hp] == steps[hp]);
+        CHECK(trajectory.next(hp) == 0);
+    }
+}
+
+TEST_CASE("Multiple segments", "[HardpointTrajectory]") {
+    HardpointTrajectory trajectory;
+
+    int32_t out[HP_COUNT] = {300, 0, 0, 0, 0, -300};
+    int32_t back[HP_COUNT] = {-300, 50, 0, 0, 0, 300};
+    REQUIRE(trajectory.addSegment(out, 100) == 3);
+    REQUIRE(trajectory.addSegment(back, 100) == 3);
+
+    int32_t expected[6] = {100, 100, 100, -100, -100, -100};
+    for (int c = 0; c < 6; c++) {
+        CHECK(trajectory.next(0) == expected[c]);
+        CHECK(trajectory.next(5) == -expected[c]);
+    }
+    CHECK(trajectory.finished(0));
+    CHECK(trajectory.remaining(0) == 0);
+
+    // hardpoint 2 waits for the first segment, then moves
+    int32_t sum = 0;
+    for (int c = 0; c < 6; c++) {
+        CHECK(trajectory.finished(1) == false);
+        int32_t quota = trajectory.next(1);
+        if (c < 3) {
+            CHECK(quota == 0);
+        }
+        sum += quota;
+    }
+    CHECK(sum == 50);
+    CHECK(trajectory.finished(1));
+}
+
+TEST_CASE("Single hardpoint and stop", "[HardpointTrajectory]") {
+    HardpointTrajectory trajectory;
+
+    int32_t steps[HP_COUNT] = {500, 500, 500, 500, 500, 500};
+    trajectory.addSegment(steps, 100);
+
+    trajectory.setHardpoint(3, -150, 100);
+    CHECK(trajectory.remaining(3) == -150);
+    CHECK(trajectory.next(3) == -75);
+    CHECK(trajectory.next(3) == -75);
+    CHECK(trajectory.finished(3));
+
+    CHECK(trajectory.next(0) == 100);
+    trajectory.stop(0);
+    CHECK(trajectory.finished(0));
+    CHECK(trajectory.remaining(0) == 0);
+    CHECK(trajectory.next(0) == 0);
+
+    CHECK(trajectory.finished(1) == false);
+    CHECK(trajectory.remaining(1) == 500);
+
+    trajectory.clear();
+    for (int hp = 0; hp < HP_COUNT; hp++) {
+        CHECK(trajectory.finished(hp));
+    }
+    CHECK(trajectory.cycles() == 0);
+
+    REQUIRE_THROWS(trajectory.addSegment(steps, 0));
+    REQUIRE_THROWS(trajectory.setHardpoint(0, 10, 40000));
+}
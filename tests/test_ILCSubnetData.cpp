@@ -0,0 +1,215 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests ILCSubnetData.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <map>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <ForceActuatorApplicationSettings.h>
+#include <HardpointActuatorApplicationSettings.h>
+#include <HardpointMonitorApplicationSettings.h>
+#include <ILCSubnetData.h>
+
+using namespace LSST::M1M3::SS;
+
+static HardpointActuatorApplicationSettings hpSettings;
+static HardpointMonitorApplicationSettings hmSettings;
+
+TEST_CASE("ILC lookups", "[ILCSubnetData]") {
+    ILCSubnetData subnetData(&hpSettings, &hmSettings);
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    int faCount = 0;
+    for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
+        for (int faIndex = 0; faIndex < subnetData.getFACount(subnetIndex); faIndex++) {
+            const ILCMap& fa = subnetData.getFAIndex(subnetIndex, faIndex);
+            auto& row = faa_settings.Table[fa.DataIndex];
+
+            CHECK(fa.Type == ILCTypes::FA);
+            CHECK(fa.Subnet == subnetIndex + 1);
+            CHECK(fa.Subnet == row.Subnet);
+            CHECK(fa.Address == row.Address);
+            CHECK(fa.ActuatorId == row.ActuatorID);
+            CHECK(fa.XDataIndex == faa_settings.ZIndexToXIndex[fa.DataIndex]);
+            CHECK(fa.YDataIndex == faa_settings.ZIndexToYIndex[fa.DataIndex]);
+            CHECK(fa.SecondaryDataIndex == faa_settings.ZIndexToSecondaryCylinderIndex[fa.DataIndex]);
+            CHECK(fa.Disabled == false);
+
+            CHECK(&subnetData.getILCDataFromAddress(subnetIndex, fa.Address) == &fa);
+            CHECK(&subnetData.getMap(fa.ActuatorId) == &fa);
+
+            faCount++;
+        }
+    }
+    REQUIRE(faCount == FA_COUNT);
+
+    REQUIRE(subnetData.getHPCount(4) == HP_COUNT);
+    REQUIRE(subnetData.getHMCount(4) == HP_COUNT);
+    for (int i = 0; i < HP_COUNT; i++) {
+        const ILCMap& hp = subnetData.getHPIndex(4, i);
+        CHECK(hp.Type == ILCTypes::HP);
+        CHECK(hp.ActuatorId == hpSettings.Table[i].ActuatorID);
+        CHECK(hp.DataIndex == hpSettings.Table[i].Index);
+        CHECK(&subnetData.getILCDataFromAddress(4, hp.Address) == &hp);
+
+        const ILCMap& hm = subnetData.getHMIndex(4, i);
+        CHECK(hm.Type == ILCTypes::HM);
+        CHECK(hm.ActuatorId == hmSettings.Table[i].ActuatorID);
+        CHECK(hm.DataIndex == hmSettings.Table[i].Index);
+        CHECK(&subnetData.getILCDataFromAddress(4, hm.Address) == &hm);
+    }
+
+    CHECK(subnetData.getILCDataFromAddress(0, 0).Type == ILCTypes::Unknown);
+    CHECK(subnetData.getILCDataFromAddress(4, 255).Type == ILCTypes::Unknown);
+    CHECK(subnetData.getMap(100).Address == 255);
+    CHECK(subnetData.getMap(100).Subnet == 255);
+    CHECK(subnetData.getMap(-1).Subnet == 255);
+    CHECK(subnetData.getMap(100000).Subnet == 255);
+}
+
+TEST_CASE("Disable and enable FA", "[ILCSubnetData]") {
+    ILCSubnetData subnetData(&hpSettings, &hmSettings);
+
+    const ILCMap& fa = subnetData.getMap(101);
+    REQUIRE(fa.Type == ILCTypes::FA);
+    REQUIRE(fa.Disabled == false);
+
+    subnetData.disableFA(101);
+    subnetData.disableFA(322);
+    CHECK(fa.Disabled);
+    // disabled flag is shared by all lookups
+    CHECK(subnetData.getILCDataFromAddress(fa.Subnet - 1, fa.Address).Disabled);
+    CHECK(subnetData.getMap(322).Disabled);
+
+    // only FA can be disabled
+    subnetData.disableFA(1);
+    CHECK(subnetData.getMap(1).Disabled == false);
+
+    subnetData.enableFA(101);
+    CHECK(fa.Disabled == false);
+    CHECK(subnetData.getMap(322).Disabled);
+
+    subnetData.enableAllFA();
+    CHECK(subnetData.getMap(322).Disabled == false);
+}
+
+/**
+ * Lookup as done before ILC data were stored in a flat table - per subnet
+ * vectors and address tables, returning ILCMap copies.
+ */
+class CopyLookup {
+    struct Container {
+        std::vector<ILCMap> FAIndex;
+        ILCMap ILCDataFromAddress[256];
+    };
+
+public:
+    CopyLookup(ILCSubnetData& subnetData) {
+        for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
+            for (int faIndex = 0; faIndex < subnetData.getFACount(subnetIndex); faIndex++) {
+                ILCMap fa = subnetData.getFAIndex(subnetIndex, faIndex);
+                _subnetData[subnetIndex].FAIndex.push_back(fa);
+                _subnetData[subnetIndex].ILCDataFromAddress[fa.Address] = fa;
+            }
+        }
+    }
+
+    ILCMap getILCDataFromAddress(int32_t subnetIndex, uint8_t address) {
+        return _subnetData[subnetIndex].ILCDataFromAddress[address];
+    }
+
+    ILCMap getMap(int32_t actuatorId) {
+        for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; ++subnetIndex) {
+            Container container = _subnetData[subnetIndex];
+            for (size_t i = 0; i < container.FAIndex.size(); ++i) {
+                if (container.FAIndex[i].ActuatorId == actuatorId) {
+                    return container.FAIndex[i];
+                }
+            }
+        }
+        ILCMap none;
+        none.Address = 255;
+        none.Subnet = 255;
+        return none;
+    }
+
+private:
+    Container _subnetData[SUBNET_COUNT];
+};
+
+TEST_CASE("Benchmark lookups of a cycle responses", "[ILCSubnetData][!benchmark]") {
+    ILCSubnetData subnetData(&hpSettings, &hmSettings);
+    CopyLookup copyLookup(subnetData);
+
+    // responses received in a cycle - force demand and status responses from all FAs
+    std::vector<std::pair<int, uint8_t>> responses;
+    for (int subnetIndex = 0; subnetIndex < SUBNET_COUNT; subnetIndex++) {
+        for (int faIndex = 0; faIndex < subnetData.getFACount(subnetIndex); faIndex++) {
+            uint8_t address = subnetData.getFAIndex(subnetIndex, faIndex).Address;
+            responses.push_back(std::make_pair(subnetIndex, address));
+            responses.push_back(std::make_pair(subnetIndex, address));
+        }
+    }
+
+    int32_t expected[FA_COUNT] = {};
+
+    BENCHMARK("ILCMap copies") {
+        for (auto& r : responses) {
+            const ILCMap& ilc = copyLookup.getILCDataFromAddress(r.first, r.second);
+            expected[ilc.DataIndex] += ilc.XDataIndex + ilc.YDataIndex + ilc.SecondaryDataIndex;
+        }
+        return expected[0];
+    };
+
+    BENCHMARK("Flat table references") {
+        for (auto& r : responses) {
+            const ILCMap& ilc = subnetData.getILCDataFromAddress(r.first, r.second);
+            expected[ilc.DataIndex] += ilc.XDataIndex + ilc.YDataIndex + ilc.SecondaryDataIndex;
+        }
+        return expected[0];
+    };
+
+    auto& faa_settings = ForceActuatorApplicationSettings::instance();
+
+    // ForceController checks if FAs are disabled in every cycle
+    BENCHMARK("Disabled check with ILCMap copies") {
+        int disabled = 0;
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (copyLookup.getMap(faa_settings.ZIndexToActuatorId(i)).Disabled) {
+                disabled++;
+            }
+        }
+        return disabled;
+    };
+
+    BENCHMARK("Disabled check with flat table") {
+        int disabled = 0;
+        for (int i = 0; i < FA_COUNT; i++) {
+            if (subnetData.getMap(faa_settings.ZIndexToActuatorId(i)).Disabled) {
+                disabled++;
+            }
+        }
+        return disabled;
+    };
+}
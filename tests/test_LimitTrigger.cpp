@@ -20,20 +20,22 @@
  * this program. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <vector>
+
 #include <catch2/catch_all.hpp>
 
 #include <LimitTrigger.h>
 
 using namespace LSST::M1M3::SS;
 
-class MyLimitTrigger : public LimitTrigger<const char*> {
+class MyLimitTrigger : public LimitTrigger<MyLimitTrigger, const char*> {
 public:
     MyLimitTrigger(int minOccurence) : executedCount(0) {
         reset();
         _minOccurence = minOccurence;
     }
 
-    void reset() override {
+    void reset() {
         _counter = 0;
         message = NULL;
     }
@@ -42,8 +44,10 @@ public:
     const char* message;
 
 protected:
-    bool trigger() override { return ++_counter >= _minOccurence; }
-    void execute(const char* msg) override {
+    friend LimitTrigger;
+
+    bool trigger() { return ++_counter >= _minOccurence; }
+    void execute(const char* msg) {
         executedCount++;
         message = msg;
     }
@@ -81,3 +85,23 @@ TEST_CASE("Simple LimitTrigger", "[LimitTrigger]") {
     REQUIRE(limitTrigger.executedCount == 3);
     REQUIRE(limitTrigger.message == m3);
 }
+
+TEST_CASE("OccurrenceCounter levels", "[LimitTrigger]") {
+    OccurrenceCounter<1000> counter;
+
+    std::vector<uint32_t> reported;
+    for (int i = 0; i < 3500; i++) {
+        if (counter.next()) {
+            reported.push_back(counter.count());
+        }
+    }
+    REQUIRE(reported == std::vector<uint32_t>({1, 200, 500, 1000, 2000, 3000}));
+    REQUIRE(counter.count() == 3500);
+
+    REQUIRE(counter.restart() == 3500);
+    REQUIRE(counter.count() == 0);
+
+    REQUIRE(counter.next() == true);
+    REQUIRE(counter.next() == false);
+    REQUIRE(counter.count() == 2);
+}
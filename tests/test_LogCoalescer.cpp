@@ -0,0 +1,168 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests LogCoalescer.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <LogCoalescer.h>
+
+using namespace LSST::M1M3::SS;
+using namespace std::chrono_literals;
+
+TEST_CASE("LogCoalescer coalesce repeated messages", "[LogCoalescer]") {
+    LogCoalescer coalescer(1s);
+    std::vector<LogEntry> out;
+
+    auto now = std::chrono::steady_clock::now();
+
+    LogEntry warning{30, "Force limit", "file.cpp", "func", 10};
+    LogEntry error{40, "Fault", "file.cpp", "func", 20};
+
+    coalescer.add(warning, now, out);
+    REQUIRE(out.size() == 1);
+    REQUIRE(out[0].message == "Force limit");
+
+    for (int i = 0; i < 50; i++) {
+        coalescer.add(warning, now + i * 10ms, out);
+    }
+    REQUIRE(out.size() == 1);
+    REQUIRE(coalescer.getCoalesced() == 50);
+
+    // same text with different level isn't coalesced
+    LogEntry info = warning;
+    info.level = 20;
+    coalescer.add(info, now + 600ms, out);
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[1].message == "Force limit");
+    REQUIRE(out[1].level == 20);
+
+    out.clear();
+    coalescer.add(error, now + 700ms, out);
+    REQUIRE(out.size() == 1);
+    REQUIRE(out[0].message == "Fault");
+
+    out.clear();
+    coalescer.expire(now + 5s, out);
+    REQUIRE(out.size() == 1);
+    REQUIRE(out[0].message == "Force limit (repeated 50 more times)");
+    REQUIRE(out[0].level == 30);
+    REQUIRE(coalescer.getCoalesced() == 50);
+
+    // nothing pending
+    coalescer.expire(now + 6s, out);
+    REQUIRE(out.size() == 1);
+}
+
+TEST_CASE("LogCoalescer coalesce interleaved messages", "[LogCoalescer]") {
+    LogCoalescer coalescer(1s);
+    std::vector<LogEntry> out;
+
+    auto now = std::chrono::steady_clock::now();
+
+    LogEntry a{30, "Force limit", "file.cpp", "func", 10};
+    LogEntry b{30, "Following error", "file.cpp", "func", 20};
+
+    for (int i = 0; i < 10; i++) {
+        coalescer.add(a, now + i * 20ms, out);
+        coalescer.add(b, now + i * 20ms + 10ms, out);
+    }
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[0].message == "Force limit");
+    REQUIRE(out[1].message == "Following error");
+    REQUIRE(coalescer.getCoalesced() == 18);
+
+    coalescer.expire(now + 1100ms, out);
+    REQUIRE(out.size() == 4);
+    REQUIRE(out[2].message == "Force limit (repeated 9 more times)");
+    REQUIRE(out[3].message == "Following error (repeated 9 more times)");
+}
+
+TEST_CASE("LogCoalescer evicts oldest message when table is full", "[LogCoalescer]") {
+    LogCoalescer coalescer(1s);
+    std::vector<LogEntry> out;
+
+    auto now = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < LogCoalescer::TABLE_SIZE; i++) {
+        LogEntry entry{30, "Message " + std::to_string(i), "file.cpp", "func", 10};
+        coalescer.add(entry, now + i * 10ms, out);
+        coalescer.add(entry, now + i * 10ms + 5ms, out);
+    }
+    REQUIRE(out.size() == LogCoalescer::TABLE_SIZE);
+
+    out.clear();
+    LogEntry extra{30, "Extra", "file.cpp", "func", 10};
+    coalescer.add(extra, now + 200ms, out);
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[0].message == "Message 0 (repeated 1 more times)");
+    REQUIRE(out[1].message == "Extra");
+
+    // Message 0 was evicted, its next occurrence is published again
+    out.clear();
+    LogEntry first{30, "Message 0", "file.cpp", "func", 10};
+    coalescer.add(first, now + 300ms, out);
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[0].message == "Message 1 (repeated 1 more times)");
+    REQUIRE(out[1].message == "Message 0");
+}
+
+TEST_CASE("LogCoalescer window expiration", "[LogCoalescer]") {
+    LogCoalescer coalescer(1s);
+    std::vector<LogEntry> out;
+
+    auto now = std::chrono::steady_clock::now();
+
+    LogEntry warning{30, "Following error", "file.cpp", "func", 10};
+
+    coalescer.add(warning, now, out);
+    coalescer.add(warning, now + 100ms, out);
+    coalescer.add(warning, now + 200ms, out);
+    REQUIRE(out.size() == 1);
+
+    coalescer.expire(now + 500ms, out);
+    REQUIRE(out.size() == 1);
+
+    coalescer.expire(now + 1100ms, out);
+    REQUIRE(out.size() == 2);
+    REQUIRE(out[1].message == "Following error (repeated 2 more times)");
+
+    // new window starts with the next message
+    coalescer.add(warning, now + 1200ms, out);
+    REQUIRE(out.size() == 3);
+    REQUIRE(out[2].message == "Following error");
+
+    // message after window expiration is published, with summary of the previous
+    coalescer.add(warning, now + 1300ms, out);
+    coalescer.add(warning, now + 2300ms, out);
+    REQUIRE(out.size() == 5);
+    REQUIRE(out[3].message == "Following error (repeated 1 more times)");
+    REQUIRE(out[4].message == "Following error");
+
+    coalescer.add(warning, now + 2400ms, out);
+    coalescer.expire(now + 2500ms, out, true);
+    REQUIRE(out.size() == 6);
+    REQUIRE(coalescer.getCoalesced() == 4);
+}
@@ -0,0 +1,199 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests Modbus frame patcher.
+ *
+ * Developed for the Vera C. Rubin Telescope and Site System.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+#include <random>
+
+#include <ILCMessageFactory.h>
+#include <ModbusBuffer.h>
+#include <ModbusFramePatcher.h>
+
+using namespace LSST::M1M3::SS;
+
+struct ForceDemand {
+    uint8_t broadcastCounter;
+    uint8_t boosterValves;
+    int32_t saaPrimary[16];
+    int32_t daaPrimary[32];
+    int32_t daaSecondary[32];
+};
+
+void write_frame(ILCMessageFactory& factory, ModbusBuffer& buffer, ForceDemand& demand) {
+    buffer.setIndex(0);
+    factory.broadcastForceDemand(&buffer, demand.broadcastCounter, demand.boosterValves, demand.saaPrimary,
+                                 demand.daaPrimary, demand.daaSecondary);
+}
+
+void patch_frame(ModbusFramePatcher& patcher, ForceDemand& demand) {
+    ILCMessageFactory::patchBroadcastForceDemand(&patcher, demand.broadcastCounter, demand.boosterValves,
+                                                 demand.saaPrimary, demand.daaPrimary, demand.daaSecondary);
+}
+
+void check_identical(ModbusBuffer& a, ModbusBuffer& b, int32_t length) {
+    REQUIRE(memcmp(a.getBuffer(), b.getBuffer(), length * sizeof(uint16_t)) == 0);
+}
+
+TEST_CASE("Patched broadcast force demand matches encoded", "[ModbusFramePatcher]") {
+    ILCMessageFactory factory;
+
+    ForceDemand demand;
+    memset(&demand, 0, sizeof(demand));
+
+    ModbusBuffer encoded;
+    ModbusBuffer patched;
+
+    write_frame(factory, encoded, demand);
+    write_frame(factory, patched, demand);
+
+    int32_t length = encoded.getIndex();
+
+    ModbusFramePatcher patcher;
+    REQUIRE(patcher.attached() == false);
+    patcher.attach(&patched, 0, ILCMessageFactory::BROADCAST_FORCE_DEMAND_LENGTH);
+    REQUIRE(patcher.attached());
+
+    std::mt19937 gen(9876);
+    std::uniform_int_distribution<int> setpoint(-8388608, 8388607);
+    std::uniform_int_distribution<int> slot(0, 79);
+    std::uniform_int_distribution<int> changes(0, 10);
+
+    SECTION("Unchanged frame") {
+        patch_frame(patcher, demand);
+        check_identical(encoded, patched, length);
+    }
+
+    SECTION("Random changes") {
+        for (int cycle = 0; cycle < 5000; cycle++) {
+            demand.broadcastCounter = (demand.broadcastCounter + 16) & 0xF0;
+            if (cycle % 100 == 0) {
+                demand.boosterValves = demand.boosterValves ? 0 : 255;
+            }
+            int n = changes(gen);
+            for (int c = 0; c < n; c++) {
+                int s = slot(gen);
+                if (s < 16) {
+                    demand.saaPrimary[s] = setpoint(gen);
+                } else if (s < 48) {
+                    demand.daaPrimary[s - 16] = setpoint(gen);
+                } else {
+                    demand.daaSecondary[s - 48] = setpoint(gen);
+                }
+            }
+
+            write_frame(factory, encoded, demand);
+            patch_frame(patcher, demand);
+
+            check_identical(encoded, patched, length);
+        }
+    }
+
+    SECTION("All setpoints changed") {
+        for (int cycle = 0; cycle < 100; cycle++) {
+            for (int i = 0; i < 16; i++) demand.saaPrimary[i] = setpoint(gen);
+            for (int i = 0; i < 32; i++) demand.daaPrimary[i] = setpoint(gen);
+            for (int i = 0; i < 32; i++) demand.daaSecondary[i] = setpoint(gen);
+
+            write_frame(factory, encoded, demand);
+            patch_frame(patcher, demand);
+
+            check_identical(encoded, patched, length);
+        }
+    }
+}
+
+TEST_CASE("Patch frame inside buffer", "[ModbusFramePatcher]") {
+    ModbusBuffer encoded;
+    ModbusBuffer patched;
+
+    for (auto buffer : {&encoded, &patched}) {
+        buffer->writeU8(18);
+        buffer->writeU8(17);
+        buffer->writeCRC(2);
+        buffer->writeEndOfFrame();
+        buffer->writeU8(249);
+        buffer->writeU8(68);
+        buffer->writeU8(0);
+        buffer->writeCRC(3);
+        buffer->writeEndOfFrame();
+    }
+
+    ModbusFramePatcher patcher;
+    patcher.attach(&patched, 5, 3);
+
+    for (int counter = 0; counter < 256; counter++) {
+        encoded.setIndex(5);
+        encoded.writeU8(249);
+        encoded.writeU8(68);
+        encoded.writeU8(counter);
+        encoded.writeCRC(3);
+
+        patcher.patchU8(2, counter);
+        patcher.writeCRC();
+
+        check_identical(encoded, patched, encoded.getIndex() + 1);
+    }
+}
+
+TEST_CASE("Benchmark force demand encoding", "[!benchmark][ModbusFramePatcher]") {
+    ILCMessageFactory factory;
+
+    ForceDemand demand;
+    memset(&demand, 0, sizeof(demand));
+
+    ModbusBuffer encoded;
+    ModbusBuffer patched;
+
+    write_frame(factory, encoded, demand);
+    write_frame(factory, patched, demand);
+
+    ModbusFramePatcher patcher;
+    patcher.attach(&patched, 0, ILCMessageFactory::BROADCAST_FORCE_DEMAND_LENGTH);
+
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> setpoint(-100000, 100000);
+    std::uniform_int_distribution<int> slot(0, 31);
+
+    auto update = [&]() {
+        demand.broadcastCounter = (demand.broadcastCounter + 16) & 0xF0;
+        for (int c = 0; c < 4; c++) {
+            demand.daaPrimary[slot(gen)] = setpoint(gen);
+        }
+    };
+
+    BENCHMARK("Full encoding") {
+        update();
+        write_frame(factory, encoded, demand);
+        return encoded.getIndex();
+    };
+
+    BENCHMARK("Patching") {
+        update();
+        patch_frame(patcher, demand);
+        return patched.getIndex();
+    };
+
+    write_frame(factory, encoded, demand);
+    check_identical(encoded, patched, encoded.getIndex());
+}
@@ -24,22 +24,80 @@
 #include <catch2/catch_all.hpp>
 
 #include <cmath>
-#include <iostream>
-#include <memory>
+#include <math.h>
+#include <random>
 
-#include <SAL_MTM1M3.h>
-
-#include <M1M3SSPublisher.h>
-#include <PID.h>
+#include <PIDBank.h>
 
 using namespace LSST::M1M3::SS;
 
-TEST_CASE("Constant_PID", "[PID]") {
-    std::shared_ptr<SAL_MTM1M3> m1m3SAL = std::make_shared<SAL_MTM1M3>();
-    m1m3SAL->setDebugLevel(0);
-    M1M3SSPublisher::instance().setSAL(m1m3SAL);
+constexpr double THAW_STEP = 50;
+
+/**
+ * Scalar PID as implemented before controllers were merged into PIDBank.
+ * Used to verify the bank produces identical results. getOffset is copied
+ * verbatim from PID.cpp. There abs resolved to the double std::abs overload,
+ * which <math.h> (included through M1M3SSPublisher.h and FABumpTestData.h)
+ * brings into the global namespace - the same is done here.
+ */
+class LegacyPID {
+public:
+    LegacyPID(PIDParameters parameters) { updateParameters(parameters); }
+
+    void updateParameters(PIDParameters parameters) {
+        double Kp = parameters.P;
+        double Ki = parameters.I;
+        double Kd = parameters.D;
+        double N = parameters.N;
+        double Ts = parameters.Timestep;
+        A = Kp + Kd * N;
+        B = -2.0 * Kp + Kp * N * Ts + Ki * Ts - 2.0 * Kd * N;
+        C = Kp - Kp * N * Ts - Ki * Ts + Ki * N * Ts * Ts + Kd * N;
+        D = 2.0 - N * Ts;
+        E = N * Ts - 1.0;
+        e = e1 = e2 = u = u1 = u2 = 0;
+    }
+
+    double process(double setpoint, double measurement) {
+        e2 = e1;
+        e1 = e;
+        e = setpoint - measurement;
+        u2 = u1;
+        u1 = u;
+        u = D * u1 + E * u2 + A * e + B * e1 + C * e2;
+        return u + getOffset(nullptr);
+    }
+
+    void freeze() {
+        offset = u;
+        frozen = true;
+    }
+
+    void thaw() { frozen = false; }
+
+    double getOffset(bool* changed) {
+        if (abs(offset) > 0 && frozen == false) {
+            if (abs(offset) < (THAW_STEP + 1)) {
+                offset = 0;
+            } else {
+                offset -= offset > 0 ? THAW_STEP : -THAW_STEP;
+            }
+            if (changed != nullptr) {
+                *changed = true;
+            }
+        }
+        return offset;
+    }
+
+private:
+    double A, B, C, D, E;
+    double e, e1, e2, u, u1, u2;
+    double offset = 0;
+    bool frozen = false;
+};
 
-    PID* pids[6];
+TEST_CASE("Constant_PID", "[PID]") {
+    PIDBank pids;
     PIDParameters pparams;
     pparams.Timestep = 1;
     pparams.P = 1;
@@ -48,30 +106,25 @@ TEST_CASE("Constant_PID", "[PID]") {
     pparams.N = 1;
 
     for (int i = 0; i < 6; i++) {
-        pids[i] = new PID(i, pparams);
+        pids.configure(i, pparams);
     }
 
     double te = 0;
 
-    for (int i = 0; i < 6; i++) {
-        for (int n = 0; n < 1000; n++) {
-            te += pids[i]->process(n, n);
+    for (int n = 0; n < 1000; n++) {
+        double setpoints[6] = {double(n), double(n), double(n), double(n), double(n), double(n)};
+        double outputs[6];
+        pids.process(setpoints, setpoints, outputs);
+        for (int i = 0; i < 6; i++) {
+            te += outputs[i];
         }
     }
 
     REQUIRE(te == 0);
-
-    for (int i = 0; i < 6; i++) {
-        delete pids[i];
-    }
 }
 
 TEST_CASE("PID_convergence", "[PID]") {
-    std::shared_ptr<SAL_MTM1M3> m1m3SAL = std::make_shared<SAL_MTM1M3>();
-    m1m3SAL->setDebugLevel(0);
-    M1M3SSPublisher::instance().setSAL(m1m3SAL);
-
-    PID* pids[6];
+    PIDBank pids;
     PIDParameters pparams;
     pparams.Timestep = 0.1;
     pparams.P = 0.5;
@@ -80,37 +133,187 @@ TEST_CASE("PID_convergence", "[PID]") {
     pparams.N = 0.2;
 
     for (int i = 0; i < 6; i++) {
-        pids[i] = new PID(i, pparams);
+        pids.configure(i, pparams);
     }
 
+    double setpoints[6] = {1000, 1000, 1000, 1000, 1000, 1000};
+    double measurements[6] = {0, 0, 0, 0, 0, 0};
+    double u0[6];
+    pids.process(setpoints, measurements, u0);
     for (int i = 0; i < 6; i++) {
-        double u0 = pids[i]->process(1000, 0);
-        REQUIRE(u0 == 520);
-        for (int n = 0; n < 1000; n += 100) {
-            REQUIRE(fabs(pids[i]->process(1000, n)) < u0 * 1.2);
+        REQUIRE(u0[i] == 520);
+    }
+
+    double u[6];
+    for (int n = 0; n < 1000; n += 100) {
+        std::fill(measurements, measurements + 6, n);
+        pids.process(setpoints, measurements, u);
+        for (int i = 0; i < 6; i++) {
+            REQUIRE(fabs(u[i]) < u0[i] * 1.2);
         }
+    }
+
+    double m = 1000;
+
+    int n = 1000000;
+    bool eLow = false;
+
+    for (; n > 0; n -= 1) {
+        std::fill(measurements, measurements + 6, m);
+        pids.process(setpoints, measurements, u);
+
+        m = 1000 + (n / 10000) * sin((180 * M_PI) / n);
+
+        if (fabs(u[0]) < 1 && eLow == false) {
+            REQUIRE(n < 890000);
+            eLow = true;
+        }
+    }
 
-        double m = 1000;
+    for (int i = 0; i < 6; i++) {
+        REQUIRE(u[i] < 1);
+        REQUIRE(u[i] == u[0]);
+    }
+}
 
-        int n = 1000000;
-        bool eLow = false;
-        double u;
+TEST_CASE("PID bank matches legacy PID", "[PID]") {
+    std::mt19937 gen(40);
+    std::uniform_real_distribution<double> gain(0.0, 2.0);
+    std::uniform_real_distribution<double> force(-2000.0, 2000.0);
 
-        for (; n > 0; n -= 1) {
-            u = pids[i]->process(1000, m);
+    auto randomParameters = [&]() {
+        return PIDParameters(0.02, gain(gen), gain(gen), gain(gen) / 10, gain(gen));
+    };
 
-            m = 1000 + (n / 10000) * sin((180 * M_PI) / n);
+    PIDBank pids;
+    std::vector<LegacyPID> legacy;
+    for (int i = 0; i < 6; i++) {
+        PIDParameters p = randomParameters();
+        pids.configure(i, p);
+        legacy.emplace_back(p);
+    }
 
-            if (fabs(u) < 1 && eLow == false) {
-                REQUIRE(n < 890000);
-                eLow = true;
+    double setpoints[6] = {0, 0, 0, 0, 0, 0};
+
+    for (int n = 0; n < 5000; n++) {
+        if (n == 1000) {
+            pids.freeze();
+            for (auto& l : legacy) {
+                l.freeze();
+            }
+        }
+        if (n == 2000) {
+            // gain scheduling as done for slews
+            for (int i = 0; i < 6; i++) {
+                PIDParameters p = randomParameters();
+                pids.updateParameters(i, p);
+                legacy[i].updateParameters(p);
+            }
+        }
+        if (n >= 1000 && n < 2500) {
+            double offsets[6];
+            bool changed = pids.getOffsets(offsets);
+            bool legacyChanged = false;
+            for (int i = 0; i < 6; i++) {
+                REQUIRE(offsets[i] == legacy[i].getOffset(&legacyChanged));
+            }
+            REQUIRE(changed == legacyChanged);
+            continue;
+        }
+        if (n == 2500) {
+            pids.thaw();
+            for (auto& l : legacy) {
+                l.thaw();
             }
         }
 
-        REQUIRE(u < 1);
+        double measurements[6];
+        for (int i = 0; i < 6; i++) {
+            measurements[i] = force(gen);
+        }
+        double outputs[6];
+        pids.process(setpoints, measurements, outputs);
+        for (int i = 0; i < 6; i++) {
+            REQUIRE(outputs[i] == legacy[i].process(setpoints[i], measurements[i]));
+        }
     }
+}
 
+TEST_CASE("Sub-unit frozen offset thaws as in legacy PID", "[PID]") {
+    PIDParameters pparams(1, 1, 0, 0, 1);
+
+    PIDBank pids;
+    LegacyPID legacy(pparams);
     for (int i = 0; i < 6; i++) {
-        delete pids[i];
+        pids.configure(i, pparams);
     }
+
+    double setpoints[6] = {0.4, -0.4, 0.4, -0.4, 0.4, -0.4};
+    double measurements[6] = {0, 0, 0, 0, 0, 0};
+    double outputs[6];
+    pids.process(setpoints, measurements, outputs);
+    REQUIRE(outputs[0] == legacy.process(setpoints[0], measurements[0]));
+
+    pids.freeze();
+    legacy.freeze();
+    pids.thaw();
+    legacy.thaw();
+
+    bool legacyChanged = false;
+    REQUIRE(legacy.getOffset(&legacyChanged) == 0);
+    REQUIRE(legacyChanged == true);
+
+    double offsets[6];
+    REQUIRE(pids.getOffsets(offsets) == true);
+    for (int i = 0; i < 6; i++) {
+        REQUIRE(offsets[i] == 0);
+    }
+}
+
+struct TestPIDData {
+    double setpoint[6], measuredPID[6], error[6], errorT1[6], errorT2[6], control[6], controlT1[6],
+            controlT2[6];
+};
+
+TEST_CASE("PID anti-windup", "[PID]") {
+    PIDBank pids;
+    for (int i = 0; i < 6; i++) {
+        pids.configure(i, PIDParameters(0.02, 0.5, 5.0, 0, 0, i < 3 ? 100 : 0));
+    }
+    REQUIRE(pids.getParameters(0).OutputLimit == 100);
+    REQUIRE(pids.getParameters(5).OutputLimit == 0);
+
+    double setpoints[6] = {0, 0, 0, 0, 0, 0};
+    double measurements[6] = {-500, -500, -500, -500, -500, -500};
+    double outputs[6];
+
+    // saturate
+    for (int n = 0; n < 500; n++) {
+        pids.process(setpoints, measurements, outputs);
+        REQUIRE(outputs[0] <= 100);
+    }
+    REQUIRE(outputs[0] == 100);
+    REQUIRE(outputs[5] > 5000);
+
+    // reverse error - limited controller leaves saturation immediately,
+    // unlimited has to unwind the accumulated integral first
+    std::fill(measurements, measurements + 6, 50);
+    pids.process(setpoints, measurements, outputs);
+    REQUIRE(outputs[0] < 100);
+    REQUIRE(outputs[5] > 5000);
+
+    TestPIDData data;
+    pids.copyData(&data);
+    REQUIRE(data.measuredPID[0] == 50);
+    REQUIRE(data.control[0] == outputs[0]);
+    REQUIRE(data.control[0] == -100);
+
+    // NAN output limit keeps the current limit
+    pids.updateParameters(0, PIDParameters(0.02, 1, 1, 0, 0));
+    REQUIRE(pids.getParameters(0).OutputLimit == 100);
+    pids.updateParameters(0, PIDParameters(0.02, 1, 1, 0, 0, 0));
+    REQUIRE(pids.getParameters(0).OutputLimit == 0);
+    pids.restoreInitialParameters(0);
+    REQUIRE(pids.getParameters(0).OutputLimit == 100);
+    REQUIRE(pids.getParameters(0).I == 5.0);
 }
@@ -0,0 +1,82 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests PhaseTimer.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include <catch2/catch_all.hpp>
+
+#include <PhaseTimer.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Matchers::WithinAbs;
+
+const char* const PHASES[] = {"Wait", "Move", "Paused"};
+
+TEST_CASE("Phase durations", "[PhaseTimer]") {
+    PhaseTimer timer("Test", PHASES);
+
+    REQUIRE(timer.size() == 3);
+    REQUIRE(timer.running() == false);
+    REQUIRE(timer.getCurrent() == PhaseTimer::NONE);
+
+    timer.enter(0, 10);
+    REQUIRE(timer.running());
+    REQUIRE(timer.getCurrent() == 0);
+
+    // re-entering current phase doesn't change anything
+    timer.enter(0, 11);
+    timer.enter(1, 12);
+    REQUIRE_THAT(timer.getDuration(0), WithinAbs(2, 1e-6));
+
+    timer.enter(2, 15);
+    timer.enter(1, 16);
+    timer.enter(0, 20.5);
+    timer.finish(21);
+
+    REQUIRE(timer.running() == false);
+    REQUIRE_THAT(timer.getDuration(0), WithinAbs(2.5, 1e-6));
+    REQUIRE_THAT(timer.getDuration(1), WithinAbs(7.5, 1e-6));
+    REQUIRE_THAT(timer.getDuration(2), WithinAbs(1, 1e-6));
+    REQUIRE_THAT(timer.getTotal(), WithinAbs(11, 1e-6));
+    REQUIRE(timer.getName(1) == std::string("Move"));
+
+    // finish on stopped timer does nothing
+    timer.finish(30);
+    REQUIRE_THAT(timer.getTotal(), WithinAbs(11, 1e-6));
+
+    // new run clears durations
+    timer.enter(1, 100);
+    REQUIRE(timer.getDuration(0) == 0);
+    REQUIRE(timer.getDuration(1) == 0);
+    timer.finish(101);
+    REQUIRE_THAT(timer.getDuration(1), WithinAbs(1, 1e-6));
+
+    timer.reset();
+    REQUIRE(timer.getTotal() == 0);
+    REQUIRE(timer.getDuration(1) == 0);
+}
+
+TEST_CASE("Too many phases", "[PhaseTimer]") {
+    const char* names[PhaseTimer::MAX_PHASES + 1] = {};
+    REQUIRE_THROWS(PhaseTimer("Test", names, PhaseTimer::MAX_PHASES + 1));
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests RaiseLowerProfile.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+
+#include <catch2/catch_all.hpp>
+
+#include <RaiseLowerProfile.h>
+
+using namespace LSST::M1M3::SS;
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Disabled profile returns fixed increment", "[RaiseLowerProfile]") {
+    RaiseLowerProfile profile;
+
+    REQUIRE(profile.isEnabled() == false);
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.05, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.9), WithinAbs(0.05, 1e-6));
+
+    profile.configure(false, 5, 0.3, 0.8);
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.05, 1e-6));
+}
+
+TEST_CASE("Invalid profile parameters", "[RaiseLowerProfile]") {
+    RaiseLowerProfile profile;
+
+    REQUIRE_THROWS(profile.configure(true, 0.5, 0.3, 0.8));
+    REQUIRE_THROWS(profile.configure(true, 5, 0.8, 0.3));
+    REQUIRE_THROWS(profile.configure(true, 5, -0.1, 0.8));
+    REQUIRE_THROWS(profile.configure(true, 5, 0.3, 1.2));
+    REQUIRE_NOTHROW(profile.configure(true, 5, 0.3, 0.8));
+
+    REQUIRE_THROWS(RaiseLowerProfile::validate(0.5, 0.3, 0.8));
+    REQUIRE_THROWS(RaiseLowerProfile::validate(5, 0.3, 0.3));
+    REQUIRE_NOTHROW(RaiseLowerProfile::validate(1, 0, 1));
+}
+
+TEST_CASE("Increment adapts to utilization", "[RaiseLowerProfile]") {
+    RaiseLowerProfile profile;
+    profile.configure(true, 5, 0.3, 0.8);
+
+    // increment ramps by fixed increment per cycle
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.05, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.10, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.15, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.1), WithinAbs(0.20, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.2), WithinAbs(0.25, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.3), WithinAbs(0.25, 1e-6));
+
+    // decrease is immediate, interpolated between low and high utilization
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.55), WithinAbs(0.15, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 0.8), WithinAbs(0.05, 1e-6));
+    REQUIRE_THAT(profile.getIncrement(0.05, 1.5), WithinAbs(0.05, 1e-6));
+
+    // non-finite utilization falls back to fixed increment
+    REQUIRE_THAT(profile.getIncrement(0.05, NAN), WithinAbs(0.05, 1e-6));
+
+    profile.getIncrement(0.05, 0);
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.15, 1e-6));
+    profile.reset();
+    REQUIRE_THAT(profile.getIncrement(0.05, 0), WithinAbs(0.05, 1e-6));
+}
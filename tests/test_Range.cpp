@@ -26,19 +26,22 @@
 
 using namespace LSST::M1M3::SS;
 
-class SimpleLimitTrigger : public LimitTrigger<int> {
+class SimpleLimitTrigger : public LimitTrigger<SimpleLimitTrigger, int> {
 public:
     SimpleLimitTrigger(int occurences) : executedVal(0) {
         reset();
         _occurences = occurences;
     }
 
+    void reset() { _count = 0; }
+
     int executedVal;
 
 protected:
-    bool trigger() override { return ((++_count) % _occurences) == 0; }
-    void execute(int val) override { executedVal = val; }
-    void reset() override { _count = 0; }
+    friend LimitTrigger;
+
+    bool trigger() { return ((++_count) % _occurences) == 0; }
+    void execute(int val) { executedVal = val; }
 
 private:
     int _count;
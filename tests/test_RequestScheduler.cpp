@@ -0,0 +1,144 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests RequestScheduler.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <catch2/catch_all.hpp>
+
+#include <RequestScheduler.h>
+
+using namespace LSST::M1M3::SS;
+
+TEST_CASE("Unlimited budget keeps rates", "[RequestScheduler]") {
+    RequestScheduler scheduler;
+    scheduler.clear(0);
+    scheduler.reserve(100);
+
+    int every = scheduler.add(1, 10, 0);
+    int fifth = scheduler.add(5, 20, 0);
+    int spread[4];
+    for (int i = 0; i < 4; i++) {
+        spread[i] = scheduler.add(4, 15, i);
+    }
+
+    REQUIRE(scheduler.getMandatoryBytes() == 110);
+
+    int fifthSent = 0;
+    for (int cycle = 0; cycle < 100; cycle++) {
+        scheduler.next();
+        REQUIRE(scheduler.scheduled(every));
+        REQUIRE(scheduler.scheduled(fifth) == (cycle % 5 == 0));
+        if (scheduler.scheduled(fifth)) {
+            fifthSent++;
+        }
+
+        // exactly one of the spread requests is sent in every cycle
+        int sent = 0;
+        for (int i = 0; i < 4; i++) {
+            if (scheduler.scheduled(spread[i])) {
+                sent++;
+            }
+        }
+        REQUIRE(sent == 1);
+        REQUIRE(scheduler.getBytes() == 110 + 15 + (scheduler.scheduled(fifth) ? 20 : 0));
+    }
+    REQUIRE(fifthSent == 20);
+}
+
+TEST_CASE("Budget postpones requests", "[RequestScheduler]") {
+    RequestScheduler scheduler;
+    scheduler.clear(100);
+    scheduler.reserve(50);
+
+    int every = scheduler.add(1, 20, 0);
+    int slow[6];
+    for (int i = 0; i < 6; i++) {
+        // all requests due in the same cycle
+        slow[i] = scheduler.add(3, 10, 0);
+    }
+
+    int sent[6] = {0, 0, 0, 0, 0, 0};
+    int cycles = 300;
+    for (int cycle = 0; cycle < cycles; cycle++) {
+        scheduler.next();
+        REQUIRE(scheduler.scheduled(every));
+        REQUIRE(scheduler.getBytes() <= 100);
+        for (int i = 0; i < 6; i++) {
+            if (scheduler.scheduled(slow[i])) {
+                sent[i]++;
+            }
+        }
+    }
+
+    // 30 bytes of budget left in every cycle - 3 requests per cycle, each
+    // request is sent at most every third cycle
+    for (int i = 0; i < 6; i++) {
+        REQUIRE(sent[i] <= cycles / 3);
+        REQUIRE(sent[i] >= cycles / 3 - 2);
+    }
+}
+
+TEST_CASE("Overloaded budget doesn't starve requests", "[RequestScheduler]") {
+    RequestScheduler scheduler;
+    scheduler.clear(40);
+
+    int requests[8];
+    for (int i = 0; i < 8; i++) {
+        requests[i] = scheduler.add(2, 20, i);
+    }
+
+    // 4 requests due per cycle, but only 2 fits
+    int sent[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int cycle = 0; cycle < 400; cycle++) {
+        scheduler.next();
+        REQUIRE(scheduler.getBytes() <= 40);
+        for (int i = 0; i < 8; i++) {
+            if (scheduler.scheduled(requests[i])) {
+                sent[i]++;
+            }
+        }
+    }
+
+    for (int i = 0; i < 8; i++) {
+        REQUIRE(sent[i] >= 80);
+    }
+}
+
+TEST_CASE("Mandatory requests are sent over budget", "[RequestScheduler]") {
+    RequestScheduler scheduler;
+    scheduler.clear(30);
+    scheduler.reserve(20);
+
+    int every = scheduler.add(1, 20, 0);
+    int other = scheduler.add(2, 5, 0);
+
+    for (int cycle = 0; cycle < 10; cycle++) {
+        scheduler.next();
+        REQUIRE(scheduler.scheduled(every));
+        REQUIRE(scheduler.scheduled(other) == false);
+        REQUIRE(scheduler.getBytes() == 40);
+    }
+
+    REQUIRE(scheduler.getMandatoryBytes() == 40);
+
+    scheduler.clear(0);
+    REQUIRE(scheduler.getMandatoryBytes() == 0);
+}
@@ -0,0 +1,97 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests StagePipeline.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <StagePipeline.h>
+
+using namespace std::chrono_literals;
+using namespace LSST::M1M3::SS;
+
+std::vector<int> executed;
+
+const StagePipeline::Stage stages[] = {
+        {"First", [] { executed.push_back(0); }},
+        {"Second", [] { executed.push_back(1); }},
+        {"Third",
+         [] {
+             executed.push_back(2);
+             std::this_thread::sleep_for(1ms);
+         }},
+        {"Fourth", [] { executed.push_back(3); }},
+};
+
+TEST_CASE("StagePipeline runs enabled stages in order", "[StagePipeline]") {
+    StagePipeline pipeline(stages);
+
+    REQUIRE(pipeline.size() == 4);
+    REQUIRE(std::string(pipeline.getName(2)) == "Third");
+
+    executed.clear();
+    pipeline.run(0);
+    REQUIRE(executed.empty());
+
+    pipeline.run(StagePipeline::bit(3) | StagePipeline::bit(0) | StagePipeline::bit(2));
+    REQUIRE(executed == std::vector<int>{0, 2, 3});
+
+    // bits beyond stage count are ignored
+    executed.clear();
+    pipeline.run(UINT32_MAX);
+    REQUIRE(executed == std::vector<int>{0, 1, 2, 3});
+
+    // timing is off by default
+    REQUIRE(pipeline.getTiming() == false);
+    REQUIRE(pipeline.getTiming(2).runs == 0);
+}
+
+TEST_CASE("StagePipeline timing", "[StagePipeline]") {
+    StagePipeline pipeline(stages);
+
+    pipeline.setTiming(true);
+
+    executed.clear();
+    pipeline.run(StagePipeline::bit(1) | StagePipeline::bit(2));
+    pipeline.run(StagePipeline::bit(2));
+
+    REQUIRE(pipeline.getTiming(0).runs == 0);
+    REQUIRE(pipeline.getTiming(1).runs == 1);
+    REQUIRE(pipeline.getTiming(2).runs == 2);
+    REQUIRE(pipeline.getTiming(2).last >= 1ms);
+    REQUIRE(pipeline.getTiming(2).max >= pipeline.getTiming(2).last);
+    REQUIRE(pipeline.getTiming(2).total >= 2ms);
+
+    pipeline.setTiming(false);
+    REQUIRE(pipeline.getTiming(2).runs == 0);
+    pipeline.run(StagePipeline::bit(2));
+    REQUIRE(pipeline.getTiming(2).runs == 0);
+}
+
+TEST_CASE("StagePipeline limits", "[StagePipeline]") {
+    std::vector<StagePipeline::Stage> many(StagePipeline::MAX_STAGES + 1, {"Stage", [] {}});
+    REQUIRE_THROWS(StagePipeline(many.data(), many.size()));
+    REQUIRE_NOTHROW(StagePipeline(many.data(), StagePipeline::MAX_STAGES));
+}
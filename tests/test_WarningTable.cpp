@@ -0,0 +1,205 @@
+/*
+ * This file is part of LSST M1M3 SS test suite. Tests WarningTable.
+ *
+ * Developed for the LSST Telescope and Site Systems.
+ * This product includes software developed by the LSST Project
+ * (https://www.lsst.org).
+ * See the COPYRIGHT file at the top-level directory of this distribution
+ * for details of code ownership.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include <EventChangeTracker.h>
+#include <WarningTable.h>
+
+using namespace LSST::M1M3::SS;
+
+struct TestWarning {
+    bool anyWarning;
+    bool first;
+    bool second;
+    bool fourth;
+    bool lowA;
+    bool lowB;
+};
+
+class TestNotifier {
+public:
+    void notifyFirst(bool flag) { calls.push_back(flag ? 1 : -1); }
+    void notifySecond(bool flag) { calls.push_back(flag ? 2 : -2); }
+    void notifyFourth(bool flag) { calls.push_back(flag ? 4 : -4); }
+
+    std::vector<int> calls;
+};
+
+typedef WarningTable<TestWarning, TestNotifier> TestTable;
+
+const TestTable::Entry codeEntries[] = {
+        {&TestWarning::anyWarning, 0, TestTable::ANY_CODE, false, nullptr},
+        {&TestWarning::first, 0, TestTable::codeWord(1), false, &TestNotifier::notifyFirst},
+        {&TestWarning::second, 0, TestTable::codeWord(2) | TestTable::codeWord(3), false,
+         &TestNotifier::notifySecond},
+        {&TestWarning::fourth, 0, TestTable::codeWord(4), false, &TestNotifier::notifyFourth},
+};
+
+const TestTable::Entry bitEntries[] = {
+        {&TestWarning::lowA, 0, 0x01, true, nullptr},
+        {&TestWarning::lowB, 1, 0x40, true, nullptr},
+};
+
+TEST_CASE("WarningTable code words", "[WarningTable]") {
+    REQUIRE(TestTable::codeWord(0) == 0);
+    REQUIRE(TestTable::codeWord(1) == 0x02);
+    REQUIRE(TestTable::codeWord(12) == 0x1000);
+    REQUIRE(TestTable::codeWord(31) == 0x80000000);
+    REQUIRE(TestTable::codeWord(200) == 0x80000000);
+    REQUIRE((TestTable::codeWord(200) & TestTable::ANY_CODE) != 0);
+}
+
+TEST_CASE("WarningTable error code decoding", "[WarningTable]") {
+    TestTable table(codeEntries);
+    REQUIRE(table.size() == 4);
+
+    TestWarning warning = {};
+    EventChangeTracker tracker;
+    TestNotifier notifier;
+
+    tracker.check();
+
+    uint32_t word = TestTable::codeWord(0);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 0);
+    REQUIRE(tracker.check() == false);
+    REQUIRE(notifier.calls.empty());
+
+    word = TestTable::codeWord(1);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 2);
+    REQUIRE(warning.anyWarning == true);
+    REQUIRE(warning.first == true);
+    REQUIRE(warning.second == false);
+    REQUIRE(tracker.check() == true);
+    REQUIRE(notifier.calls == std::vector<int>{1});
+
+    // the same code again - nothing changed, but active field is notified again
+    notifier.calls.clear();
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 0);
+    REQUIRE(tracker.check() == false);
+    REQUIRE(notifier.calls == std::vector<int>{1});
+
+    // both codes 2 and 3 map to second
+    notifier.calls.clear();
+    word = TestTable::codeWord(3);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 2);
+    REQUIRE(warning.anyWarning == true);
+    REQUIRE(warning.first == false);
+    REQUIRE(warning.second == true);
+    REQUIRE(notifier.calls == std::vector<int>{-1, 2});
+
+    notifier.calls.clear();
+    word = TestTable::codeWord(2);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 0);
+    REQUIRE(notifier.calls == std::vector<int>{2});
+
+    // unknown code sets only anyWarning
+    notifier.calls.clear();
+    word = TestTable::codeWord(10);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 1);
+    REQUIRE(warning.anyWarning == true);
+    REQUIRE(warning.second == false);
+    REQUIRE(notifier.calls == std::vector<int>{-2});
+
+    notifier.calls.clear();
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 0);
+    REQUIRE(notifier.calls.empty());
+
+    notifier.calls.clear();
+    word = TestTable::codeWord(4);
+    table.decode(&word, &warning, &tracker, nullptr);
+    REQUIRE(warning.fourth == true);
+    REQUIRE(notifier.calls.empty());
+
+    tracker.check();
+    REQUIRE(table.clear(&warning, &tracker, &notifier) == 2);
+    REQUIRE(warning.anyWarning == false);
+    REQUIRE(warning.fourth == false);
+    REQUIRE(tracker.check() == true);
+    REQUIRE(notifier.calls == std::vector<int>{-4});
+
+    REQUIRE(table.clear(&warning, &tracker, &notifier) == 0);
+    REQUIRE(tracker.check() == false);
+}
+
+TEST_CASE("WarningTable recover then same error", "[WarningTable]") {
+    TestTable table(codeEntries);
+
+    TestWarning warning = {};
+    EventChangeTracker tracker;
+    TestNotifier notifier;
+
+    tracker.check();
+
+    uint32_t word = TestTable::codeWord(4);
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 2);
+    REQUIRE(notifier.calls == std::vector<int>{4});
+
+    // error persists while the fault is recovered - fault is raised again
+    notifier.calls.clear();
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 0);
+    REQUIRE(notifier.calls == std::vector<int>{4});
+
+    // sensor recovers
+    notifier.calls.clear();
+    REQUIRE(table.clear(&warning, &tracker, &notifier) == 2);
+    REQUIRE(warning.fourth == false);
+    REQUIRE(notifier.calls == std::vector<int>{-4});
+    REQUIRE(tracker.check() == true);
+
+    // and reports the same error again
+    notifier.calls.clear();
+    REQUIRE(table.decode(&word, &warning, &tracker, &notifier) == 2);
+    REQUIRE(warning.anyWarning == true);
+    REQUIRE(warning.fourth == true);
+    REQUIRE(notifier.calls == std::vector<int>{4});
+    REQUIRE(tracker.check() == true);
+}
+
+TEST_CASE("WarningTable active low bits", "[WarningTable]") {
+    TestTable table(bitEntries);
+
+    TestWarning warning = {};
+    EventChangeTracker tracker;
+
+    uint32_t words[2] = {0xFF, 0xFF};
+    REQUIRE(table.decode(words, &warning, &tracker, nullptr) == 0);
+    REQUIRE(warning.lowA == false);
+    REQUIRE(warning.lowB == false);
+
+    words[1] = 0xBF;
+    REQUIRE(table.decode(words, &warning, &tracker, nullptr) == 1);
+    REQUIRE(warning.lowA == false);
+    REQUIRE(warning.lowB == true);
+
+    words[0] = 0xFE;
+    words[1] = 0x40;
+    REQUIRE(table.decode(words, &warning, &tracker, nullptr) == 2);
+    REQUIRE(warning.lowA == true);
+    REQUIRE(warning.lowB == false);
+
+    REQUIRE(table[1].word == 1);
+    REQUIRE(table[1].mask == 0x40);
+}
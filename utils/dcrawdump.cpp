@@ -21,120 +21,431 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if (defined(_WIN16) || defined(_WIN32) || defined(_WIN64)) && !defined(__WINDOWS__)
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
 
-#define __WINDOWS__
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-#endif
+#include <NiFpga_M1M3SupportFPGA.h>
 
-#if defined(__linux__) || defined(__CYGWIN__)
+// number of channels in raw file
+constexpr size_t CHANNELS = 8;
+// bytes per channel - 24 bits big endian fixed point
+constexpr size_t CHANNEL_SIZE = 3;
+// bytes per sample (record)
+constexpr size_t RECORD_SIZE = CHANNELS * CHANNEL_SIZE;
+// samples decoded at once
+constexpr size_t CHUNK_SAMPLES = 16384;
+
+// binary columnar format magic
+constexpr char BINARY_MAGIC[8] = {'M', '1', 'M', '3', 'D', 'C', 'R', '1'};
+
+const NiFpga_FxpTypeInfo typeInfo = NiFpga_M1M3SupportFPGA_TargetToHostFifoFxp_RawAccelerometer_TypeInfo;
+
+void printHelp() {
+    std::cout << "Decodes raw DC accelerometer output. Needs at least one file as argument. Multiple files "
+                 "(e.g. rotated recording) are processed as a single stream."
+              << std::endl
+              << "Options:" << std::endl
+              << "  -b writes binary columnar output instead of CSV. Requires -o" << std::endl
+              << "  -c <channels> comma separated list of channels (1-8) or ranges (1-3) to output"
+              << std::endl
+              << "  -C checks decoded values against NiFpga_ConvertFromFxpToFloat" << std::endl
+              << "  -d <n> decimation - outputs every n-th sample" << std::endl
+              << "  -h prints this help" << std::endl
+              << "  -o <file> output file. Defaults to standard output" << std::endl
+              << std::endl
+              << "Binary columnar format (host byte order):" << std::endl
+              << "  char[8]   magic \"M1M3DCR1\"" << std::endl
+              << "  uint32    number of channels (N)" << std::endl
+              << "  uint32    decimation" << std::endl
+              << "  uint64    number of samples (S)" << std::endl
+              << "  uint32[N] channel numbers (1-8)" << std::endl
+              << "  float[S]  samples of the first channel, followed by the other channels" << std::endl;
+}
 
-#include <endian.h>
+/**
+ * Memory mapped raw file.
+ */
+struct RawFile {
+    const char* path;
+    const unsigned char* data;
+    size_t size;
+    size_t samples;
+};
+
+bool mapFile(RawFile& file) {
+    file.data = NULL;
+    file.size = 0;
+    file.samples = 0;
+
+    int fd = open(file.path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Cannot open raw DC accelerometer file " << file.path << ": " << strerror(errno)
+                  << std::endl;
+        return false;
+    }
 
-#elif defined(__APPLE__)
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        std::cerr << "Cannot stat " << file.path << ": " << strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
 
-#include <libkern/OSByteOrder.h>
+    file.size = st.st_size;
+    if (file.size > 0) {
+        void* data = mmap(NULL, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            std::cerr << "Cannot map " << file.path << ": " << strerror(errno) << std::endl;
+            close(fd);
+            return false;
+        }
+        madvise(data, file.size, MADV_SEQUENTIAL);
+        file.data = static_cast<const unsigned char*>(data);
+    }
+    close(fd);
 
-#define be64toh(x) OSSwapBigToHostInt64(x)
+    file.samples = file.size / RECORD_SIZE;
+    if (file.size % RECORD_SIZE != 0) {
+        std::cerr << "File " << file.path << " contains incomplete record, ignoring last "
+                  << file.size % RECORD_SIZE << " bytes" << std::endl;
+    }
+    return true;
+}
 
-#define __BYTE_ORDER BYTE_ORDER
-#define __BIG_ENDIAN BIG_ENDIAN
-#define __LITTLE_ENDIAN LITTLE_ENDIAN
-#define __PDP_ENDIAN PDP_ENDIAN
+/**
+ * Decodes samples into columns. Only every decimation-th sample is decoded.
+ *
+ * @param data raw data, pointing to the first decoded sample
+ * @param samples number of decoded (output) samples
+ * @param decimation decimation
+ * @param channels channels (0-7) to decode
+ * @param columns output columns, one per channel
+ */
+void decode(const unsigned char* data, size_t samples, size_t decimation, const std::vector<int>& channels,
+            std::vector<std::vector<float>>& columns) {
+    // the same value as NiFpga_ConvertFromFxpToFloat uses - power of 2, so
+    // multiplication is exact
+    const float delta = NiFpga_CalculateFxpDeltaFloat(typeInfo);
+    const int shift = 32 - typeInfo.wordLength;
+    const size_t stride = decimation * RECORD_SIZE;
+
+    for (size_t c = 0; c < channels.size(); c++) {
+        const unsigned char* d = data + channels[c] * CHANNEL_SIZE;
+        float* out = columns[c].data();
+        if (typeInfo.isSigned) {
+            for (size_t s = 0; s < samples; s++, d += stride) {
+                uint32_t raw = (uint32_t(d[0]) << 24) | (d[1] << 16) | (d[2] << 8);
+                out[s] = delta * static_cast<float>(static_cast<int32_t>(raw) >> shift);
+            }
+        } else {
+            for (size_t s = 0; s < samples; s++, d += stride) {
+                uint32_t raw = (uint32_t(d[0]) << 24) | (d[1] << 16) | (d[2] << 8);
+                out[s] = delta * static_cast<float>(raw >> shift);
+            }
+        }
+    }
+}
 
-#elif defined(__OpenBSD__)
+/**
+ * Checks decoded samples against NI conversion routine.
+ *
+ * @return number of mismatched values
+ */
+size_t check(const unsigned char* data, size_t samples, size_t decimation, const std::vector<int>& channels,
+             const std::vector<std::vector<float>>& columns) {
+    size_t mismatches = 0;
+    for (size_t s = 0; s < samples; s++) {
+        const unsigned char* record = data + s * decimation * RECORD_SIZE;
+        for (size_t c = 0; c < channels.size(); c++) {
+            const unsigned char* d = record + channels[c] * CHANNEL_SIZE;
+            uint64_t raw = (d[0] << 16) | (d[1] << 8) | d[2];
+            float expected = NiFpga_ConvertFromFxpToFloat(typeInfo, raw);
+            if (memcmp(&expected, &columns[c][s], sizeof(float)) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    return mismatches;
+}
 
-#include <sys/endian.h>
+bool writeAll(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t ret = write(fd, data, length);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Cannot write output: " << strerror(errno) << std::endl;
+            return false;
+        }
+        data += ret;
+        length -= ret;
+    }
+    return true;
+}
 
-#elif defined(__NetBSD__) || defined(__FreeBSD__) || defined(__DragonFly__)
+bool pwriteAll(int fd, const char* data, size_t length, off_t offset) {
+    while (length > 0) {
+        ssize_t ret = pwrite(fd, data, length, offset);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            std::cerr << "Cannot write output: " << strerror(errno) << std::endl;
+            return false;
+        }
+        data += ret;
+        length -= ret;
+        offset += ret;
+    }
+    return true;
+}
 
-#include <sys/endian.h>
+/**
+ * Formats CSV rows. Values are formatted as with std::cout << float (%g).
+ */
+class CSVWriter {
+public:
+    CSVWriter(int fd) : _fd(fd), _buffer(1024 * 1024), _used(0) {}
+
+    bool header(const std::vector<int>& channels) {
+        std::string line;
+        for (size_t c = 0; c < channels.size(); c++) {
+            line += (c > 0 ? ",Acc" : "Acc") + std::to_string(channels[c] + 1);
+        }
+        line += "\n";
+        return writeAll(_fd, line.c_str(), line.length());
+    }
 
-#define be64toh(x) betoh64(x)
+    bool rows(const std::vector<std::vector<float>>& columns, size_t samples) {
+        // maximal length of %g formatted float is 13 characters + separator
+        const size_t row_size = columns.size() * 14;
+        for (size_t s = 0; s < samples; s++) {
+            if (_used + row_size > _buffer.size() && flush() == false) {
+                return false;
+            }
+            char* p = _buffer.data() + _used;
+            for (size_t c = 0; c < columns.size(); c++) {
+                p = std::to_chars(p, p + 13, columns[c][s], std::chars_format::general, 6).ptr;
+                *p = ',';
+                p++;
+            }
+            p[-1] = '\n';
+            _used = p - _buffer.data();
+        }
+        return true;
+    }
 
-#elif defined(__WINDOWS__)
+    bool flush() {
+        bool ret = writeAll(_fd, _buffer.data(), _used);
+        _used = 0;
+        return ret;
+    }
 
-#include <windows.h>
+private:
+    int _fd;
+    std::vector<char> _buffer;
+    size_t _used;
+};
+
+bool parseChannels(const char* arg, std::vector<int>& channels) {
+    channels.clear();
+    const char* p = arg;
+    while (*p) {
+        char* end;
+        long first = strtol(p, &end, 10);
+        long last = first;
+        if (end == p) {
+            return false;
+        }
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p) {
+                return false;
+            }
+        }
+        if (first < 1 || last > static_cast<long>(CHANNELS) || first > last) {
+            return false;
+        }
+        for (long c = first; c <= last; c++) {
+            channels.push_back(c - 1);
+        }
+        if (*end == ',') {
+            end++;
+        } else if (*end != '\0') {
+            return false;
+        }
+        p = end;
+    }
+    return channels.empty() == false;
+}
 
-#if BYTE_ORDER == LITTLE_ENDIAN
+int main(int argc, char** argv) {
+    bool binary = false;
+    bool checkValues = false;
+    size_t decimation = 1;
+    const char* output = NULL;
+    std::vector<int> channels;
+
+    for (size_t c = 0; c < CHANNELS; c++) {
+        channels.push_back(c);
+    }
 
-#if defined(_MSC_VER)
-#include <stdlib.h>
-#define be64toh(x) _byteswap_uint64(x)
+    int opt;
+    while ((opt = getopt(argc, argv, "bc:Cd:ho:")) != -1) {
+        switch (opt) {
+            case 'b':
+                binary = true;
+                break;
+            case 'c':
+                if (parseChannels(optarg, channels) == false) {
+                    std::cerr << "Invalid channel list: " << optarg << std::endl;
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'C':
+                checkValues = true;
+                break;
+            case 'd':
+                decimation = strtoul(optarg, NULL, 10);
+                if (decimation < 1) {
+                    std::cerr << "Invalid decimation: " << optarg << std::endl;
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'h':
+                printHelp();
+                return EXIT_SUCCESS;
+            case 'o':
+                output = optarg;
+                break;
+            default:
+                printHelp();
+                return EXIT_FAILURE;
+        }
+    }
 
-#elif defined(__GNUC__) || defined(__clang__)
+    if (optind >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
 
-#define be64toh(x) __builtin_bswap64(x)
-#else
-#error platform not supported
-#endif
+    if (binary && output == NULL) {
+        std::cerr << "Binary output requires output file (-o)." << std::endl;
+        return EXIT_FAILURE;
+    }
 
-#else
+    std::vector<RawFile> files;
+    uint64_t totalSamples = 0;
+    for (int i = optind; i < argc; i++) {
+        RawFile file;
+        file.path = argv[i];
+        if (mapFile(file) == false) {
+            return EXIT_FAILURE;
+        }
+        files.push_back(file);
+        totalSamples += file.samples;
+    }
 
-#error byte order not supported
+    // decimation runs over all files, as rotated files form a single stream
+    const uint64_t outputSamples = (totalSamples + decimation - 1) / decimation;
 
-#endif
+    int fd = STDOUT_FILENO;
+    if (output != NULL) {
+        fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            std::cerr << "Cannot open output file " << output << ": " << strerror(errno) << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
 
-#define __BYTE_ORDER BYTE_ORDER
-#define __BIG_ENDIAN BIG_ENDIAN
-#define __LITTLE_ENDIAN LITTLE_ENDIAN
-#define __PDP_ENDIAN PDP_ENDIAN
+    CSVWriter csv(fd);
+    off_t dataOffset = 0;
+
+    if (binary) {
+        std::vector<char> header(BINARY_MAGIC, BINARY_MAGIC + sizeof(BINARY_MAGIC));
+        auto append = [&header](const auto& value) {
+            const char* p = reinterpret_cast<const char*>(&value);
+            header.insert(header.end(), p, p + sizeof(value));
+        };
+        append(static_cast<uint32_t>(channels.size()));
+        append(static_cast<uint32_t>(decimation));
+        append(outputSamples);
+        for (auto c : channels) {
+            append(static_cast<uint32_t>(c + 1));
+        }
+        if (writeAll(fd, header.data(), header.size()) == false) {
+            return EXIT_FAILURE;
+        }
+        dataOffset = header.size();
+    } else if (csv.header(channels) == false) {
+        return EXIT_FAILURE;
+    }
 
-#else
+    std::vector<std::vector<float>> columns(channels.size(), std::vector<float>(CHUNK_SAMPLES));
 
-#error platform not supported
+    uint64_t written = 0;
+    uint64_t streamSample = 0;
+    size_t mismatches = 0;
 
-#endif
+    for (auto& file : files) {
+        // first sample in this file passing decimation
+        size_t s = (decimation - streamSample % decimation) % decimation;
+        while (s < file.samples) {
+            size_t count = std::min(CHUNK_SAMPLES, (file.samples - s + decimation - 1) / decimation);
+            const unsigned char* data = file.data + s * RECORD_SIZE;
 
-#include <fstream>
-#include <iostream>
+            decode(data, count, decimation, channels, columns);
 
-#include <NiFpga_M1M3SupportFPGA.h>
+            if (checkValues) {
+                mismatches += check(data, count, decimation, channels, columns);
+            }
 
-int main(int argc, char** argv) {
-    if (argc == 1) {
-        std::cerr << "Decodes raw DC accelerometer output. Needs at least one file "
-                     "as argument."
-                  << std::endl;
-        return -1;
-    }
-    std::ifstream file;
-
-    for (int i = 1; i <= 8; i++) {
-        std::cout << "Acc" << +i;
-        if (i < 8) {
-            std::cout << ",";
-        }
-    }
-
-    std::cout << std::endl;
-
-    for (int i = 1; i < argc; i++) {
-        try {
-            // auto file = std::ifstream(argv[i], std::ifstream::in |
-            // std::fstream::binary);
-            file.open(argv[i], std::ifstream::binary);
-            file.exceptions(std::ios::eofbit | std::ios::badbit | std::ios::failbit);
-            int i = 0;
-            while (!file.eof()) {
-                uint64_t data;
-                file.read(reinterpret_cast<char*>(&data) + 5, 3);
-                data = be64toh(data);
-                std::cout << NiFpga_ConvertFromFxpToFloat(
-                        NiFpga_M1M3SupportFPGA_TargetToHostFifoFxp_RawAccelerometer_TypeInfo, data);
-                i++;
-                if (i == 8) {
-                    std::cout << std::endl;
-                    i = 0;
-                } else {
-                    std::cout << ",";
+            if (binary) {
+                for (size_t c = 0; c < channels.size(); c++) {
+                    off_t offset = dataOffset + (c * outputSamples + written) * sizeof(float);
+                    if (pwriteAll(fd, reinterpret_cast<const char*>(columns[c].data()),
+                                  count * sizeof(float), offset) == false) {
+                        return EXIT_FAILURE;
+                    }
                 }
+            } else if (csv.rows(columns, count) == false) {
+                return EXIT_FAILURE;
             }
-        } catch (const std::ios_base::failure& e) {
-            if (file.eof()) {
-                continue;
-            }
-            std::cerr << "Cannot read raw DC accelerometer file " << argv[i] << ": " << e.what() << std::endl;
+
+            written += count;
+            s += count * decimation;
+        }
+        streamSample += file.samples;
+        munmap(const_cast<unsigned char*>(file.data), file.size);
+    }
+
+    if (binary == false && csv.flush() == false) {
+        return EXIT_FAILURE;
+    }
+
+    if (output != NULL) {
+        close(fd);
+    }
+
+    if (checkValues) {
+        std::cerr << "Checked " << written * channels.size() << " values, " << mismatches << " mismatches"
+                  << std::endl;
+        if (mismatches > 0) {
+            return EXIT_FAILURE;
         }
     }
+
+    return EXIT_SUCCESS;
 }